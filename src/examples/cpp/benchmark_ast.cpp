@@ -0,0 +1,345 @@
+/*
+** Micro benchmarks of the AST layer and of the symbolic memory.
+**
+** Usage: ./benchmark_ast <mode> [iterations]
+**
+**  flags  - Builds the result and flag expressions of a chain of adds with the AstContext builders.
+**  trace  - Processes a representative x86-64 trace with the symbolic engine.
+**  lazy   - Same as trace with the LAZY_FLAGS mode enabled.
+**  init   - Measures the init() throughput of each kind of node on 64-bit (native) and 128-bit operands.
+**  z3     - Converts to Z3 the constraints of src/samples/smt applied on a chain of [iterations] (default 16)
+**           symbolic expressions, each one referencing the previous one twice.
+**  memory - Stores [iterations] * 256 qwords in the symbolic memory, then reads them byte per byte, overwrites
+**           every other one unaligned, enumerates the ranges and removes them. Also reports the peak RSS once
+**           the qwords are stored.
+**
+** Each mode reports the number of heap allocations, the number of live pool blocks,
+** the peak RSS and the elapsed time. Run one mode per process to compare peak RSS.
+*/
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <vector>
+
+#include <sys/resource.h>
+
+#include <triton/api.hpp>
+#include <triton/ast.hpp>
+#include <triton/astContext.hpp>
+#include <triton/symbolicMemory.hpp>
+#include <triton/tritonToZ3Ast.hpp>
+#include <triton/x86Specifications.hpp>
+
+using namespace triton;
+using namespace triton::arch;
+using namespace triton::ast;
+using namespace triton::engines::symbolic;
+
+
+
+/* Counts all heap allocations of the process */
+static unsigned long long allocations = 0;
+
+void* operator new(std::size_t size) {
+  allocations++;
+  void* p = std::malloc(size ? size : 1);
+  if (p == nullptr)
+    throw std::bad_alloc();
+  return p;
+}
+
+void operator delete(void* p) noexcept {
+  std::free(p);
+}
+
+
+struct op {
+  unsigned int    addr;
+  unsigned char*  inst;
+  unsigned int    size;
+};
+
+/* A checksum loop body */
+struct op trace[] = {
+  {0x400000, (unsigned char *)"\x48\x0f\xb6\x0e",             4}, /* movzx      rcx, byte ptr [rsi]         */
+  {0x400004, (unsigned char *)"\x48\x01\xc8",                 3}, /* add        rax, rcx                    */
+  {0x400007, (unsigned char *)"\x48\x31\xd8",                 3}, /* xor        rax, rbx                    */
+  {0x40000a, (unsigned char *)"\x48\xc1\xe0\x05",             4}, /* shl        rax, 5                      */
+  {0x40000e, (unsigned char *)"\x48\xff\xc6",                 3}, /* inc        rsi                         */
+  {0x400011, (unsigned char *)"\x48\xff\xca",                 3}, /* dec        rdx                         */
+  {0x400014, (unsigned char *)"\x75\xea",                     2}, /* jne        0x400000                    */
+  {0x0,      nullptr,                                         0}
+};
+
+
+/* Builds the result, sf, zf and pf expressions of an add, as the x86 semantics do */
+static void buildFlags(AstContext& ctxt, const SharedAbstractNode& op1, const SharedAbstractNode& op2, std::vector<SharedAbstractNode>& keep) {
+  SharedAbstractNode res = ctxt.bvadd(op1, op2);
+  SharedAbstractNode sf  = ctxt.extract(63, 63, res);
+  SharedAbstractNode zf  = ctxt.ite(ctxt.equal(res, ctxt.bv(0, 64)), ctxt.bv(1, 1), ctxt.bv(0, 1));
+
+  SharedAbstractNode pf = ctxt.bv(1, 1);
+  for (triton::uint32 i = 0; i < 8; i++)
+    pf = ctxt.bvxor(pf, ctxt.extract(0, 0, ctxt.bvlshr(ctxt.extract(7, 0, res), ctxt.bv(i, 8))));
+
+  keep.push_back(res);
+  keep.push_back(sf);
+  keep.push_back(zf);
+  keep.push_back(pf);
+}
+
+
+static void benchFlags(API& api, unsigned int iterations, std::vector<SharedAbstractNode>& keep) {
+  AstContext& ctxt = api.getAstContext();
+
+  SharedAbstractNode op1 = ctxt.variable(*api.newSymbolicVariable(64));
+  SharedAbstractNode op2 = ctxt.variable(*api.newSymbolicVariable(64));
+
+  for (unsigned int i = 0; i < iterations; i++) {
+    buildFlags(ctxt, op1, op2, keep);
+    op1 = keep[keep.size() - 4];
+  }
+}
+
+
+static void benchTrace(API& api, unsigned int iterations) {
+  api.setConcreteRegisterValue(api.getRegister(ID_REG_RSI), 0x1000);
+  api.setConcreteRegisterValue(api.getRegister(ID_REG_RDX), iterations);
+  api.convertRegisterToSymbolicVariable(api.getRegister(ID_REG_RBX));
+
+  for (unsigned int it = 0; it < iterations; it++) {
+    for (unsigned int i = 0; trace[i].inst; i++) {
+      Instruction inst;
+      inst.setOpcode(trace[i].inst, trace[i].size);
+      inst.setAddress(trace[i].addr);
+      api.processing(inst);
+    }
+  }
+}
+
+
+/* Returns the nanoseconds spent per init() of the node */
+static double timeInit(const SharedAbstractNode& node, unsigned int iterations) {
+  auto start = std::chrono::steady_clock::now();
+
+  for (unsigned int i = 0; i < iterations; i++)
+    node->init();
+
+  auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+  return static_cast<double>(elapsed) / iterations;
+}
+
+
+static void benchInit(API& api, unsigned int iterations) {
+  AstContext& ctxt = api.getAstContext();
+
+  typedef std::function<SharedAbstractNode(const SharedAbstractNode&, const SharedAbstractNode&)> Builder;
+  struct { const char* name; Builder build; } kinds[] = {
+    {"bvadd",   [&](const SharedAbstractNode& a, const SharedAbstractNode& b) { return ctxt.bvadd(a, b); }},
+    {"bvand",   [&](const SharedAbstractNode& a, const SharedAbstractNode& b) { return ctxt.bvand(a, b); }},
+    {"bvashr",  [&](const SharedAbstractNode& a, const SharedAbstractNode& b) { return ctxt.bvashr(a, ctxt.bv(7, b->getBitvectorSize())); }},
+    {"bvlshr",  [&](const SharedAbstractNode& a, const SharedAbstractNode& b) { return ctxt.bvlshr(a, ctxt.bv(7, b->getBitvectorSize())); }},
+    {"bvmul",   [&](const SharedAbstractNode& a, const SharedAbstractNode& b) { return ctxt.bvmul(a, b); }},
+    {"bvneg",   [&](const SharedAbstractNode& a, const SharedAbstractNode&) { return ctxt.bvneg(a); }},
+    {"bvnot",   [&](const SharedAbstractNode& a, const SharedAbstractNode&) { return ctxt.bvnot(a); }},
+    {"bvor",    [&](const SharedAbstractNode& a, const SharedAbstractNode& b) { return ctxt.bvor(a, b); }},
+    {"bvrol",   [&](const SharedAbstractNode& a, const SharedAbstractNode&) { return ctxt.bvrol(13, a); }},
+    {"bvsdiv",  [&](const SharedAbstractNode& a, const SharedAbstractNode& b) { return ctxt.bvsdiv(a, b); }},
+    {"bvshl",   [&](const SharedAbstractNode& a, const SharedAbstractNode& b) { return ctxt.bvshl(a, ctxt.bv(7, b->getBitvectorSize())); }},
+    {"bvslt",   [&](const SharedAbstractNode& a, const SharedAbstractNode& b) { return ctxt.bvslt(a, b); }},
+    {"bvsmod",  [&](const SharedAbstractNode& a, const SharedAbstractNode& b) { return ctxt.bvsmod(a, b); }},
+    {"bvsub",   [&](const SharedAbstractNode& a, const SharedAbstractNode& b) { return ctxt.bvsub(a, b); }},
+    {"bvudiv",  [&](const SharedAbstractNode& a, const SharedAbstractNode& b) { return ctxt.bvudiv(a, b); }},
+    {"bvult",   [&](const SharedAbstractNode& a, const SharedAbstractNode& b) { return ctxt.bvult(a, b); }},
+    {"bvxor",   [&](const SharedAbstractNode& a, const SharedAbstractNode& b) { return ctxt.bvxor(a, b); }},
+    {"concat",  [&](const SharedAbstractNode& a, const SharedAbstractNode& b) { return ctxt.concat(ctxt.extract(31, 0, a), ctxt.extract(31, 0, b)); }},
+    {"equal",   [&](const SharedAbstractNode& a, const SharedAbstractNode& b) { return ctxt.equal(a, b); }},
+    {"extract", [&](const SharedAbstractNode& a, const SharedAbstractNode&) { return ctxt.extract(39, 8, a); }},
+    {"ite",     [&](const SharedAbstractNode& a, const SharedAbstractNode& b) { return ctxt.ite(ctxt.equal(a, b), a, b); }},
+    {"sx",      [&](const SharedAbstractNode& a, const SharedAbstractNode&) { return ctxt.sx(32, ctxt.extract(31, 0, a)); }},
+    {"zx",      [&](const SharedAbstractNode& a, const SharedAbstractNode&) { return ctxt.zx(32, ctxt.extract(31, 0, a)); }},
+  };
+
+  triton::engines::symbolic::SymbolicVariable* vars[4] = {
+    api.newSymbolicVariable(64), api.newSymbolicVariable(64), api.newSymbolicVariable(128), api.newSymbolicVariable(128)
+  };
+
+  SharedAbstractNode a64  = ctxt.variable(*vars[0]);
+  SharedAbstractNode b64  = ctxt.variable(*vars[1]);
+  SharedAbstractNode a128 = ctxt.variable(*vars[2]);
+  SharedAbstractNode b128 = ctxt.variable(*vars[3]);
+
+  for (unsigned int i = 0; i < 4; i++)
+    api.setConcreteVariableValue(*vars[i], (i & 1) ? 0x0123456789abcdef : 0xdeadbeefcafebabe);
+
+  std::cout << "kind        64-bit (ns/init)  128-bit (ns/init)" << std::endl;
+  for (const auto& kind : kinds) {
+    double t64  = timeInit(kind.build(a64, b64), iterations);
+    double t128 = timeInit(kind.build(a128, b128), iterations);
+    std::cout << std::left << std::setw(12) << kind.name
+              << std::setw(18) << std::fixed << std::setprecision(1) << t64
+              << t128 << std::endl;
+  }
+}
+
+
+static void benchZ3(API& api, unsigned int depth) {
+  AstContext& ctxt = api.getAstContext();
+
+  /* e(i+1) = (e(i) + (e(i) ^ i)), as the destination register of a loop body */
+  SharedAbstractNode op1 = ctxt.variable(*api.newSymbolicVariable(64));
+  SharedAbstractNode op2 = ctxt.bv(0x41, 64);
+  SharedAbstractNode res = op1;
+
+  for (unsigned int i = 0; i < depth; i++) {
+    op1 = res;
+    res = ctxt.reference(api.newSymbolicExpression(ctxt.bvadd(op1, ctxt.bvxor(op1, ctxt.bv(i, 64)))));
+  }
+
+  SharedAbstractNode zf = ctxt.ite(ctxt.equal(res, ctxt.bv(0, 64)), ctxt.bv(1, 1), ctxt.bv(0, 1));
+  SharedAbstractNode sf = ctxt.extract(63, 63, res);
+  SharedAbstractNode cf = ctxt.ite(ctxt.bvult(op1, op2), ctxt.bv(1, 1), ctxt.bv(0, 1));
+  SharedAbstractNode of = ctxt.extract(63, 63, ctxt.bvand(ctxt.bvxor(op1, ctxt.bvnot(op2)), ctxt.bvxor(op1, res)));
+  SharedAbstractNode pf = ctxt.extract(0, 0, ctxt.bvlshr(ctxt.bv(0x6996, 16), ctxt.zx(8,
+                            ctxt.bvand(ctxt.bvxor(ctxt.extract(7, 0, res), ctxt.bvlshr(ctxt.extract(7, 0, res), ctxt.bv(4, 8))), ctxt.bv(15, 8)))));
+
+  struct { const char* name; SharedAbstractNode constraint; } samples[] = {
+    {"af",            ctxt.equal(ctxt.bv(16, 64), ctxt.bvand(ctxt.bv(16, 64), ctxt.bvxor(op1, ctxt.bvxor(op2, res))))},
+    {"cmp",           ctxt.equal(zf, ctxt.bv(1, 1))},
+    {"firstCharTest", ctxt.equal(ctxt.bvsub(ctxt.bvxor(ctxt.sx(24, ctxt.extract(7, 0, res)), ctxt.bv(85, 32)), ctxt.bv(49, 32)), ctxt.bv(0, 32))},
+    {"jbe",           ctxt.equal(ctxt.bvor(zf, cf), ctxt.bv(1, 1))},
+    {"jle",           ctxt.equal(ctxt.bvor(ctxt.bvxor(sf, of), zf), ctxt.bv(1, 1))},
+    {"jnbe",          ctxt.equal(ctxt.bvor(zf, cf), ctxt.bv(0, 1))},
+    {"jnle",          ctxt.equal(ctxt.bvor(ctxt.bvxor(sf, of), zf), ctxt.bv(0, 1))},
+    {"of",            ctxt.equal(of, ctxt.bv(1, 1))},
+    {"pf",            ctxt.equal(pf, ctxt.bv(0, 1))},
+    {"sf",            ctxt.equal(sf, ctxt.bv(1, 1))},
+  };
+
+  std::cout << "sample         conversion (ms)" << std::endl;
+  for (const auto& sample : samples) {
+    TritonToZ3Ast z3Ast{api.getSymbolicEngine(), false};
+    auto start = std::chrono::steady_clock::now();
+    z3Ast.convert(sample.constraint);
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    std::cout << std::left << std::setw(15) << sample.name << std::fixed << std::setprecision(3) << (elapsed / 1000.0) << std::endl;
+  }
+}
+
+
+static void benchMemory(API& api, unsigned int iterations) {
+  AstContext& ctxt = api.getAstContext();
+  triton::uint64 base = 0x10000000;
+  triton::uint64 stores = static_cast<triton::uint64>(iterations) * 256;
+  triton::uint64 checksum = 0;
+  std::vector<SharedSymbolicExpression> exprs;
+
+  for (triton::uint64 i = 0; i < 64; i++)
+    exprs.push_back(api.newSymbolicExpression(ctxt.bv(i, 64)));
+
+  SymbolicMemory memory;
+  std::vector<std::pair<const char*, double>> phases;
+  auto start = std::chrono::steady_clock::now();
+  auto phase = [&](const char* name) {
+    auto now = std::chrono::steady_clock::now();
+    phases.push_back(std::make_pair(name, std::chrono::duration_cast<std::chrono::microseconds>(now - start).count() / 1000.0));
+    start = now;
+  };
+
+  for (triton::uint64 i = 0; i < stores; i++)
+    memory.assign(base + i * 8, 8, exprs[i % 64]);
+  phase("stores");
+
+  /* The peak RSS before the ranges are built */
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+
+  for (triton::uint64 i = 0; i < stores * 8; i++) {
+    triton::uint32 offset = 0;
+    checksum += (memory.get(base + i, offset) != nullptr) + offset;
+  }
+  phase("byte reads");
+
+  for (triton::uint64 i = 0; i < stores; i += 2)
+    memory.assign(base + i * 8 + 4, 8, exprs[(i + 1) % 64]);
+  phase("unaligned");
+
+  checksum += memory.getRanges().size();
+  phase("ranges");
+
+  for (triton::uint64 i = 0; i < stores; i++)
+    memory.remove(base + i * 8, 8);
+  phase("removes");
+
+  std::cout << "phase          time (ms)" << std::endl;
+  for (const auto& item : phases)
+    std::cout << std::left << std::setw(15) << item.first << std::fixed << std::setprecision(3) << item.second << std::endl;
+  std::cout << "stores rss     " << usage.ru_maxrss << " KB" << std::endl;
+  std::cout << "checksum       " << checksum << std::endl;
+}
+
+
+int main(int ac, const char **av) {
+  unsigned int iterations = 10000;
+  struct rusage usage;
+
+  if (ac < 2) {
+    std::cerr << "Usage: " << av[0] << " <flags|trace|lazy|init|z3|memory> [iterations]" << std::endl;
+    return 1;
+  }
+
+  if (ac > 2)
+    iterations = std::strtoul(av[2], nullptr, 0);
+
+  API api;
+  api.setArchitecture(ARCH_X86_64);
+
+  /* The built expressions are released after the measures */
+  std::vector<SharedAbstractNode> keep;
+
+  unsigned long long before = allocations;
+  auto start = std::chrono::steady_clock::now();
+
+  if (!std::strcmp(av[1], "flags"))
+    benchFlags(api, iterations, keep);
+
+  else if (!std::strcmp(av[1], "trace"))
+    benchTrace(api, iterations);
+
+  else if (!std::strcmp(av[1], "lazy")) {
+    api.enableMode(triton::modes::LAZY_FLAGS, true);
+    benchTrace(api, iterations);
+  }
+
+  else if (!std::strcmp(av[1], "init"))
+    benchInit(api, iterations * 10);
+
+  else if (!std::strcmp(av[1], "z3"))
+    benchZ3(api, (ac > 2) ? iterations : 16);
+
+  else if (!std::strcmp(av[1], "memory"))
+    benchMemory(api, iterations);
+
+  else {
+    std::cerr << "Unknown mode: " << av[1] << std::endl;
+    return 1;
+  }
+
+  auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+  getrusage(RUSAGE_SELF, &usage);
+
+  std::cout << "mode        : " << av[1] << std::endl;
+  std::cout << "iterations  : " << iterations << std::endl;
+  std::cout << "allocations : " << (allocations - before) << std::endl;
+  std::cout << "pool blocks : " << api.getAstContext().getNodeAllocator().getPool()->getNumberOfBlocks() << std::endl;
+  std::cout << "pool slabs  : " << api.getAstContext().getNodeAllocator().getPool()->getNumberOfSlabs() << std::endl;
+  std::cout << "peak rss    : " << usage.ru_maxrss << " KB" << std::endl;
+  std::cout << "time        : " << elapsed << " ms" << std::endl;
+
+  return 0;
+}
@@ -337,6 +337,8 @@ namespace triton {
 
   triton::uint512 API::getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks) const {
     this->checkArchitecture();
+    if (this->symbolic)
+      this->symbolic->materializeLazyFlag(reg);
     return this->arch.getConcreteRegisterValue(reg, execCallbacks);
   }
 
@@ -367,6 +369,8 @@ namespace triton {
 
   void API::setConcreteRegisterValue(const triton::arch::Register& reg, const triton::uint512& value) {
     this->checkArchitecture();
+    if (this->symbolic)
+      this->symbolic->materializeLazyFlag(reg);
     this->arch.setConcreteRegisterValue(reg, value);
   }
 
@@ -389,6 +393,21 @@ namespace triton {
   }
 
 
+  void API::enableDecodeCache(bool flag) {
+    this->arch.getDecodeCache().enable(flag);
+  }
+
+
+  bool API::isDecodeCacheEnabled(void) const {
+    return this->arch.getDecodeCache().isEnabled();
+  }
+
+
+  triton::arch::DecodeCache& API::getDecodeCache(void) {
+    return this->arch.getDecodeCache();
+  }
+
+
 
   /* Processing API ================================================================================ */
 
@@ -403,7 +422,7 @@ namespace triton {
     if (this->solver == nullptr)
       throw triton::exceptions::API("API::initEngines(): No enough memory.");
 
-    this->taint = new(std::nothrow) triton::engines::taint::TaintEngine(this->symbolic, *this->getCpu());
+    this->taint = new(std::nothrow) triton::engines::taint::TaintEngine(this->symbolic, *this->getCpu(), this->modes);
     if (this->taint == nullptr)
       throw triton::exceptions::API("API::initEngines(): No enough memory.");
 
@@ -729,6 +748,7 @@ namespace triton {
 
   std::map<triton::arch::registers_e, triton::engines::symbolic::SharedSymbolicExpression> API::getSymbolicRegisters(void) const {
     this->checkSymbolic();
+    this->symbolic->materializeLazyFlags();
     return this->symbolic->getSymbolicRegisters();
   }
 
@@ -741,6 +761,7 @@ namespace triton {
 
   const triton::engines::symbolic::SharedSymbolicExpression& API::getSymbolicRegister(const triton::arch::Register& reg) const {
     this->checkSymbolic();
+    this->symbolic->materializeLazyFlag(reg);
     return this->symbolic->getSymbolicRegister(reg);
   }
 
@@ -865,6 +886,7 @@ namespace triton {
 
   bool API::isRegisterSymbolized(const triton::arch::Register& reg) const {
     this->checkSymbolic();
+    this->symbolic->materializeLazyFlag(reg);
     return this->symbolic->isRegisterSymbolized(reg);
   }
 
@@ -899,9 +921,9 @@ namespace triton {
   }
 
 
-  triton::ast::SharedAbstractNode API::unrollAst(const triton::ast::SharedAbstractNode& node) {
+  triton::ast::SharedAbstractNode API::unrollAst(const triton::ast::SharedAbstractNode& node, triton::usize maxDepth, triton::usize maxNodes) {
     this->checkSymbolic();
-    return this->symbolic->unrollAst(node);
+    return this->symbolic->unrollAst(node, maxDepth, maxNodes);
   }
 
 
@@ -956,6 +978,115 @@ namespace triton {
   }
 
 
+  void API::enableSolverCache(bool flag) {
+    this->checkSolver();
+    this->solver->getCache().enable(flag);
+  }
+
+
+  bool API::isSolverCacheEnabled(void) const {
+    this->checkSolver();
+    return this->solver->getCache().isEnabled();
+  }
+
+
+  triton::engines::solver::SolverCache& API::getSolverCache(void) {
+    this->checkSolver();
+    return this->solver->getCache();
+  }
+
+
+  void API::enableModelCache(bool flag) {
+    this->checkSolver();
+    this->solver->getModelCache().enable(flag);
+  }
+
+
+  bool API::isModelCacheEnabled(void) const {
+    this->checkSolver();
+    return this->solver->getModelCache().isEnabled();
+  }
+
+
+  triton::engines::solver::ModelCache& API::getModelCache(void) {
+    this->checkSolver();
+    return this->solver->getModelCache();
+  }
+
+
+  void API::enableConstraintPartitioning(bool flag) {
+    this->checkSolver();
+    this->solver->getPartitioner().enable(flag);
+  }
+
+
+  bool API::isConstraintPartitioningEnabled(void) const {
+    this->checkSolver();
+    return this->solver->getPartitioner().isEnabled();
+  }
+
+
+  triton::engines::solver::ConstraintPartitioner& API::getConstraintPartitioner(void) {
+    this->checkSolver();
+    return this->solver->getPartitioner();
+  }
+
+
+  void API::startSolverSession(void) {
+    this->checkSolver();
+    this->solver->startSession();
+  }
+
+
+  void API::stopSolverSession(void) {
+    this->checkSolver();
+    this->solver->stopSession();
+  }
+
+
+  bool API::isSolverSessionStarted(void) const {
+    this->checkSolver();
+    return this->solver->isSessionStarted();
+  }
+
+
+  void API::pushSolverSessionConstraint(const triton::ast::SharedAbstractNode& node) {
+    this->checkSolver();
+    this->solver->pushSessionConstraint(node);
+  }
+
+
+  void API::popSolverSessionConstraints(triton::usize count) {
+    this->checkSolver();
+    this->solver->popSessionConstraints(count);
+  }
+
+
+  triton::usize API::getNumberOfSolverSessionConstraints(void) const {
+    this->checkSolver();
+    return this->solver->getNumberOfSessionConstraints();
+  }
+
+
+  std::map<triton::uint32, triton::engines::solver::SolverModel> API::getSolverSessionModel(const triton::ast::SharedAbstractNode& node) {
+    this->checkSolver();
+    return this->solver->getSessionModel(node);
+  }
+
+
+  bool API::isSolverSessionSat(const triton::ast::SharedAbstractNode& node) {
+    this->checkSolver();
+    return this->solver->isSessionSat(node);
+  }
+
+
+  std::vector<triton::engines::solver::BranchSolution> API::solveAllBranches(bool dedup, triton::uint32 timeout) const {
+    this->checkSolver();
+    this->checkSymbolic();
+    return this->solver->solveBranches(this->symbolic->getPathConstraints(), dedup, timeout);
+  }
+
+
 
   /* Z3 interface API ============================================================================== */
 
@@ -992,7 +1123,7 @@ namespace triton {
   }
 
 
-  const std::set<triton::uint64>& API::getTaintedMemory(void) const {
+  const triton::engines::taint::ShadowMemory& API::getTaintedMemory(void) const {
     this->checkTaint();
     return this->taint->getTaintedMemory();
   }
@@ -1078,6 +1209,30 @@ namespace triton {
   }
 
 
+  bool API::taintMemory(const triton::arch::MemoryAccess& mem, triton::uint32 label) {
+    this->checkTaint();
+    return this->taint->taintMemory(mem, label);
+  }
+
+
+  bool API::taintRegister(const triton::arch::Register& reg, triton::uint32 label) {
+    this->checkTaint();
+    return this->taint->taintRegister(reg, label);
+  }
+
+
+  triton::uint64 API::getTaintLabels(const triton::arch::MemoryAccess& mem) const {
+    this->checkTaint();
+    return this->taint->getTaintLabels(mem);
+  }
+
+
+  triton::uint64 API::getTaintLabels(const triton::arch::Register& reg) const {
+    this->checkTaint();
+    return this->taint->getTaintLabels(reg);
+  }
+
+
   bool API::untaintMemory(triton::uint64 addr) {
     this->checkTaint();
     return this->taint->untaintMemory(addr);
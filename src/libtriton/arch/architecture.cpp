@@ -59,6 +59,7 @@ namespace triton {
 
       /* Setup global variables */
       this->arch = arch;
+      this->decodeCache.clear();
     }
 
 
@@ -66,6 +67,17 @@ namespace triton {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::clearArchitecture(): You must define an architecture.");
       this->cpu->clear();
+      this->decodeCache.clear();
+    }
+
+
+    triton::arch::DecodeCache& Architecture::getDecodeCache(void) {
+      return this->decodeCache;
+    }
+
+
+    const triton::arch::DecodeCache& Architecture::getDecodeCache(void) const {
+      return this->decodeCache;
     }
 
 
@@ -171,7 +183,14 @@ namespace triton {
     void Architecture::disassembly(triton::arch::Instruction& inst) const {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::disassembly(): You must define an architecture.");
+
+      if (this->decodeCache.isEnabled() && this->decodeCache.lookup(inst))
+        return;
+
       this->cpu->disassembly(inst);
+
+      if (this->decodeCache.isEnabled())
+        this->decodeCache.insert(inst);
     }
 
 
@@ -207,6 +226,7 @@ namespace triton {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::setConcreteMemoryValue(): You must define an architecture.");
       this->cpu->setConcreteMemoryValue(addr, value);
+      this->decodeCache.invalidate(addr, BYTE_SIZE);
     }
 
 
@@ -214,6 +234,7 @@ namespace triton {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::setConcreteMemoryValue(): You must define an architecture.");
       this->cpu->setConcreteMemoryValue(mem, value);
+      this->decodeCache.invalidate(mem.getAddress(), mem.getSize());
     }
 
 
@@ -221,6 +242,7 @@ namespace triton {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::setConcreteMemoryAreaValue(): You must define an architecture.");
       this->cpu->setConcreteMemoryAreaValue(baseAddr, values);
+      this->decodeCache.invalidate(baseAddr, values.size());
     }
 
 
@@ -228,6 +250,7 @@ namespace triton {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::setConcreteMemoryAreaValue(): You must define an architecture.");
       this->cpu->setConcreteMemoryAreaValue(baseAddr, area, size);
+      this->decodeCache.invalidate(baseAddr, size);
     }
 
 
@@ -249,6 +272,7 @@ namespace triton {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::unmapMemory(): You must define an architecture.");
       this->cpu->unmapMemory(baseAddr, size);
+      this->decodeCache.invalidate(baseAddr, size);
     }
 
   }; /* arch namespace */
@@ -0,0 +1,144 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <cstring>
+
+#include <triton/decodeCache.hpp>
+
+
+
+namespace triton {
+  namespace arch {
+
+    DecodeCache::DecodeCache() {
+      this->enabled = false;
+      this->maxSize = DECODE_CACHE_DEFAULT_SIZE;
+      this->hits    = 0;
+      this->misses  = 0;
+    }
+
+
+    bool DecodeCache::isEnabled(void) const {
+      return this->enabled;
+    }
+
+
+    void DecodeCache::enable(bool flag) {
+      this->enabled = flag;
+      if (flag == false)
+        this->clear();
+    }
+
+
+    triton::usize DecodeCache::getMaxSize(void) const {
+      return this->maxSize;
+    }
+
+
+    void DecodeCache::setMaxSize(triton::usize size) {
+      this->maxSize = size;
+      this->clear();
+    }
+
+
+    triton::usize DecodeCache::getSize(void) const {
+      return this->entries.size();
+    }
+
+
+    triton::usize DecodeCache::getHits(void) const {
+      return this->hits;
+    }
+
+
+    triton::usize DecodeCache::getMisses(void) const {
+      return this->misses;
+    }
+
+
+    bool DecodeCache::lookup(triton::arch::Instruction& inst) {
+      auto it = this->entries.find(inst.getAddress());
+
+      /* The opcode must start with the bytes of the cached instruction */
+      if (it == this->entries.end() || inst.getSize() < it->second.size || std::memcmp(inst.getOpcode(), it->second.opcode, it->second.size)) {
+        this->misses++;
+        return false;
+      }
+
+      const Entry& entry = it->second;
+
+      inst.setDisassembly(entry.disassembly);
+      inst.setSize(entry.size);
+      inst.setType(entry.type);
+      inst.setPrefix(entry.prefix);
+      inst.operands = entry.operands;
+
+      if (entry.branch)
+        inst.setBranch(true);
+
+      if (entry.controlFlow)
+        inst.setControlFlow(true);
+
+      this->hits++;
+      return true;
+    }
+
+
+    void DecodeCache::insert(const triton::arch::Instruction& inst) {
+      if (inst.getSize() > DECODE_CACHE_MAX_INST_SIZE || this->maxSize == 0)
+        return;
+
+      /* Flush the cache when it is full */
+      if (this->entries.size() >= this->maxSize) {
+        this->entries.clear();
+        this->addresses.clear();
+      }
+
+      Entry& entry = this->entries[inst.getAddress()];
+
+      std::memcpy(entry.opcode, inst.getOpcode(), inst.getSize());
+      entry.size        = inst.getSize();
+      entry.type        = inst.getType();
+      entry.prefix      = inst.getPrefix();
+      entry.branch      = inst.isBranch();
+      entry.controlFlow = inst.isControlFlow();
+      entry.disassembly = inst.getDisassembly();
+      entry.operands    = inst.operands;
+
+      this->addresses.insert(inst.getAddress());
+    }
+
+
+    void DecodeCache::invalidate(triton::uint64 baseAddr, triton::usize size) {
+      if (this->entries.empty())
+        return;
+
+      /* An instruction starting before baseAddr may overlap the area */
+      triton::uint64 low = (baseAddr >= DECODE_CACHE_MAX_INST_SIZE - 1) ? baseAddr - (DECODE_CACHE_MAX_INST_SIZE - 1) : 0;
+
+      auto it = this->addresses.lower_bound(low);
+      while (it != this->addresses.end() && *it < baseAddr + size) {
+        auto entry = this->entries.find(*it);
+        if (*it + entry->second.size > baseAddr) {
+          this->entries.erase(entry);
+          it = this->addresses.erase(it);
+        }
+        else
+          ++it;
+      }
+    }
+
+
+    void DecodeCache::clear(void) {
+      this->entries.clear();
+      this->addresses.clear();
+      this->hits   = 0;
+      this->misses = 0;
+    }
+
+  }; /* arch namespace */
+}; /* triton namespace */
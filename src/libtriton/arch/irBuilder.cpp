@@ -37,19 +37,19 @@ namespace triton {
         throw triton::exceptions::IrBuilder("IrBuilder::IrBuilder(): The taint engines API must be defined.");
 
       this->architecture              = architecture;
-      this->backupSymbolicEngine      = new(std::nothrow) triton::engines::symbolic::SymbolicEngine(architecture, modes, astCtxt, nullptr, true);
       this->symbolicEngine            = symbolicEngine;
       this->taintEngine               = taintEngine;
       this->x86Isa                    = new(std::nothrow) triton::arch::x86::x86Semantics(architecture, symbolicEngine, taintEngine, astCtxt);
+      this->x86ConcreteIsa            = new(std::nothrow) triton::arch::x86::x86ConcreteSemantics(architecture, symbolicEngine, taintEngine);
 
-      if (this->x86Isa == nullptr || this->backupSymbolicEngine == nullptr)
+      if (this->x86Isa == nullptr || this->x86ConcreteIsa == nullptr)
         throw triton::exceptions::IrBuilder("IrBuilder::IrBuilder(): Not enough memory.");
     }
 
 
     IrBuilder::~IrBuilder() {
-      delete this->backupSymbolicEngine;
       delete this->x86Isa;
+      delete this->x86ConcreteIsa;
     }
 
 
@@ -59,6 +59,36 @@ namespace triton {
       if (this->architecture->getArchitecture() == triton::arch::ARCH_INVALID)
         throw triton::exceptions::IrBuilder("IrBuilder::buildSemantics(): You must define an architecture.");
 
+      /* The taint labels read by the previous instruction must not spread to this one */
+      this->taintEngine->clearSpreadLabels();
+
+      /*
+       * If the symbolic engine is disabled, only the concrete state and the taint are
+       * updated. So, the supported instructions are directly interpreted with native
+       * integers, without building (and then removing) their symbolic expressions.
+       */
+      if (!this->symbolicEngine->isEnabled()) {
+        triton::arch::x86::x86ConcreteSemantics* interpreter = nullptr;
+
+        switch (this->architecture->getArchitecture()) {
+          case triton::arch::ARCH_X86:
+          case triton::arch::ARCH_X86_64:
+            interpreter = this->x86ConcreteIsa;
+            break;
+
+          default:
+            break;
+        }
+
+        if (interpreter) {
+          this->clearSemantics(inst);
+          if (interpreter->buildSemantics(inst)) {
+            this->collectNodes(inst.operands);
+            return true;
+          }
+        }
+      }
+
       /* Initialize the target address of memory operands */
       for (auto& operand : inst.operands) {
         if (operand.getType() == triton::arch::OP_MEM) {
@@ -89,6 +119,17 @@ namespace triton {
 
 
     void IrBuilder::preIrInit(triton::arch::Instruction& inst) {
+      /* Clear the previous semantics */
+      this->clearSemantics(inst);
+
+      /* Journal the symbolic engine in the case where only the taint is available. */
+      if (!this->symbolicEngine->isEnabled()) {
+        this->symbolicEngine->startJournal();
+      }
+    }
+
+
+    void IrBuilder::clearSemantics(triton::arch::Instruction& inst) {
       /* Clear previous expressions if exist */
       inst.symbolicExpressions.clear();
 
@@ -102,11 +143,6 @@ namespace triton {
       /* Update instruction address if undefined */
       if (!inst.getAddress())
         inst.setAddress(this->architecture->getConcreteRegisterValue(this->architecture->getParentRegister(ID_REG_IP)).convert_to<triton::uint64>());
-
-      /* Backup the symbolic engine in the case where only the taint is available. */
-      if (!this->symbolicEngine->isEnabled()) {
-        *this->backupSymbolicEngine = *this->symbolicEngine;
-      }
     }
 
 
@@ -143,8 +179,8 @@ namespace triton {
         /* Symbolic Expressions */
         this->removeSymbolicExpressions(inst);
 
-        /* Restore backup */
-        *this->symbolicEngine = *this->backupSymbolicEngine;
+        /* Roll back the symbolic state */
+        this->symbolicEngine->rollbackJournal();
       }
 
       // ----------------------------------------------------------------------
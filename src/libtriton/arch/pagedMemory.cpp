@@ -0,0 +1,174 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <bitset>
+#include <cstring>
+
+#include <triton/pagedMemory.hpp>
+
+
+
+namespace triton {
+  namespace arch {
+
+    /* Returns the mask of the bits of the word `index` covered by the range [begin:end[ */
+    static inline triton::uint64 wordMask(triton::usize index, triton::usize begin, triton::usize end) {
+      triton::usize low  = (begin > index * 64) ? begin - index * 64 : 0;
+      triton::usize high = (end < (index + 1) * 64) ? end - index * 64 : 64;
+      triton::uint64 mask = (high == 64) ? ~0ULL : ((1ULL << high) - 1);
+      return mask & ~((1ULL << low) - 1);
+    }
+
+
+    PagedMemory::Page::Page() {
+      std::memset(this->values, 0x00, sizeof(this->values));
+      std::memset(this->mapped, 0x00, sizeof(this->mapped));
+      this->count = 0;
+    }
+
+
+    void PagedMemory::clear(void) {
+      this->pages.clear();
+    }
+
+
+    triton::usize PagedMemory::getNumberOfPages(void) const {
+      return this->pages.size();
+    }
+
+
+    void PagedMemory::mapBytes(Page& page, triton::usize offset, triton::usize size) {
+      triton::usize end = offset + size;
+
+      for (triton::usize index = offset / 64; index <= (end - 1) / 64; index++) {
+        triton::uint64 mask = wordMask(index, offset, end);
+        page.count += std::bitset<64>(mask & ~page.mapped[index]).count();
+        page.mapped[index] |= mask;
+      }
+    }
+
+
+    void PagedMemory::unmapBytes(Page& page, triton::usize offset, triton::usize size) {
+      triton::usize end = offset + size;
+
+      for (triton::usize index = offset / 64; index <= (end - 1) / 64; index++) {
+        triton::uint64 mask = wordMask(index, offset, end);
+        page.count -= std::bitset<64>(mask & page.mapped[index]).count();
+        page.mapped[index] &= ~mask;
+      }
+
+      /* Unmapped bytes are read as 0 */
+      std::memset(page.values + offset, 0x00, size);
+    }
+
+
+    bool PagedMemory::isMapped(const Page& page, triton::usize offset, triton::usize size) const {
+      triton::usize end = offset + size;
+
+      if (page.count == PAGED_MEMORY_PAGE_SIZE)
+        return true;
+
+      for (triton::usize index = offset / 64; index <= (end - 1) / 64; index++) {
+        triton::uint64 mask = wordMask(index, offset, end);
+        if ((page.mapped[index] & mask) != mask)
+          return false;
+      }
+
+      return true;
+    }
+
+
+    triton::uint8 PagedMemory::read(triton::uint64 addr) const {
+      const Page* page = this->pages.find(addr);
+
+      if (page == nullptr)
+        return 0x00;
+
+      return page->values[addr & (PAGED_MEMORY_PAGE_SIZE - 1)];
+    }
+
+
+    void PagedMemory::read(triton::uint64 baseAddr, triton::uint8* area, triton::usize size) const {
+      while (size) {
+        triton::usize offset = baseAddr & (PAGED_MEMORY_PAGE_SIZE - 1);
+        triton::usize chunk  = std::min(size, PAGED_MEMORY_PAGE_SIZE - offset);
+        const Page* page     = this->pages.find(baseAddr);
+
+        if (page == nullptr)
+          std::memset(area, 0x00, chunk);
+        else
+          std::memcpy(area, page->values + offset, chunk);
+
+        area     += chunk;
+        baseAddr += chunk;
+        size     -= chunk;
+      }
+    }
+
+
+    void PagedMemory::write(triton::uint64 addr, triton::uint8 value) {
+      Page& page = this->pages.get(addr);
+      triton::usize offset = addr & (PAGED_MEMORY_PAGE_SIZE - 1);
+
+      page.values[offset] = value;
+      this->mapBytes(page, offset, 1);
+    }
+
+
+    void PagedMemory::write(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size) {
+      while (size) {
+        triton::usize offset = baseAddr & (PAGED_MEMORY_PAGE_SIZE - 1);
+        triton::usize chunk  = std::min(size, PAGED_MEMORY_PAGE_SIZE - offset);
+        Page& page           = this->pages.get(baseAddr);
+
+        std::memcpy(page.values + offset, area, chunk);
+        this->mapBytes(page, offset, chunk);
+
+        area     += chunk;
+        baseAddr += chunk;
+        size     -= chunk;
+      }
+    }
+
+
+    bool PagedMemory::isMapped(triton::uint64 baseAddr, triton::usize size) const {
+      while (size) {
+        triton::usize offset = baseAddr & (PAGED_MEMORY_PAGE_SIZE - 1);
+        triton::usize chunk  = std::min(size, PAGED_MEMORY_PAGE_SIZE - offset);
+        const Page* page     = this->pages.find(baseAddr);
+
+        if (page == nullptr || !this->isMapped(*page, offset, chunk))
+          return false;
+
+        baseAddr += chunk;
+        size     -= chunk;
+      }
+      return true;
+    }
+
+
+    void PagedMemory::unmap(triton::uint64 baseAddr, triton::usize size) {
+      while (size) {
+        triton::usize offset = baseAddr & (PAGED_MEMORY_PAGE_SIZE - 1);
+        triton::usize chunk  = std::min(size, PAGED_MEMORY_PAGE_SIZE - offset);
+        Page* page           = this->pages.find(baseAddr);
+
+        if (page != nullptr) {
+          this->unmapBytes(*page, offset, chunk);
+          /* Release the page if there is no more mapped byte */
+          if (page->count == 0)
+            this->pages.erase(baseAddr);
+        }
+
+        baseAddr += chunk;
+        size     -= chunk;
+      }
+    }
+
+  }; /* arch namespace */
+}; /* triton namespace */
@@ -0,0 +1,922 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <triton/cpuSize.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/x86ConcreteSemantics.hpp>
+#include <triton/x86Specifications.hpp>
+
+
+
+namespace triton {
+  namespace arch {
+    namespace x86 {
+
+      /* Returns the mask of a bit-vector of bitSize bits */
+      static inline triton::uint64 mask(triton::uint32 bitSize) {
+        return (bitSize >= QWORD_SIZE_BIT) ? static_cast<triton::uint64>(-1) : ((static_cast<triton::uint64>(1) << bitSize) - 1);
+      }
+
+
+      /* Returns the most significant bit of a bit-vector of bitSize bits */
+      static inline bool msb(triton::uint64 value, triton::uint32 bitSize) {
+        return ((value >> (bitSize - 1)) & 1) != 0;
+      }
+
+
+      /* Sign extends a bit-vector of bitSize bits to size bits */
+      static inline triton::uint64 sx(triton::uint64 value, triton::uint32 bitSize, triton::uint32 size) {
+        if (bitSize < QWORD_SIZE_BIT && msb(value, bitSize))
+          value |= ~mask(bitSize);
+        return value & mask(size);
+      }
+
+
+      /* Logical shift right of a bit-vector (SMT semantics: shifting by its size or more gives zero) */
+      static inline triton::uint64 lshr(triton::uint64 value, triton::uint64 shift) {
+        return (shift >= QWORD_SIZE_BIT) ? 0 : (value >> shift);
+      }
+
+
+      x86ConcreteSemantics::x86ConcreteSemantics(triton::arch::Architecture* architecture,
+                                                 triton::engines::symbolic::SymbolicEngine* symbolicEngine,
+                                                 triton::engines::taint::TaintEngine* taintEngine) {
+
+        this->architecture    = architecture;
+        this->symbolicEngine  = symbolicEngine;
+        this->taintEngine     = taintEngine;
+        this->tainted         = false;
+
+        if (architecture == nullptr)
+          throw triton::exceptions::Semantics("x86ConcreteSemantics::x86ConcreteSemantics(): The architecture API must be defined.");
+
+        if (this->symbolicEngine == nullptr)
+          throw triton::exceptions::Semantics("x86ConcreteSemantics::x86ConcreteSemantics(): The symbolic engine API must be defined.");
+
+        if (this->taintEngine == nullptr)
+          throw triton::exceptions::Semantics("x86ConcreteSemantics::x86ConcreteSemantics(): The taint engines API must be defined.");
+      }
+
+
+      bool x86ConcreteSemantics::isSupported(const triton::arch::OperandWrapper& op) const {
+        switch (op.getType()) {
+          case triton::arch::OP_IMM:
+            return true;
+
+          case triton::arch::OP_MEM:
+            return op.getSize() && op.getSize() <= QWORD_SIZE;
+
+          case triton::arch::OP_REG: {
+            const triton::arch::Register& reg = op.getConstRegister();
+            /* Segment registers are handled as special cases by the x86Semantics class */
+            if (reg.getId() >= triton::arch::ID_REG_CS && reg.getId() <= triton::arch::ID_REG_SS)
+              return false;
+            return this->architecture->isRegisterValid(reg) && reg.getSize() && reg.getSize() <= QWORD_SIZE;
+          }
+
+          default:
+            return false;
+        }
+      }
+
+
+      bool x86ConcreteSemantics::isSupported(const triton::arch::Instruction& inst) const {
+        const auto& operands = inst.operands;
+        triton::uint32 pcSize = this->architecture->getParentRegister(ID_REG_IP).getSize();
+
+        /* The repeated instructions update the counter */
+        switch (inst.getPrefix()) {
+          case ID_PREFIX_REP:
+          case ID_PREFIX_REPE:
+          case ID_PREFIX_REPNE:
+            return false;
+          default:
+            break;
+        }
+
+        for (const auto& op : operands) {
+          if (!this->isSupported(op))
+            return false;
+        }
+
+        switch (inst.getType()) {
+          case ID_INS_ADD:
+          case ID_INS_AND:
+          case ID_INS_CMOVA:
+          case ID_INS_CMOVAE:
+          case ID_INS_CMOVB:
+          case ID_INS_CMOVBE:
+          case ID_INS_CMOVE:
+          case ID_INS_CMOVG:
+          case ID_INS_CMOVGE:
+          case ID_INS_CMOVL:
+          case ID_INS_CMOVLE:
+          case ID_INS_CMOVNE:
+          case ID_INS_CMOVNO:
+          case ID_INS_CMOVNP:
+          case ID_INS_CMOVNS:
+          case ID_INS_CMOVO:
+          case ID_INS_CMOVP:
+          case ID_INS_CMOVS:
+          case ID_INS_MOV:
+          case ID_INS_MOVABS:
+          case ID_INS_OR:
+          case ID_INS_SUB:
+          case ID_INS_TEST:
+          case ID_INS_XOR:
+            return operands.size() == 2 && operands[0].getSize() == operands[1].getSize();
+
+          case ID_INS_CMP:
+          case ID_INS_SAL:
+          case ID_INS_SAR:
+          case ID_INS_SHL:
+          case ID_INS_SHR:
+            return operands.size() == 2 && operands[0].getSize() >= operands[1].getSize();
+
+          case ID_INS_MOVSX:
+          case ID_INS_MOVSXD:
+          case ID_INS_MOVZX:
+            return operands.size() == 2 && operands[0].getType() == triton::arch::OP_REG && operands[0].getSize() >= operands[1].getSize();
+
+          case ID_INS_LEA:
+            return operands.size() == 2 && operands[0].getType() == triton::arch::OP_REG && operands[1].getType() == triton::arch::OP_MEM;
+
+          case ID_INS_DEC:
+          case ID_INS_INC:
+          case ID_INS_NEG:
+          case ID_INS_NOT:
+          case ID_INS_POP:
+          case ID_INS_PUSH:
+          case ID_INS_SETA:
+          case ID_INS_SETAE:
+          case ID_INS_SETB:
+          case ID_INS_SETBE:
+          case ID_INS_SETE:
+          case ID_INS_SETG:
+          case ID_INS_SETGE:
+          case ID_INS_SETL:
+          case ID_INS_SETLE:
+          case ID_INS_SETNE:
+          case ID_INS_SETNO:
+          case ID_INS_SETNP:
+          case ID_INS_SETNS:
+          case ID_INS_SETO:
+          case ID_INS_SETP:
+          case ID_INS_SETS:
+            return operands.size() == 1;
+
+          case ID_INS_CALL:
+          case ID_INS_JMP:
+            return operands.size() == 1 && operands[0].getSize() == pcSize;
+
+          case ID_INS_JA:
+          case ID_INS_JAE:
+          case ID_INS_JB:
+          case ID_INS_JBE:
+          case ID_INS_JE:
+          case ID_INS_JG:
+          case ID_INS_JGE:
+          case ID_INS_JL:
+          case ID_INS_JLE:
+          case ID_INS_JNE:
+          case ID_INS_JNO:
+          case ID_INS_JNP:
+          case ID_INS_JNS:
+          case ID_INS_JO:
+          case ID_INS_JP:
+          case ID_INS_JS:
+            return operands.size() == 1 && operands[0].getType() == triton::arch::OP_IMM && operands[0].getSize() == pcSize;
+
+          case ID_INS_RET:
+            return operands.size() == 0 || (operands.size() == 1 && operands[0].getType() == triton::arch::OP_IMM);
+
+          case ID_INS_LEAVE:
+          case ID_INS_NOP:
+            return true;
+
+          default:
+            return false;
+        }
+      }
+
+
+      bool x86ConcreteSemantics::buildSemantics(triton::arch::Instruction& inst) {
+        if (!this->isSupported(inst))
+          return false;
+
+        this->tainted = false;
+
+        /* Initialize the target address of memory operands */
+        for (auto& operand : inst.operands) {
+          if (operand.getType() == triton::arch::OP_MEM)
+            this->symbolicEngine->initLeaAst(operand.getMemory());
+        }
+
+        switch (inst.getType()) {
+          case ID_INS_ADD:
+          case ID_INS_AND:
+          case ID_INS_CMP:
+          case ID_INS_OR:
+          case ID_INS_SUB:
+          case ID_INS_TEST:
+          case ID_INS_XOR:
+            this->binary(inst);
+            break;
+
+          case ID_INS_DEC:
+          case ID_INS_INC:
+          case ID_INS_NEG:
+          case ID_INS_NOT:
+            this->unary(inst);
+            break;
+
+          case ID_INS_MOV:
+          case ID_INS_MOVABS:
+          case ID_INS_MOVSX:
+          case ID_INS_MOVSXD:
+          case ID_INS_MOVZX:
+            this->mov(inst);
+            break;
+
+          case ID_INS_SAL:
+          case ID_INS_SAR:
+          case ID_INS_SHL:
+          case ID_INS_SHR:
+            this->shift(inst);
+            break;
+
+          case ID_INS_CMOVA:
+          case ID_INS_CMOVAE:
+          case ID_INS_CMOVB:
+          case ID_INS_CMOVBE:
+          case ID_INS_CMOVE:
+          case ID_INS_CMOVG:
+          case ID_INS_CMOVGE:
+          case ID_INS_CMOVL:
+          case ID_INS_CMOVLE:
+          case ID_INS_CMOVNE:
+          case ID_INS_CMOVNO:
+          case ID_INS_CMOVNP:
+          case ID_INS_CMOVNS:
+          case ID_INS_CMOVO:
+          case ID_INS_CMOVP:
+          case ID_INS_CMOVS:
+            this->cmovcc(inst);
+            break;
+
+          case ID_INS_SETA:
+          case ID_INS_SETAE:
+          case ID_INS_SETB:
+          case ID_INS_SETBE:
+          case ID_INS_SETE:
+          case ID_INS_SETG:
+          case ID_INS_SETGE:
+          case ID_INS_SETL:
+          case ID_INS_SETLE:
+          case ID_INS_SETNE:
+          case ID_INS_SETNO:
+          case ID_INS_SETNP:
+          case ID_INS_SETNS:
+          case ID_INS_SETO:
+          case ID_INS_SETP:
+          case ID_INS_SETS:
+            this->setcc(inst);
+            break;
+
+          case ID_INS_JA:
+          case ID_INS_JAE:
+          case ID_INS_JB:
+          case ID_INS_JBE:
+          case ID_INS_JE:
+          case ID_INS_JG:
+          case ID_INS_JGE:
+          case ID_INS_JL:
+          case ID_INS_JLE:
+          case ID_INS_JNE:
+          case ID_INS_JNO:
+          case ID_INS_JNP:
+          case ID_INS_JNS:
+          case ID_INS_JO:
+          case ID_INS_JP:
+          case ID_INS_JS:
+            this->jcc(inst);
+            break;
+
+          case ID_INS_CALL:   this->call(inst);         break;
+          case ID_INS_JMP:    this->jmp(inst);          break;
+          case ID_INS_LEA:    this->lea(inst);          break;
+          case ID_INS_LEAVE:  this->leave(inst);        break;
+          case ID_INS_NOP:    this->controlFlow(inst);  break;
+          case ID_INS_POP:    this->pop(inst);          break;
+          case ID_INS_PUSH:   this->push(inst);         break;
+          case ID_INS_RET:    this->ret(inst);          break;
+
+          default:
+            return false;
+        }
+
+        /* Set the taint of the instruction */
+        inst.setTaint(this->tainted);
+
+        return true;
+      }
+
+
+      triton::uint64 x86ConcreteSemantics::read(const triton::arch::OperandWrapper& op) {
+        switch (op.getType()) {
+          case triton::arch::OP_IMM: return op.getConstImmediate().getValue() & mask(op.getBitSize());
+          case triton::arch::OP_MEM: return this->architecture->getConcreteMemoryValue(op.getConstMemory()).convert_to<triton::uint64>();
+          case triton::arch::OP_REG: return this->architecture->getConcreteRegisterValue(op.getConstRegister()).convert_to<triton::uint64>();
+          default:
+            throw triton::exceptions::Semantics("x86ConcreteSemantics::read(): Invalid operand.");
+        }
+      }
+
+
+      bool x86ConcreteSemantics::readFlag(triton::arch::registers_e flag) {
+        return !this->architecture->getConcreteRegisterValue(this->architecture->getRegister(flag)).is_zero();
+      }
+
+
+      void x86ConcreteSemantics::write(const triton::arch::OperandWrapper& op, triton::uint64 value) {
+        value &= mask(op.getBitSize());
+
+        switch (op.getType()) {
+          case triton::arch::OP_MEM:
+            this->architecture->setConcreteMemoryValue(op.getConstMemory(), value);
+            break;
+
+          case triton::arch::OP_REG: {
+            const triton::arch::Register& reg    = op.getConstRegister();
+            const triton::arch::Register& parent = this->architecture->getParentRegister(reg);
+
+            /* Like SymbolicEngine::createSymbolicRegisterExpression(), 8 and 16-bit registers are merged into their parent, others are zero extended */
+            if (reg.getSize() == BYTE_SIZE || reg.getSize() == WORD_SIZE) {
+              triton::uint64 origin = this->read(parent);
+              value = (origin & ~(mask(reg.getBitSize()) << reg.getLow())) | (value << reg.getLow());
+            }
+
+            this->architecture->setConcreteRegisterValue(parent, value);
+            break;
+          }
+
+          default:
+            throw triton::exceptions::Semantics("x86ConcreteSemantics::write(): Invalid operand.");
+        }
+      }
+
+
+      void x86ConcreteSemantics::writeFlag(triton::arch::registers_e flag, bool value, bool taint) {
+        const triton::arch::Register& reg = this->architecture->getRegister(flag);
+
+        this->architecture->setConcreteRegisterValue(reg, value ? 1 : 0);
+        this->tainted |= this->taintEngine->setTaintRegister(reg, taint);
+      }
+
+
+      void x86ConcreteSemantics::writePc(triton::uint64 value) {
+        const triton::arch::Register& pc = this->architecture->getParentRegister(ID_REG_IP);
+        this->architecture->setConcreteRegisterValue(pc, value & mask(pc.getBitSize()));
+      }
+
+
+      bool x86ConcreteSemantics::condition(triton::uint32 type, std::vector<triton::arch::registers_e>& flags) {
+        switch (type) {
+          case ID_INS_JA:
+          case ID_INS_SETA:
+          case ID_INS_CMOVA:
+            flags = {ID_REG_CF, ID_REG_ZF};
+            return !this->readFlag(ID_REG_CF) && !this->readFlag(ID_REG_ZF);
+
+          case ID_INS_JAE:
+          case ID_INS_SETAE:
+          case ID_INS_CMOVAE:
+            flags = {ID_REG_CF};
+            return !this->readFlag(ID_REG_CF);
+
+          case ID_INS_JB:
+          case ID_INS_SETB:
+          case ID_INS_CMOVB:
+            flags = {ID_REG_CF};
+            return this->readFlag(ID_REG_CF);
+
+          case ID_INS_JBE:
+          case ID_INS_SETBE:
+          case ID_INS_CMOVBE:
+            flags = {ID_REG_CF, ID_REG_ZF};
+            return this->readFlag(ID_REG_CF) || this->readFlag(ID_REG_ZF);
+
+          case ID_INS_JE:
+          case ID_INS_SETE:
+          case ID_INS_CMOVE:
+            flags = {ID_REG_ZF};
+            return this->readFlag(ID_REG_ZF);
+
+          case ID_INS_JG:
+          case ID_INS_SETG:
+          case ID_INS_CMOVG:
+            flags = {ID_REG_SF, ID_REG_OF, ID_REG_ZF};
+            return (this->readFlag(ID_REG_SF) == this->readFlag(ID_REG_OF)) && !this->readFlag(ID_REG_ZF);
+
+          case ID_INS_JGE:
+          case ID_INS_SETGE:
+          case ID_INS_CMOVGE:
+            flags = {ID_REG_SF, ID_REG_OF};
+            return this->readFlag(ID_REG_SF) == this->readFlag(ID_REG_OF);
+
+          case ID_INS_JL:
+          case ID_INS_SETL:
+          case ID_INS_CMOVL:
+            flags = {ID_REG_SF, ID_REG_OF};
+            return this->readFlag(ID_REG_SF) != this->readFlag(ID_REG_OF);
+
+          case ID_INS_JLE:
+          case ID_INS_SETLE:
+          case ID_INS_CMOVLE:
+            flags = {ID_REG_SF, ID_REG_OF, ID_REG_ZF};
+            return (this->readFlag(ID_REG_SF) != this->readFlag(ID_REG_OF)) || this->readFlag(ID_REG_ZF);
+
+          case ID_INS_JNE:
+          case ID_INS_SETNE:
+          case ID_INS_CMOVNE:
+            flags = {ID_REG_ZF};
+            return !this->readFlag(ID_REG_ZF);
+
+          case ID_INS_JNO:
+          case ID_INS_SETNO:
+          case ID_INS_CMOVNO:
+            flags = {ID_REG_OF};
+            return !this->readFlag(ID_REG_OF);
+
+          case ID_INS_JNP:
+          case ID_INS_SETNP:
+          case ID_INS_CMOVNP:
+            flags = {ID_REG_PF};
+            return !this->readFlag(ID_REG_PF);
+
+          case ID_INS_JNS:
+          case ID_INS_SETNS:
+          case ID_INS_CMOVNS:
+            flags = {ID_REG_SF};
+            return !this->readFlag(ID_REG_SF);
+
+          case ID_INS_JO:
+          case ID_INS_SETO:
+          case ID_INS_CMOVO:
+            flags = {ID_REG_OF};
+            return this->readFlag(ID_REG_OF);
+
+          case ID_INS_JP:
+          case ID_INS_SETP:
+          case ID_INS_CMOVP:
+            flags = {ID_REG_PF};
+            return this->readFlag(ID_REG_PF);
+
+          case ID_INS_JS:
+          case ID_INS_SETS:
+          case ID_INS_CMOVS:
+            flags = {ID_REG_SF};
+            return this->readFlag(ID_REG_SF);
+
+          default:
+            throw triton::exceptions::Semantics("x86ConcreteSemantics::condition(): Invalid instruction.");
+        }
+      }
+
+
+      triton::uint64 x86ConcreteSemantics::alignAddStack(triton::uint32 delta) {
+        auto dst = triton::arch::OperandWrapper(this->architecture->getParentRegister(ID_REG_SP));
+        auto value = (this->read(dst) + delta) & mask(dst.getBitSize());
+
+        this->write(dst, value);
+        this->tainted |= this->taintEngine->taintUnion(dst, dst);
+
+        return value;
+      }
+
+
+      triton::uint64 x86ConcreteSemantics::alignSubStack(triton::uint32 delta) {
+        auto dst = triton::arch::OperandWrapper(this->architecture->getParentRegister(ID_REG_SP));
+        auto value = (this->read(dst) - delta) & mask(dst.getBitSize());
+
+        this->write(dst, value);
+        this->tainted |= this->taintEngine->taintUnion(dst, dst);
+
+        return value;
+      }
+
+
+      void x86ConcreteSemantics::controlFlow(triton::arch::Instruction& inst) {
+        this->writePc(inst.getNextAddress());
+        this->tainted |= this->taintEngine->setTaintRegister(this->architecture->getParentRegister(ID_REG_IP), triton::engines::taint::UNTAINTED);
+      }
+
+
+      void x86ConcreteSemantics::resultFlags(triton::uint64 result, triton::uint32 bitSize, bool taint) {
+        /* pf is set to one if there is an even number of bit set to 1 in the least significant byte of the result */
+        triton::uint64 parity = result & 0xff;
+        parity ^= (parity >> 4);
+        parity ^= (parity >> 2);
+        parity ^= (parity >> 1);
+
+        this->writeFlag(ID_REG_PF, (parity & 1) == 0, taint);
+        this->writeFlag(ID_REG_SF, msb(result, bitSize), taint);
+        this->writeFlag(ID_REG_ZF, result == 0, taint);
+      }
+
+
+      void x86ConcreteSemantics::binary(triton::arch::Instruction& inst) {
+        auto& dst           = inst.operands[0];
+        auto& src           = inst.operands[1];
+        triton::uint32 type = inst.getType();
+        triton::uint32 size = dst.getBitSize();
+        triton::uint64 op1  = this->read(dst);
+        triton::uint64 op2  = this->read(src);
+        triton::uint64 res  = 0;
+        bool taint          = false;
+
+        if (type == ID_INS_CMP)
+          op2 = sx(op2, src.getBitSize(), size);
+
+        switch (type) {
+          case ID_INS_ADD:  res = op1 + op2; break;
+          case ID_INS_AND:  res = op1 & op2; break;
+          case ID_INS_CMP:  res = op1 - op2; break;
+          case ID_INS_OR:   res = op1 | op2; break;
+          case ID_INS_SUB:  res = op1 - op2; break;
+          case ID_INS_TEST: res = op1 & op2; break;
+          case ID_INS_XOR:  res = op1 ^ op2; break;
+        }
+        res &= mask(size);
+
+        /* CMP and TEST only update the flags */
+        if (type == ID_INS_CMP || type == ID_INS_TEST) {
+          taint = this->taintEngine->readTaint(dst) | this->taintEngine->readTaint(src);
+        }
+        else {
+          this->write(dst, res);
+          taint = this->taintEngine->taintUnion(dst, src);
+        }
+        this->tainted |= taint;
+
+        switch (type) {
+          case ID_INS_ADD:
+            this->writeFlag(ID_REG_AF, ((res ^ op1 ^ op2) & 0x10) != 0, taint);
+            this->writeFlag(ID_REG_CF, msb((op1 & op2) ^ ((op1 ^ op2 ^ res) & (op1 ^ op2)), size), taint);
+            this->writeFlag(ID_REG_OF, msb((op1 ^ ~op2) & (op1 ^ res), size), taint);
+            break;
+
+          case ID_INS_CMP:
+          case ID_INS_SUB:
+            this->writeFlag(ID_REG_AF, ((res ^ op1 ^ op2) & 0x10) != 0, taint);
+            this->writeFlag(ID_REG_CF, msb((op1 ^ op2 ^ res) ^ ((op1 ^ res) & (op1 ^ op2)), size), taint);
+            this->writeFlag(ID_REG_OF, msb((op1 ^ op2) & (op1 ^ res), size), taint);
+            break;
+
+          default:
+            this->writeFlag(ID_REG_CF, false, triton::engines::taint::UNTAINTED);
+            this->writeFlag(ID_REG_OF, false, triton::engines::taint::UNTAINTED);
+            break;
+        }
+
+        this->resultFlags(res, size, taint);
+        this->controlFlow(inst);
+      }
+
+
+      void x86ConcreteSemantics::cmovcc(triton::arch::Instruction& inst) {
+        auto& dst = inst.operands[0];
+        auto& src = inst.operands[1];
+        std::vector<triton::arch::registers_e> flags;
+
+        triton::uint64 op1 = this->read(dst);
+        triton::uint64 op2 = this->read(src);
+        bool taken         = this->condition(inst.getType(), flags);
+
+        /* The destination is always written (a 32-bit register is zero extended) */
+        this->write(dst, taken ? op2 : op1);
+
+        if (taken) {
+          this->tainted |= this->taintEngine->taintAssignment(dst, src);
+          inst.setConditionTaken(true);
+        }
+        else
+          this->tainted |= this->taintEngine->taintUnion(dst, dst);
+
+        this->controlFlow(inst);
+      }
+
+
+      void x86ConcreteSemantics::call(triton::arch::Instruction& inst) {
+        auto  stack      = this->architecture->getParentRegister(ID_REG_SP);
+        auto  stackValue = this->alignSubStack(stack.getSize());
+        auto  pc         = triton::arch::OperandWrapper(this->architecture->getParentRegister(ID_REG_IP));
+        auto  sp         = triton::arch::OperandWrapper(triton::arch::MemoryAccess(stackValue, stack.getSize()));
+        auto& src        = inst.operands[0];
+
+        triton::uint64 target = this->read(src);
+
+        this->write(sp, inst.getNextAddress());
+        this->writePc(target);
+
+        this->tainted |= this->taintEngine->taintAssignmentMemoryImmediate(sp.getMemory());
+        this->tainted |= this->taintEngine->taintAssignment(pc, src);
+      }
+
+
+      void x86ConcreteSemantics::jcc(triton::arch::Instruction& inst) {
+        auto pc = triton::arch::OperandWrapper(this->architecture->getParentRegister(ID_REG_IP));
+        std::vector<triton::arch::registers_e> flags;
+
+        bool taken = this->condition(inst.getType(), flags);
+
+        this->writePc(taken ? this->read(inst.operands[0]) : inst.getNextAddress());
+
+        if (taken)
+          inst.setConditionTaken(true);
+
+        this->tainted |= this->taintEngine->taintAssignment(pc, this->architecture->getRegister(flags[0]));
+        for (triton::usize i = 1; i < flags.size(); i++)
+          this->tainted |= this->taintEngine->taintUnion(pc, this->architecture->getRegister(flags[i]));
+      }
+
+
+      void x86ConcreteSemantics::jmp(triton::arch::Instruction& inst) {
+        auto  pc  = triton::arch::OperandWrapper(this->architecture->getParentRegister(ID_REG_IP));
+        auto& src = inst.operands[0];
+
+        this->writePc(this->read(src));
+        inst.setConditionTaken(true);
+
+        this->tainted |= this->taintEngine->taintAssignment(pc, src);
+      }
+
+
+      void x86ConcreteSemantics::lea(triton::arch::Instruction& inst) {
+        auto& dst                = inst.operands[0].getRegister();
+        auto& srcDisp            = inst.operands[1].getMemory().getDisplacement();
+        auto& srcBase            = inst.operands[1].getMemory().getBaseRegister();
+        auto& srcIndex           = inst.operands[1].getMemory().getIndexRegister();
+        auto& srcScale           = inst.operands[1].getMemory().getScale();
+        triton::uint32 leaSize   = 0;
+
+        /* Setup LEA size */
+        if (this->architecture->isRegisterValid(srcBase))
+          leaSize = srcBase.getBitSize();
+        else if (this->architecture->isRegisterValid(srcIndex))
+          leaSize = srcIndex.getBitSize();
+        else
+          leaSize = srcDisp.getBitSize();
+
+        /* Effective address = Displacement + BaseReg + IndexReg * Scale */
+        triton::uint64 address = srcDisp.getValue() & mask(srcDisp.getBitSize());
+
+        if (this->architecture->isRegisterValid(srcBase)) {
+          address += this->read(srcBase);
+          /* Base with PC */
+          if (this->architecture->getParentRegister(srcBase) == this->architecture->getParentRegister(ID_REG_IP))
+            address += inst.getSize();
+        }
+
+        if (this->architecture->isRegisterValid(srcIndex))
+          address += this->read(srcIndex) * (srcScale.getValue() & mask(srcScale.getBitSize()));
+
+        this->write(dst, address & mask(leaSize));
+        this->tainted |= this->taintEngine->setTaint(dst, this->taintEngine->isTainted(srcBase) | this->taintEngine->isTainted(srcIndex), this->taintEngine->getTaintLabels(srcBase) | this->taintEngine->getTaintLabels(srcIndex));
+
+        this->controlFlow(inst);
+      }
+
+
+      void x86ConcreteSemantics::leave(triton::arch::Instruction& inst) {
+        auto stack     = this->architecture->getParentRegister(ID_REG_SP);
+        auto base      = this->architecture->getParentRegister(ID_REG_BP);
+        auto baseValue = this->read(base);
+        auto bp1       = triton::arch::OperandWrapper(triton::arch::MemoryAccess(baseValue, base.getSize()));
+        auto bp2       = triton::arch::OperandWrapper(base);
+        auto sp        = triton::arch::OperandWrapper(stack);
+
+        /* RSP = RBP */
+        this->write(sp, this->read(bp2));
+        this->tainted |= this->taintEngine->taintAssignment(sp, bp2);
+
+        /* RBP = pop() */
+        this->write(bp2, this->read(bp1));
+        this->tainted |= this->taintEngine->taintAssignment(bp2, bp1);
+
+        this->alignAddStack(bp1.getSize());
+        this->controlFlow(inst);
+      }
+
+
+      void x86ConcreteSemantics::mov(triton::arch::Instruction& inst) {
+        auto& dst            = inst.operands[0];
+        auto& src            = inst.operands[1];
+        triton::uint64 value = this->read(src);
+
+        if (inst.getType() == ID_INS_MOVSX || inst.getType() == ID_INS_MOVSXD)
+          value = sx(value, src.getBitSize(), dst.getBitSize());
+
+        this->write(dst, value);
+        this->tainted |= this->taintEngine->taintAssignment(dst, src);
+
+        this->controlFlow(inst);
+      }
+
+
+      void x86ConcreteSemantics::pop(triton::arch::Instruction& inst) {
+        bool  stackRelative = false;
+        auto  stack         = this->architecture->getParentRegister(ID_REG_SP);
+        auto  stackValue    = this->read(stack);
+        auto& dst           = inst.operands[0];
+        auto  src           = triton::arch::OperandWrapper(triton::arch::MemoryAccess(stackValue, dst.getSize()));
+
+        triton::uint64 value = this->read(src);
+
+        /*
+         * Intel: If the ESP register is used as a base register for addressing a destination operand in
+         * memory, the POP instruction computes the effective address of the operand after it increments
+         * the ESP register.
+         */
+        if (dst.getType() == triton::arch::OP_MEM) {
+          if (this->architecture->getParentRegister(dst.getMemory().getBaseRegister()) == stack) {
+            this->alignAddStack(src.getSize());
+            this->symbolicEngine->initLeaAst(dst.getMemory(), triton::arch::FORCE_MEMORY_INITIALIZATION);
+            stackRelative = true;
+          }
+        }
+
+        this->write(dst, value);
+        this->tainted |= this->taintEngine->taintAssignment(dst, src);
+
+        if (!stackRelative)
+          this->alignAddStack(src.getSize());
+
+        this->controlFlow(inst);
+      }
+
+
+      void x86ConcreteSemantics::push(triton::arch::Instruction& inst) {
+        auto& src           = inst.operands[0];
+        auto stack          = this->architecture->getParentRegister(ID_REG_SP);
+        triton::uint32 size = stack.getSize();
+
+        /* If it's an immediate source, the memory access is always based on the arch size */
+        if (src.getType() != triton::arch::OP_IMM)
+          size = src.getSize();
+
+        auto stackValue = this->alignSubStack(size);
+        auto dst        = triton::arch::OperandWrapper(triton::arch::MemoryAccess(stackValue, size));
+
+        this->write(dst, this->read(src));
+        this->tainted |= this->taintEngine->taintAssignment(dst, src);
+
+        this->controlFlow(inst);
+      }
+
+
+      void x86ConcreteSemantics::ret(triton::arch::Instruction& inst) {
+        auto stack      = this->architecture->getParentRegister(ID_REG_SP);
+        auto stackValue = this->read(stack);
+        auto pc         = triton::arch::OperandWrapper(this->architecture->getParentRegister(ID_REG_IP));
+        auto sp         = triton::arch::OperandWrapper(triton::arch::MemoryAccess(stackValue, stack.getSize()));
+
+        this->writePc(this->read(sp));
+        this->tainted |= this->taintEngine->taintAssignment(pc, sp);
+
+        this->alignAddStack(sp.getSize());
+
+        if (inst.operands.size() > 0)
+          this->alignAddStack(static_cast<triton::uint32>(inst.operands[0].getImmediate().getValue()));
+      }
+
+
+      void x86ConcreteSemantics::setcc(triton::arch::Instruction& inst) {
+        auto& dst = inst.operands[0];
+        std::vector<triton::arch::registers_e> flags;
+
+        bool taken = this->condition(inst.getType(), flags);
+
+        this->write(dst, taken ? 1 : 0);
+
+        if (taken) {
+          for (const auto& flag : flags)
+            this->tainted |= this->taintEngine->taintUnion(dst, this->architecture->getRegister(flag));
+          inst.setConditionTaken(true);
+        }
+        else
+          this->tainted |= this->taintEngine->taintUnion(dst, dst);
+
+        this->controlFlow(inst);
+      }
+
+
+      void x86ConcreteSemantics::shift(triton::arch::Instruction& inst) {
+        auto& dst            = inst.operands[0];
+        auto& src            = inst.operands[1];
+        triton::uint32 type  = inst.getType();
+        triton::uint32 size  = dst.getBitSize();
+        triton::uint64 op1   = this->read(dst);
+        triton::uint64 count = this->read(src) & ((size == QWORD_SIZE_BIT) ? (QWORD_SIZE_BIT - 1) : (DWORD_SIZE_BIT - 1));
+        triton::uint64 res   = 0;
+        bool cf              = this->readFlag(ID_REG_CF);
+        bool of              = this->readFlag(ID_REG_OF);
+
+        switch (type) {
+          case ID_INS_SAL:
+          case ID_INS_SHL:
+            res = (count >= size) ? 0 : (op1 << count);
+            if (count)
+              cf = (lshr(op1, (size - count) & mask(size)) & 1) != 0;
+            if (count == 1)
+              of = msb(op1, size) != ((lshr(op1, size - 2) & 1) != 0);
+            break;
+
+          case ID_INS_SHR:
+            res = lshr(op1, count);
+            if (count)
+              cf = (lshr(op1, count - 1) & 1) != 0;
+            if (count == 1)
+              of = msb(op1, size);
+            break;
+
+          case ID_INS_SAR:
+            res = (count >= size) ? (msb(op1, size) ? mask(size) : 0) : sx(op1 >> count, size - static_cast<triton::uint32>(count), size);
+            if (count)
+              cf = (count > size) ? msb(op1, size) : ((lshr(op1, count - 1) & 1) != 0);
+            if (count == 1)
+              of = false;
+            break;
+        }
+        res &= mask(size);
+
+        this->write(dst, res);
+        bool taint = this->taintEngine->taintUnion(dst, src);
+        this->tainted |= taint;
+
+        /* The flags are not affected if the count is zero */
+        this->writeFlag(ID_REG_CF, cf, taint);
+        this->writeFlag(ID_REG_OF, of, taint);
+        if (count) {
+          this->resultFlags(res, size, taint);
+        }
+        else {
+          this->writeFlag(ID_REG_PF, this->readFlag(ID_REG_PF), taint);
+          this->writeFlag(ID_REG_SF, this->readFlag(ID_REG_SF), taint);
+          this->writeFlag(ID_REG_ZF, this->readFlag(ID_REG_ZF), taint);
+        }
+
+        this->controlFlow(inst);
+      }
+
+
+      void x86ConcreteSemantics::unary(triton::arch::Instruction& inst) {
+        auto& dst           = inst.operands[0];
+        triton::uint32 type = inst.getType();
+        triton::uint32 size = dst.getBitSize();
+        triton::uint64 op1  = this->read(dst);
+        triton::uint64 res  = 0;
+
+        switch (type) {
+          case ID_INS_DEC: res = op1 - 1; break;
+          case ID_INS_INC: res = op1 + 1; break;
+          case ID_INS_NEG: res = 0 - op1; break;
+          case ID_INS_NOT: res = ~op1;    break;
+        }
+        res &= mask(size);
+
+        this->write(dst, res);
+        bool taint = this->taintEngine->taintUnion(dst, dst);
+        this->tainted |= taint;
+
+        switch (type) {
+          case ID_INS_DEC:
+            this->writeFlag(ID_REG_AF, ((res ^ op1 ^ 1) & 0x10) != 0, taint);
+            this->writeFlag(ID_REG_OF, msb((op1 ^ 1) & (op1 ^ res), size), taint);
+            this->resultFlags(res, size, taint);
+            break;
+
+          case ID_INS_INC:
+            this->writeFlag(ID_REG_AF, ((res ^ op1 ^ 1) & 0x10) != 0, taint);
+            this->writeFlag(ID_REG_OF, msb((op1 ^ ~static_cast<triton::uint64>(1)) & (op1 ^ res), size), taint);
+            this->resultFlags(res, size, taint);
+            break;
+
+          case ID_INS_NEG:
+            this->writeFlag(ID_REG_AF, ((res ^ op1) & 0x10) != 0, taint);
+            this->writeFlag(ID_REG_CF, op1 != 0, taint);
+            this->writeFlag(ID_REG_OF, msb(res & op1, size), taint);
+            this->resultFlags(res, size, taint);
+            break;
+        }
+
+        this->controlFlow(inst);
+      }
+
+    }; /* x86 namespace */
+  }; /* arch namespace */
+}; /* triton namespace */
@@ -23,16 +23,57 @@ namespace triton {
 
       x86Cpu::x86Cpu(triton::callbacks::Callbacks* callbacks) : x86Specifications(ARCH_X86) {
         this->callbacks = callbacks;
+        this->handle    = 0;
+        this->insn      = nullptr;
         this->clear();
       }
 
       x86Cpu::x86Cpu(const x86Cpu& other) : x86Specifications(ARCH_X86) {
+        /* The Capstone context is not shared, the copy opens its own one */
+        this->handle = 0;
+        this->insn   = nullptr;
         this->copy(other);
       }
 
 
       x86Cpu::~x86Cpu() {
         this->memory.clear();
+        this->disassRelease();
+      }
+
+
+      void x86Cpu::disassInit(void) const {
+        if (this->handle)
+          return;
+
+        /* Open capstone */
+        if (triton::extlibs::capstone::cs_open(triton::extlibs::capstone::CS_ARCH_X86, triton::extlibs::capstone::CS_MODE_32, &this->handle) != triton::extlibs::capstone::CS_ERR_OK)
+          throw triton::exceptions::Disassembly("x86Cpu::disassInit(): Cannot open capstone.");
+
+        /* Init capstone's options */
+        triton::extlibs::capstone::cs_option(this->handle, triton::extlibs::capstone::CS_OPT_DETAIL, triton::extlibs::capstone::CS_OPT_ON);
+        triton::extlibs::capstone::cs_option(this->handle, triton::extlibs::capstone::CS_OPT_SYNTAX, triton::extlibs::capstone::CS_OPT_SYNTAX_INTEL);
+
+        /* Allocate the instruction buffer used by cs_disasm_iter() */
+        this->insn = triton::extlibs::capstone::cs_malloc(this->handle);
+        if (this->insn == nullptr) {
+          triton::extlibs::capstone::cs_close(&this->handle);
+          this->handle = 0;
+          throw triton::exceptions::Disassembly("x86Cpu::disassInit(): Cannot allocate the capstone instruction buffer.");
+        }
+      }
+
+
+      void x86Cpu::disassRelease(void) {
+        if (this->insn) {
+          triton::extlibs::capstone::cs_free(this->insn, 1);
+          this->insn = nullptr;
+        }
+
+        if (this->handle) {
+          triton::extlibs::capstone::cs_close(&this->handle);
+          this->handle = 0;
+        }
       }
 
 
@@ -284,105 +325,97 @@ namespace triton {
 
 
       void x86Cpu::disassembly(triton::arch::Instruction& inst) const {
-        triton::extlibs::capstone::csh       handle;
-        triton::extlibs::capstone::cs_insn*  insn;
-        triton::usize                        count = 0;
+        const triton::uint8* code = inst.getOpcode();
+        triton::usize size        = inst.getSize();
+        triton::uint64 addr       = inst.getAddress();
 
         /* Check if the opcode and opcode' size are defined */
-        if (inst.getOpcode() == nullptr || inst.getSize() == 0)
+        if (code == nullptr || size == 0)
           throw triton::exceptions::Disassembly("x86Cpu::disassembly(): Opcode and opcodeSize must be definied.");
 
-        /* Open capstone */
-        if (triton::extlibs::capstone::cs_open(triton::extlibs::capstone::CS_ARCH_X86, triton::extlibs::capstone::CS_MODE_32, &handle) != triton::extlibs::capstone::CS_ERR_OK)
-          throw triton::exceptions::Disassembly("x86Cpu::disassembly(): Cannot open capstone.");
-
-        /* Init capstone's options */
-        triton::extlibs::capstone::cs_option(handle, triton::extlibs::capstone::CS_OPT_DETAIL, triton::extlibs::capstone::CS_OPT_ON);
-        triton::extlibs::capstone::cs_option(handle, triton::extlibs::capstone::CS_OPT_SYNTAX, triton::extlibs::capstone::CS_OPT_SYNTAX_INTEL);
+        /* Open capstone (only the first time) */
+        this->disassInit();
 
         /* Clear instructicon's operands if alredy defined */
         inst.operands.clear();
 
         /* Let's disass and build our operands */
-        count = triton::extlibs::capstone::cs_disasm(handle, inst.getOpcode(), inst.getSize(), inst.getAddress(), 0, &insn);
-        if (count > 0) {
-          triton::extlibs::capstone::cs_detail* detail = insn->detail;
-          for (triton::uint32 j = 0; j < 1; j++) {
+        if (triton::extlibs::capstone::cs_disasm_iter(this->handle, &code, &size, &addr, this->insn)) {
+          triton::extlibs::capstone::cs_detail* detail = this->insn->detail;
 
-            /* Init the disassembly */
-            std::stringstream str;
+          /* Init the disassembly */
+          std::stringstream str;
 
-            /* Add mnemonic */
-            str << insn[j].mnemonic;
+          /* Add mnemonic */
+          str << this->insn->mnemonic;
 
-            /* Add operands */
-            if (detail->x86.op_count)
-              str << " " <<  insn[j].op_str;
+          /* Add operands */
+          if (detail->x86.op_count)
+            str << " " <<  this->insn->op_str;
 
-            inst.setDisassembly(str.str());
+          inst.setDisassembly(str.str());
 
-            /* Refine the size */
-            inst.setSize(insn[j].size);
+          /* Refine the size */
+          inst.setSize(this->insn->size);
 
-            /* Init the instruction's type */
-            inst.setType(this->capstoneInstructionToTritonInstruction(insn[j].id));
+          /* Init the instruction's type */
+          inst.setType(this->capstoneInstructionToTritonInstruction(this->insn->id));
 
-            /* Init the instruction's prefix */
-            inst.setPrefix(this->capstonePrefixToTritonPrefix(detail->x86.prefix[0]));
+          /* Init the instruction's prefix */
+          inst.setPrefix(this->capstonePrefixToTritonPrefix(detail->x86.prefix[0]));
 
-            /* Init operands */
-            for (triton::uint32 n = 0; n < detail->x86.op_count; n++) {
-              triton::extlibs::capstone::cs_x86_op* op = &(detail->x86.operands[n]);
-              switch(op->type) {
+          /* Init operands */
+          for (triton::uint32 n = 0; n < detail->x86.op_count; n++) {
+            triton::extlibs::capstone::cs_x86_op* op = &(detail->x86.operands[n]);
+            switch(op->type) {
 
-                case triton::extlibs::capstone::X86_OP_IMM:
-                  inst.operands.push_back(triton::arch::OperandWrapper(triton::arch::Immediate(op->imm, op->size)));
-                  break;
+              case triton::extlibs::capstone::X86_OP_IMM:
+                inst.operands.push_back(triton::arch::OperandWrapper(triton::arch::Immediate(op->imm, op->size)));
+                break;
 
-                case triton::extlibs::capstone::X86_OP_MEM: {
-                  triton::arch::MemoryAccess mem;
+              case triton::extlibs::capstone::X86_OP_MEM: {
+                triton::arch::MemoryAccess mem;
 
-                  /* Set the size of the memory access */
-                  mem.setPair(std::make_pair(((op->size * BYTE_SIZE_BIT) - 1), 0));
+                /* Set the size of the memory access */
+                mem.setPair(std::make_pair(((op->size * BYTE_SIZE_BIT) - 1), 0));
 
-                  /* LEA if exists */
-                  const triton::arch::Register segment(*this, this->capstoneRegisterToTritonRegister(op->mem.segment));
-                  const triton::arch::Register base(*this, this->capstoneRegisterToTritonRegister(op->mem.base));
-                  const triton::arch::Register index(*this, this->capstoneRegisterToTritonRegister(op->mem.index));
+                /* LEA if exists */
+                const triton::arch::Register segment(*this, this->capstoneRegisterToTritonRegister(op->mem.segment));
+                const triton::arch::Register base(*this, this->capstoneRegisterToTritonRegister(op->mem.base));
+                const triton::arch::Register index(*this, this->capstoneRegisterToTritonRegister(op->mem.index));
 
-                  triton::uint32 immsize = (
-                                            this->isRegisterValid(base.getId()) ? base.getSize() :
-                                            this->isRegisterValid(index.getId()) ? index.getSize() :
-                                            this->gprSize()
-                                          );
+                triton::uint32 immsize = (
+                                          this->isRegisterValid(base.getId()) ? base.getSize() :
+                                          this->isRegisterValid(index.getId()) ? index.getSize() :
+                                          this->gprSize()
+                                        );
 
-                  triton::arch::Immediate disp(op->mem.disp, immsize);
-                  triton::arch::Immediate scale(op->mem.scale, immsize);
+                triton::arch::Immediate disp(op->mem.disp, immsize);
+                triton::arch::Immediate scale(op->mem.scale, immsize);
 
-                  /* Specify that LEA contains a PC relative */
-                  if (base.getId() == this->pcId)
-                    mem.setPcRelative(inst.getNextAddress());
+                /* Specify that LEA contains a PC relative */
+                if (base.getId() == this->pcId)
+                  mem.setPcRelative(inst.getNextAddress());
 
-                  mem.setSegmentRegister(segment);
-                  mem.setBaseRegister(base);
-                  mem.setIndexRegister(index);
-                  mem.setDisplacement(disp);
-                  mem.setScale(scale);
+                mem.setSegmentRegister(segment);
+                mem.setBaseRegister(base);
+                mem.setIndexRegister(index);
+                mem.setDisplacement(disp);
+                mem.setScale(scale);
 
-                  inst.operands.push_back(triton::arch::OperandWrapper(mem));
-                  break;
-                }
+                inst.operands.push_back(triton::arch::OperandWrapper(mem));
+                break;
+              }
 
-                case triton::extlibs::capstone::X86_OP_REG:
-                  inst.operands.push_back(triton::arch::OperandWrapper(triton::arch::Register(*this, this->capstoneRegisterToTritonRegister(op->reg))));
-                  break;
+              case triton::extlibs::capstone::X86_OP_REG:
+                inst.operands.push_back(triton::arch::OperandWrapper(triton::arch::Register(*this, this->capstoneRegisterToTritonRegister(op->reg))));
+                break;
 
-                default:
-                  break;
-              }
+              default:
+                break;
             }
-
           }
+
           /* Set branch */
           if (detail->groups_count > 0) {
             for (triton::uint32 n = 0; n < detail->groups_count; n++) {
@@ -394,13 +427,9 @@ namespace triton {
                 inst.setControlFlow(true);
             }
           }
-          triton::extlibs::capstone::cs_free(insn, count);
         }
         else
           throw triton::exceptions::Disassembly("x86Cpu::disassembly(): Failed to disassemble the given code.");
-
-        triton::extlibs::capstone::cs_close(&handle);
-        return;
       }
 
 
@@ -408,11 +437,7 @@ namespace triton {
         if (execCallbacks && this->callbacks)
           this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, MemoryAccess(addr, BYTE_SIZE));
 
-        auto it = this->memory.find(addr);
-        if (it == this->memory.end())
-          return 0x00;
-
-        return it->second;
+        return this->memory.read(addr);
       }
 
 
@@ -430,18 +455,25 @@ namespace triton {
         if (size == 0 || size > DQQWORD_SIZE)
           throw triton::exceptions::Cpu("x86Cpu::getConcreteMemoryValue(): Invalid size memory.");
 
+        triton::uint8 area[DQQWORD_SIZE];
+        this->memory.read(addr, area, size);
+
         for (triton::sint32 i = size-1; i >= 0; i--)
-          ret = ((ret << BYTE_SIZE_BIT) | this->getConcreteMemoryValue(addr+i, false));
+          ret = ((ret << BYTE_SIZE_BIT) | area[i]);
 
         return ret;
       }
 
 
       std::vector<triton::uint8> x86Cpu::getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::usize size, bool execCallbacks) const {
-        std::vector<triton::uint8> area;
+        std::vector<triton::uint8> area(size);
 
-        for (triton::usize index = 0; index < size; index++)
-          area.push_back(this->getConcreteMemoryValue(baseAddr+index));
+        if (execCallbacks && this->callbacks && this->callbacks->isDefined) {
+          for (triton::usize index = 0; index < size; index++)
+            this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, MemoryAccess(baseAddr+index, BYTE_SIZE));
+        }
+
+        this->memory.read(baseAddr, area.data(), size);
 
         return area;
       }
@@ -593,7 +625,7 @@ namespace triton {
       void x86Cpu::setConcreteMemoryValue(triton::uint64 addr, triton::uint8 value) {
         if (this->callbacks)
           this->callbacks->processCallbacks(triton::callbacks::SET_CONCRETE_MEMORY_VALUE, MemoryAccess(addr, BYTE_SIZE), value);
-        this->memory[addr] = value;
+        this->memory.write(addr, value);
       }
 
 
@@ -611,24 +643,28 @@ namespace triton {
         if (this->callbacks)
           this->callbacks->processCallbacks(triton::callbacks::SET_CONCRETE_MEMORY_VALUE, mem, value);
 
+        triton::uint8 area[DQQWORD_SIZE];
         for (triton::uint32 i = 0; i < size; i++) {
-          this->memory[addr+i] = (cv & 0xff).convert_to<triton::uint8>();
+          area[i] = (cv & 0xff).convert_to<triton::uint8>();
           cv >>= 8;
         }
+
+        this->memory.write(addr, area, size);
       }
 
 
       void x86Cpu::setConcreteMemoryAreaValue(triton::uint64 baseAddr, const std::vector<triton::uint8>& values) {
-        for (triton::usize index = 0; index < values.size(); index++) {
-          this->setConcreteMemoryValue(baseAddr+index, values[index]);
-        }
+        this->setConcreteMemoryAreaValue(baseAddr, values.data(), values.size());
       }
 
 
       void x86Cpu::setConcreteMemoryAreaValue(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size) {
-        for (triton::usize index = 0; index < size; index++) {
-          this->setConcreteMemoryValue(baseAddr+index, area[index]);
+        if (this->callbacks && this->callbacks->isDefined) {
+          for (triton::usize index = 0; index < size; index++)
+            this->callbacks->processCallbacks(triton::callbacks::SET_CONCRETE_MEMORY_VALUE, MemoryAccess(baseAddr+index, BYTE_SIZE), area[index]);
         }
+
+        this->memory.write(baseAddr, area, size);
       }
 
 
@@ -903,19 +939,12 @@ namespace triton {
 
 
       bool x86Cpu::isMemoryMapped(triton::uint64 baseAddr, triton::usize size) {
-        for (triton::usize index = 0; index < size; index++) {
-          if (this->memory.find(baseAddr + index) == this->memory.end())
-            return false;
-        }
-        return true;
+        return this->memory.isMapped(baseAddr, size);
       }
 
 
       void x86Cpu::unmapMemory(triton::uint64 baseAddr, triton::usize size) {
-        for (triton::usize index = 0; index < size; index++) {
-          if (this->memory.find(baseAddr + index) != this->memory.end())
-            this->memory.erase(baseAddr + index);
-        }
+        this->memory.unmap(baseAddr, size);
       }
 
     }; /* x86 namespace */
@@ -696,6 +696,27 @@ namespace triton {
       }
 
 
+      void x86Semantics::flag_s(triton::arch::Instruction& inst,
+                                const triton::engines::symbolic::SharedSymbolicExpression& parent,
+                                const triton::arch::Register& flag,
+                                const triton::engines::symbolic::LazyFlagBuilder& builder,
+                                const std::string& comment) {
+
+        /* Spread the taint from the parent to the child */
+        bool isTainted = this->taintEngine->setTaintRegister(flag, parent->isTainted);
+
+        /* Record how to build the flag until something reads it */
+        if (this->symbolicEngine->isLazyFlagsEnabled()) {
+          this->symbolicEngine->deferSymbolicFlagExpression(builder, flag, comment, isTainted);
+          return;
+        }
+
+        /* Create the symbolic expression */
+        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, builder(), flag, comment);
+        expr->isTainted = isTainted;
+      }
+
+
       void x86Semantics::setFlag_s(triton::arch::Instruction& inst, const triton::arch::Register& flag, std::string comment) {
         /* Create the semantics */
         auto node = this->astCtxt.bv(1, 1);
@@ -837,26 +858,25 @@ namespace triton {
          * Create the semantic.
          * af = 0x10 == (0x10 & (regDst ^ op1 ^ op2))
          */
-        auto node = this->astCtxt.ite(
-                      this->astCtxt.equal(
-                        this->astCtxt.bv(0x10, bvSize),
-                        this->astCtxt.bvand(
-                          this->astCtxt.bv(0x10, bvSize),
-                          this->astCtxt.bvxor(
-                            this->astCtxt.extract(high, low, this->astCtxt.reference(parent)),
-                            this->astCtxt.bvxor(op1, op2)
-                          )
-                        )
-                      ),
-                      this->astCtxt.bv(1, 1),
-                      this->astCtxt.bv(0, 1)
-                    );
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(ID_REG_AF), "Adjust flag");
+        auto builder = [=] {
+          return this->astCtxt.ite(
+                   this->astCtxt.equal(
+                     this->astCtxt.bv(0x10, bvSize),
+                     this->astCtxt.bvand(
+                       this->astCtxt.bv(0x10, bvSize),
+                       this->astCtxt.bvxor(
+                         this->astCtxt.extract(high, low, this->astCtxt.reference(parent)),
+                         this->astCtxt.bvxor(op1, op2)
+                       )
+                     )
+                   ),
+                   this->astCtxt.bv(1, 1),
+                   this->astCtxt.bv(0, 1)
+                 );
+        };
 
-        /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_AF), parent->isTainted);
+        /* Create the symbolic expression (on demand in the LAZY_FLAGS mode) and spread the taint from the parent */
+        this->flag_s(inst, parent, this->architecture->getRegister(ID_REG_AF), builder, "Adjust flag");
       }
 
 
@@ -873,23 +893,22 @@ namespace triton {
          * Create the semantic.
          * af = 1 if ((AL AND 0FH) > 9) or (AF = 1) then 0
          */
-        auto node = this->astCtxt.ite(
-                      this->astCtxt.lor(
-                        this->astCtxt.bvugt(
-                          this->astCtxt.bvand(op1, this->astCtxt.bv(0xf, bvSize)),
-                          this->astCtxt.bv(9, bvSize)
-                        ),
-                        this->astCtxt.equal(op3, this->astCtxt.bvtrue())
-                      ),
-                      this->astCtxt.bv(1, 1),
-                      this->astCtxt.bv(0, 1)
-                    );
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(ID_REG_AF), "Adjust flag");
+        auto builder = [=] {
+          return this->astCtxt.ite(
+                   this->astCtxt.lor(
+                     this->astCtxt.bvugt(
+                       this->astCtxt.bvand(op1, this->astCtxt.bv(0xf, bvSize)),
+                       this->astCtxt.bv(9, bvSize)
+                     ),
+                     this->astCtxt.equal(op3, this->astCtxt.bvtrue())
+                   ),
+                   this->astCtxt.bv(1, 1),
+                   this->astCtxt.bv(0, 1)
+                 );
+        };
 
-        /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_AF), parent->isTainted);
+        /* Create the symbolic expression (on demand in the LAZY_FLAGS mode) and spread the taint from the parent */
+        this->flag_s(inst, parent, this->architecture->getRegister(ID_REG_AF), builder, "Adjust flag");
       }
 
 
@@ -907,26 +926,25 @@ namespace triton {
          * Create the semantic.
          * af = 0x10 == (0x10 & (op1 ^ regDst))
          */
-        auto node = this->astCtxt.ite(
-                      this->astCtxt.equal(
-                        this->astCtxt.bv(0x10, bvSize),
-                        this->astCtxt.bvand(
-                          this->astCtxt.bv(0x10, bvSize),
-                          this->astCtxt.bvxor(
-                            op1,
-                            this->astCtxt.extract(high, low, this->astCtxt.reference(parent))
-                          )
-                        )
-                      ),
-                      this->astCtxt.bv(1, 1),
-                      this->astCtxt.bv(0, 1)
-                    );
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(ID_REG_AF), "Adjust flag");
+        auto builder = [=] {
+          return this->astCtxt.ite(
+                   this->astCtxt.equal(
+                     this->astCtxt.bv(0x10, bvSize),
+                     this->astCtxt.bvand(
+                       this->astCtxt.bv(0x10, bvSize),
+                       this->astCtxt.bvxor(
+                         op1,
+                         this->astCtxt.extract(high, low, this->astCtxt.reference(parent))
+                       )
+                     )
+                   ),
+                   this->astCtxt.bv(1, 1),
+                   this->astCtxt.bv(0, 1)
+                 );
+        };
 
-        /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_AF), parent->isTainted);
+        /* Create the symbolic expression (on demand in the LAZY_FLAGS mode) and spread the taint from the parent */
+        this->flag_s(inst, parent, this->architecture->getRegister(ID_REG_AF), builder, "Adjust flag");
       }
 
 
@@ -943,23 +961,22 @@ namespace triton {
          * Create the semantic.
          * cf = 1 if ((AL AND 0FH) > 9) or (AF = 1) then 0
          */
-        auto node = this->astCtxt.ite(
-                      this->astCtxt.lor(
-                        this->astCtxt.bvugt(
-                          this->astCtxt.bvand(op1, this->astCtxt.bv(0xf, bvSize)),
-                          this->astCtxt.bv(9, bvSize)
-                        ),
-                        this->astCtxt.equal(op3, this->astCtxt.bvtrue())
-                      ),
-                      this->astCtxt.bv(1, 1),
-                      this->astCtxt.bv(0, 1)
-                    );
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(ID_REG_CF), "Carry flag");
+        auto builder = [=] {
+          return this->astCtxt.ite(
+                   this->astCtxt.lor(
+                     this->astCtxt.bvugt(
+                       this->astCtxt.bvand(op1, this->astCtxt.bv(0xf, bvSize)),
+                       this->astCtxt.bv(9, bvSize)
+                     ),
+                     this->astCtxt.equal(op3, this->astCtxt.bvtrue())
+                   ),
+                   this->astCtxt.bv(1, 1),
+                   this->astCtxt.bv(0, 1)
+                 );
+        };
 
-        /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_CF), parent->isTainted);
+        /* Create the symbolic expression (on demand in the LAZY_FLAGS mode) and spread the taint from the parent */
+        this->flag_s(inst, parent, this->architecture->getRegister(ID_REG_CF), builder, "Carry flag");
       }
 
 
@@ -978,23 +995,22 @@ namespace triton {
          * Create the semantic.
          * cf = MSB((op1 & op2) ^ ((op1 ^ op2 ^ parent) & (op1 ^ op2)));
          */
-        auto node = this->astCtxt.extract(bvSize-1, bvSize-1,
-                      this->astCtxt.bvxor(
-                        this->astCtxt.bvand(op1, op2),
-                        this->astCtxt.bvand(
-                          this->astCtxt.bvxor(
-                            this->astCtxt.bvxor(op1, op2),
-                            this->astCtxt.extract(high, low, this->astCtxt.reference(parent))
-                          ),
-                        this->astCtxt.bvxor(op1, op2))
-                      )
-                    );
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(ID_REG_CF), "Carry flag");
+        auto builder = [=] {
+          return this->astCtxt.extract(bvSize-1, bvSize-1,
+                   this->astCtxt.bvxor(
+                     this->astCtxt.bvand(op1, op2),
+                     this->astCtxt.bvand(
+                       this->astCtxt.bvxor(
+                         this->astCtxt.bvxor(op1, op2),
+                         this->astCtxt.extract(high, low, this->astCtxt.reference(parent))
+                       ),
+                     this->astCtxt.bvxor(op1, op2))
+                   )
+                 );
+        };
 
-        /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_CF), parent->isTainted);
+        /* Create the symbolic expression (on demand in the LAZY_FLAGS mode) and spread the taint from the parent */
+        this->flag_s(inst, parent, this->architecture->getRegister(ID_REG_CF), builder, "Carry flag");
       }
 
 
@@ -1008,20 +1024,19 @@ namespace triton {
          * Create the semantic.
          * cf = 0 if op1 == 0 else 1
          */
-        auto node = this->astCtxt.ite(
-                      this->astCtxt.equal(
-                        op1,
-                        this->astCtxt.bv(0, dst.getBitSize())
-                      ),
-                      this->astCtxt.bv(0, 1),
-                      this->astCtxt.bv(1, 1)
-                    );
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(ID_REG_CF), "Carry flag");
+        auto builder = [=] {
+          return this->astCtxt.ite(
+                   this->astCtxt.equal(
+                     op1,
+                     this->astCtxt.bv(0, dst.getBitSize())
+                   ),
+                   this->astCtxt.bv(0, 1),
+                   this->astCtxt.bv(1, 1)
+                 );
+        };
 
-        /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_CF), parent->isTainted);
+        /* Create the symbolic expression (on demand in the LAZY_FLAGS mode) and spread the taint from the parent */
+        this->flag_s(inst, parent, this->architecture->getRegister(ID_REG_CF), builder, "Carry flag");
       }
 
 
@@ -1035,20 +1050,19 @@ namespace triton {
          * Create the semantic.
          * cf = 1 if op1 == 0 else 0
          */
-        auto node = this->astCtxt.ite(
-                      this->astCtxt.equal(
-                        op1,
-                        this->astCtxt.bv(0, dst.getBitSize())
-                      ),
-                      this->astCtxt.bv(1, 1),
-                      this->astCtxt.bv(0, 1)
-                    );
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(ID_REG_CF), "Carry flag");
+        auto builder = [=] {
+          return this->astCtxt.ite(
+                   this->astCtxt.equal(
+                     op1,
+                     this->astCtxt.bv(0, dst.getBitSize())
+                   ),
+                   this->astCtxt.bv(1, 1),
+                   this->astCtxt.bv(0, 1)
+                 );
+        };
 
-        /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_CF), parent->isTainted);
+        /* Create the symbolic expression (on demand in the LAZY_FLAGS mode) and spread the taint from the parent */
+        this->flag_s(inst, parent, this->architecture->getRegister(ID_REG_CF), builder, "Carry flag");
       }
 
 
@@ -1062,20 +1076,19 @@ namespace triton {
          * Create the semantic.
          * cf = 1 if op1 == 0 else 0
          */
-        auto node = this->astCtxt.ite(
-                      this->astCtxt.equal(
-                        op1,
-                        this->astCtxt.bv(0, dst.getBitSize())
-                      ),
-                      this->astCtxt.bv(1, 1),
-                      this->astCtxt.bv(0, 1)
-                    );
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(ID_REG_CF), "Carry flag");
+        auto builder = [=] {
+          return this->astCtxt.ite(
+                   this->astCtxt.equal(
+                     op1,
+                     this->astCtxt.bv(0, dst.getBitSize())
+                   ),
+                   this->astCtxt.bv(1, 1),
+                   this->astCtxt.bv(0, 1)
+                 );
+        };
 
-        /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_CF), parent->isTainted);
+        /* Create the symbolic expression (on demand in the LAZY_FLAGS mode) and spread the taint from the parent */
+        this->flag_s(inst, parent, this->architecture->getRegister(ID_REG_CF), builder, "Carry flag");
       }
 
 
@@ -1090,20 +1103,19 @@ namespace triton {
          * Create the semantic.
          * cf = 0 if sx(dst) == node else 1
          */
-        auto node = this->astCtxt.ite(
-                      this->astCtxt.equal(
-                        this->astCtxt.sx(dst.getBitSize(), op1),
-                        res
-                      ),
-                      this->astCtxt.bv(0, 1),
-                      this->astCtxt.bv(1, 1)
-                    );
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(ID_REG_CF), "Carry flag");
+        auto builder = [=] {
+          return this->astCtxt.ite(
+                   this->astCtxt.equal(
+                     this->astCtxt.sx(dst.getBitSize(), op1),
+                     res
+                   ),
+                   this->astCtxt.bv(0, 1),
+                   this->astCtxt.bv(1, 1)
+                 );
+        };
 
-        /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_CF), parent->isTainted);
+        /* Create the symbolic expression (on demand in the LAZY_FLAGS mode) and spread the taint from the parent */
+        this->flag_s(inst, parent, this->architecture->getRegister(ID_REG_CF), builder, "Carry flag");
       }
 
 
@@ -1117,20 +1129,19 @@ namespace triton {
          * Create the semantic.
          * cf = 0 if op1 == 0 else 1
          */
-        auto node = this->astCtxt.ite(
-                      this->astCtxt.equal(
-                        op1,
-                        this->astCtxt.bv(0, dst.getBitSize())
-                      ),
-                      this->astCtxt.bv(0, 1),
-                      this->astCtxt.bv(1, 1)
-                    );
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(ID_REG_CF), "Carry flag");
+        auto builder = [=] {
+          return this->astCtxt.ite(
+                   this->astCtxt.equal(
+                     op1,
+                     this->astCtxt.bv(0, dst.getBitSize())
+                   ),
+                   this->astCtxt.bv(0, 1),
+                   this->astCtxt.bv(1, 1)
+                 );
+        };
 
-        /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_CF), parent->isTainted);
+        /* Create the symbolic expression (on demand in the LAZY_FLAGS mode) and spread the taint from the parent */
+        this->flag_s(inst, parent, this->architecture->getRegister(ID_REG_CF), builder, "Carry flag");
       }
 
 
@@ -1144,20 +1155,19 @@ namespace triton {
          * Create the semantic.
          * cf = 0 if op1 == 0 else 1
          */
-        auto node = this->astCtxt.ite(
-                      this->astCtxt.equal(
-                        op1,
-                        this->astCtxt.bv(0, dst.getBitSize())
-                      ),
-                      this->astCtxt.bv(0, 1),
-                      this->astCtxt.bv(1, 1)
-                    );
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(ID_REG_CF), "Carry flag");
+        auto builder = [=] {
+          return this->astCtxt.ite(
+                   this->astCtxt.equal(
+                     op1,
+                     this->astCtxt.bv(0, dst.getBitSize())
+                   ),
+                   this->astCtxt.bv(0, 1),
+                   this->astCtxt.bv(1, 1)
+                 );
+        };
 
-        /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_CF), parent->isTainted);
+        /* Create the symbolic expression (on demand in the LAZY_FLAGS mode) and spread the taint from the parent */
+        this->flag_s(inst, parent, this->architecture->getRegister(ID_REG_CF), builder, "Carry flag");
       }
 
 
@@ -1174,20 +1184,19 @@ namespace triton {
          * Create the semantic.
          * cf = 0 == regDst
          */
-        auto node = this->astCtxt.ite(
-                      this->astCtxt.equal(
-                        this->astCtxt.extract(high, low, this->astCtxt.reference(parent)),
-                        this->astCtxt.bv(0, bvSize)
-                      ),
-                      this->astCtxt.bv(1, 1),
-                      this->astCtxt.bv(0, 1)
-                    );
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(ID_REG_CF), "Carry flag");
+        auto builder = [=] {
+          return this->astCtxt.ite(
+                   this->astCtxt.equal(
+                     this->astCtxt.extract(high, low, this->astCtxt.reference(parent)),
+                     this->astCtxt.bv(0, bvSize)
+                   ),
+                   this->astCtxt.bv(1, 1),
+                   this->astCtxt.bv(0, 1)
+                 );
+        };
 
-        /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_CF), parent->isTainted);
+        /* Create the symbolic expression (on demand in the LAZY_FLAGS mode) and spread the taint from the parent */
+        this->flag_s(inst, parent, this->architecture->getRegister(ID_REG_CF), builder, "Carry flag");
       }
 
 
@@ -1480,21 +1489,20 @@ namespace triton {
          * Create the semantic.
          * cf = extract(bvSize, bvSize (((op1 ^ op2 ^ res) ^ ((op1 ^ res) & (op1 ^ op2)))))
          */
-        auto node = this->astCtxt.extract(bvSize-1, bvSize-1,
-                      this->astCtxt.bvxor(
-                        this->astCtxt.bvxor(op1, this->astCtxt.bvxor(op2, this->astCtxt.extract(high, low, this->astCtxt.reference(parent)))),
-                        this->astCtxt.bvand(
-                          this->astCtxt.bvxor(op1, this->astCtxt.extract(high, low, this->astCtxt.reference(parent))),
-                          this->astCtxt.bvxor(op1, op2)
-                        )
-                      )
-                    );
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(ID_REG_CF), "Carry flag");
+        auto builder = [=] {
+          return this->astCtxt.extract(bvSize-1, bvSize-1,
+                   this->astCtxt.bvxor(
+                     this->astCtxt.bvxor(op1, this->astCtxt.bvxor(op2, this->astCtxt.extract(high, low, this->astCtxt.reference(parent)))),
+                     this->astCtxt.bvand(
+                       this->astCtxt.bvxor(op1, this->astCtxt.extract(high, low, this->astCtxt.reference(parent))),
+                       this->astCtxt.bvxor(op1, op2)
+                     )
+                   )
+                 );
+        };
 
-        /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_CF), parent->isTainted);
+        /* Create the symbolic expression (on demand in the LAZY_FLAGS mode) and spread the taint from the parent */
+        this->flag_s(inst, parent, this->architecture->getRegister(ID_REG_CF), builder, "Carry flag");
       }
 
 
@@ -1513,18 +1521,17 @@ namespace triton {
          * Create the semantic.
          * of = MSB((op1 ^ ~op2) & (op1 ^ regDst))
          */
-        auto node = this->astCtxt.extract(bvSize-1, bvSize-1,
-                      this->astCtxt.bvand(
-                        this->astCtxt.bvxor(op1, this->astCtxt.bvnot(op2)),
-                        this->astCtxt.bvxor(op1, this->astCtxt.extract(high, low, this->astCtxt.reference(parent)))
-                      )
-                    );
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(ID_REG_OF), "Overflow flag");
+        auto builder = [=] {
+          return this->astCtxt.extract(bvSize-1, bvSize-1,
+                   this->astCtxt.bvand(
+                     this->astCtxt.bvxor(op1, this->astCtxt.bvnot(op2)),
+                     this->astCtxt.bvxor(op1, this->astCtxt.extract(high, low, this->astCtxt.reference(parent)))
+                   )
+                 );
+        };
 
-        /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_OF), parent->isTainted);
+        /* Create the symbolic expression (on demand in the LAZY_FLAGS mode) and spread the taint from the parent */
+        this->flag_s(inst, parent, this->architecture->getRegister(ID_REG_OF), builder, "Overflow flag");
       }
 
 
@@ -1538,20 +1545,19 @@ namespace triton {
          * Create the semantic.
          * of = 0 if sx(dst) == node else 1
          */
-        auto node = this->astCtxt.ite(
-                      this->astCtxt.equal(
-                        this->astCtxt.sx(dst.getBitSize(), op1),
-                        res
-                      ),
-                      this->astCtxt.bv(0, 1),
-                      this->astCtxt.bv(1, 1)
-                    );
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(ID_REG_OF), "Overflow flag");
+        auto builder = [=] {
+          return this->astCtxt.ite(
+                   this->astCtxt.equal(
+                     this->astCtxt.sx(dst.getBitSize(), op1),
+                     res
+                   ),
+                   this->astCtxt.bv(0, 1),
+                   this->astCtxt.bv(1, 1)
+                 );
+        };
 
-        /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_OF), parent->isTainted);
+        /* Create the symbolic expression (on demand in the LAZY_FLAGS mode) and spread the taint from the parent */
+        this->flag_s(inst, parent, this->architecture->getRegister(ID_REG_OF), builder, "Overflow flag");
       }
 
 
@@ -1565,20 +1571,19 @@ namespace triton {
          * Create the semantic.
          * of = 0 if up == 0 else 1
          */
-        auto node = this->astCtxt.ite(
-                      this->astCtxt.equal(
-                        op1,
-                        this->astCtxt.bv(0, dst.getBitSize())
-                      ),
-                      this->astCtxt.bv(0, 1),
-                      this->astCtxt.bv(1, 1)
-                    );
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(ID_REG_OF), "Overflow flag");
+        auto builder = [=] {
+          return this->astCtxt.ite(
+                   this->astCtxt.equal(
+                     op1,
+                     this->astCtxt.bv(0, dst.getBitSize())
+                   ),
+                   this->astCtxt.bv(0, 1),
+                   this->astCtxt.bv(1, 1)
+                 );
+        };
 
-        /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_OF), parent->isTainted);
+        /* Create the symbolic expression (on demand in the LAZY_FLAGS mode) and spread the taint from the parent */
+        this->flag_s(inst, parent, this->architecture->getRegister(ID_REG_OF), builder, "Overflow flag");
       }
 
 
@@ -1596,18 +1601,17 @@ namespace triton {
          * Create the semantic.
          * of = (res & op1) >> (bvSize - 1) & 1
          */
-        auto node = this->astCtxt.extract(0, 0,
-                      this->astCtxt.bvlshr(
-                        this->astCtxt.bvand(this->astCtxt.extract(high, low, this->astCtxt.reference(parent)), op1),
-                        this->astCtxt.bvsub(this->astCtxt.bv(bvSize, bvSize), this->astCtxt.bv(1, bvSize))
-                      )
-                    );
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(ID_REG_OF), "Overflow flag");
+        auto builder = [=] {
+          return this->astCtxt.extract(0, 0,
+                   this->astCtxt.bvlshr(
+                     this->astCtxt.bvand(this->astCtxt.extract(high, low, this->astCtxt.reference(parent)), op1),
+                     this->astCtxt.bvsub(this->astCtxt.bv(bvSize, bvSize), this->astCtxt.bv(1, bvSize))
+                   )
+                 );
+        };
 
-        /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_OF), parent->isTainted);
+        /* Create the symbolic expression (on demand in the LAZY_FLAGS mode) and spread the taint from the parent */
+        this->flag_s(inst, parent, this->architecture->getRegister(ID_REG_OF), builder, "Overflow flag");
       }
 
 
@@ -1893,18 +1897,17 @@ namespace triton {
          * Create the semantic.
          * of = high:bool((op1 ^ op2) & (op1 ^ regDst))
          */
-        auto node = this->astCtxt.extract(bvSize-1, bvSize-1,
-                      this->astCtxt.bvand(
-                        this->astCtxt.bvxor(op1, op2),
-                        this->astCtxt.bvxor(op1, this->astCtxt.extract(high, low, this->astCtxt.reference(parent)))
-                      )
-                    );
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(ID_REG_OF), "Overflow flag");
+        auto builder = [=] {
+          return this->astCtxt.extract(bvSize-1, bvSize-1,
+                   this->astCtxt.bvand(
+                     this->astCtxt.bvxor(op1, op2),
+                     this->astCtxt.bvxor(op1, this->astCtxt.extract(high, low, this->astCtxt.reference(parent)))
+                   )
+                 );
+        };
 
-        /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_OF), parent->isTainted);
+        /* Create the symbolic expression (on demand in the LAZY_FLAGS mode) and spread the taint from the parent */
+        this->flag_s(inst, parent, this->architecture->getRegister(ID_REG_OF), builder, "Overflow flag");
       }
 
 
@@ -1922,24 +1925,24 @@ namespace triton {
          * pf is set to one if there is an even number of bit set to 1 in the least
          * significant byte of the result.
          */
-        auto node = this->astCtxt.bv(1, 1);
-        for (triton::uint32 counter = 0; counter <= BYTE_SIZE_BIT-1; counter++) {
-          node = this->astCtxt.bvxor(
-                   node,
-                   this->astCtxt.extract(0, 0,
-                     this->astCtxt.bvlshr(
-                       this->astCtxt.extract(high, low, this->astCtxt.reference(parent)),
-                       this->astCtxt.bv(counter, BYTE_SIZE_BIT)
-                     )
-                  )
-                );
-        }
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(ID_REG_PF), "Parity flag");
+        auto builder = [=] {
+          auto node = this->astCtxt.bv(1, 1);
+          for (triton::uint32 counter = 0; counter <= BYTE_SIZE_BIT-1; counter++) {
+            node = this->astCtxt.bvxor(
+                     node,
+                     this->astCtxt.extract(0, 0,
+                       this->astCtxt.bvlshr(
+                         this->astCtxt.extract(high, low, this->astCtxt.reference(parent)),
+                         this->astCtxt.bv(counter, BYTE_SIZE_BIT)
+                       )
+                    )
+                  );
+          }
+          return node;
+        };
 
-        /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_PF), parent->isTainted);
+        /* Create the symbolic expression (on demand in the LAZY_FLAGS mode) and spread the taint from the parent */
+        this->flag_s(inst, parent, this->architecture->getRegister(ID_REG_PF), builder, "Parity flag");
       }
 
 
@@ -1997,13 +2000,12 @@ namespace triton {
          * Create the semantic.
          * sf = high:bool(regDst)
          */
-        auto node = this->astCtxt.extract(high, high, this->astCtxt.reference(parent));
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(ID_REG_SF), "Sign flag");
+        auto builder = [=] {
+          return this->astCtxt.extract(high, high, this->astCtxt.reference(parent));
+        };
 
-        /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_SF), parent->isTainted);
+        /* Create the symbolic expression (on demand in the LAZY_FLAGS mode) and spread the taint from the parent */
+        this->flag_s(inst, parent, this->architecture->getRegister(ID_REG_SF), builder, "Sign flag");
       }
 
 
@@ -2118,20 +2120,19 @@ namespace triton {
          * Create the semantic.
          * zf = 0 == regDst
          */
-        auto node = this->astCtxt.ite(
-                      this->astCtxt.equal(
-                        this->astCtxt.extract(high, low, this->astCtxt.reference(parent)),
-                        this->astCtxt.bv(0, bvSize)
-                      ),
-                      this->astCtxt.bv(1, 1),
-                      this->astCtxt.bv(0, 1)
-                    );
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(ID_REG_ZF), "Zero flag");
+        auto builder = [=] {
+          return this->astCtxt.ite(
+                   this->astCtxt.equal(
+                     this->astCtxt.extract(high, low, this->astCtxt.reference(parent)),
+                     this->astCtxt.bv(0, bvSize)
+                   ),
+                   this->astCtxt.bv(1, 1),
+                   this->astCtxt.bv(0, 1)
+                 );
+        };
 
-        /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_ZF), parent->isTainted);
+        /* Create the symbolic expression (on demand in the LAZY_FLAGS mode) and spread the taint from the parent */
+        this->flag_s(inst, parent, this->architecture->getRegister(ID_REG_ZF), builder, "Zero flag");
       }
 
 
@@ -2145,17 +2146,16 @@ namespace triton {
          * Create the semantic.
          * zf = 1 if op2 == 0 else 0
          */
-        auto node = this->astCtxt.ite(
-                      this->astCtxt.equal(op2, this->astCtxt.bv(0, src.getBitSize())),
-                      this->astCtxt.bvtrue(),
-                      this->astCtxt.bvfalse()
-                    );
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(ID_REG_ZF), "Zero flag");
+        auto builder = [=] {
+          return this->astCtxt.ite(
+                   this->astCtxt.equal(op2, this->astCtxt.bv(0, src.getBitSize())),
+                   this->astCtxt.bvtrue(),
+                   this->astCtxt.bvfalse()
+                 );
+        };
 
-        /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_ZF), parent->isTainted);
+        /* Create the symbolic expression (on demand in the LAZY_FLAGS mode) and spread the taint from the parent */
+        this->flag_s(inst, parent, this->architecture->getRegister(ID_REG_ZF), builder, "Zero flag");
       }
 
 
@@ -4008,7 +4008,7 @@ namespace triton {
         auto expr = this->symbolicEngine->createSymbolicVolatileExpression(inst, node, "CMP operation");
 
         /* Spread taint */
-        expr->isTainted = this->taintEngine->isTainted(dst) | this->taintEngine->isTainted(src);
+        expr->isTainted = this->taintEngine->readTaint(dst) | this->taintEngine->readTaint(src);
 
         /* Upate symbolic flags */
         this->af_s(inst, expr, dst, op1, op2, true);
@@ -4068,7 +4068,7 @@ namespace triton {
         auto expr3 = this->symbolicEngine->createSymbolicExpression(inst, node3, index2, "Index (DI) operation");
 
         /* Spread taint */
-        expr1->isTainted = this->taintEngine->isTainted(dst) | this->taintEngine->isTainted(src);
+        expr1->isTainted = this->taintEngine->readTaint(dst) | this->taintEngine->readTaint(src);
         expr2->isTainted = this->taintEngine->taintUnion(index1, index1);
         expr3->isTainted = this->taintEngine->taintUnion(index2, index2);
 
@@ -4130,7 +4130,7 @@ namespace triton {
         auto expr3 = this->symbolicEngine->createSymbolicExpression(inst, node3, index2, "Index (DI) operation");
 
         /* Spread taint */
-        expr1->isTainted = this->taintEngine->isTainted(dst) | this->taintEngine->isTainted(src);
+        expr1->isTainted = this->taintEngine->readTaint(dst) | this->taintEngine->readTaint(src);
         expr2->isTainted = this->taintEngine->taintUnion(index1, index1);
         expr3->isTainted = this->taintEngine->taintUnion(index2, index2);
 
@@ -4192,7 +4192,7 @@ namespace triton {
         auto expr3 = this->symbolicEngine->createSymbolicExpression(inst, node3, index2, "Index (DI) operation");
 
         /* Spread taint */
-        expr1->isTainted = this->taintEngine->isTainted(dst) | this->taintEngine->isTainted(src);
+        expr1->isTainted = this->taintEngine->readTaint(dst) | this->taintEngine->readTaint(src);
         expr2->isTainted = this->taintEngine->taintUnion(index1, index1);
         expr3->isTainted = this->taintEngine->taintUnion(index2, index2);
 
@@ -4254,7 +4254,7 @@ namespace triton {
         auto expr3 = this->symbolicEngine->createSymbolicExpression(inst, node3, index2, "Index (DI) operation");
 
         /* Spread taint */
-        expr1->isTainted = this->taintEngine->isTainted(dst) | this->taintEngine->isTainted(src);
+        expr1->isTainted = this->taintEngine->readTaint(dst) | this->taintEngine->readTaint(src);
         expr2->isTainted = this->taintEngine->taintUnion(index1, index1);
         expr3->isTainted = this->taintEngine->taintUnion(index2, index2);
 
@@ -4331,7 +4331,7 @@ namespace triton {
           expr7 = this->symbolicEngine->createSymbolicExpression(inst, node3, accumulator, "XCHG operation");
 
         /* Spread taint */
-        expr1->isTainted = this->taintEngine->isTainted(accumulator) | this->taintEngine->isTainted(src1);
+        expr1->isTainted = this->taintEngine->readTaint(accumulator) | this->taintEngine->readTaint(src1);
         expr2->isTainted = expr1->isTainted;
         expr3->isTainted = expr1->isTainted;
         expr4->isTainted = expr1->isTainted;
@@ -4381,8 +4381,8 @@ namespace triton {
         auto expr4 = this->symbolicEngine->createSymbolicExpression(inst, this->astCtxt.extract(63, 0, node3), src3, "XCHG16B RAX operation");
 
         /* Spread taint */
-        expr1->isTainted = this->taintEngine->isTainted(src1) | this->taintEngine->isTainted(src2) | this->taintEngine->isTainted(src3);
-        expr2->isTainted = this->taintEngine->setTaint(src1, this->taintEngine->isTainted(src2) | this->taintEngine->isTainted(src3));
+        expr1->isTainted = this->taintEngine->readTaint(src1) | this->taintEngine->readTaint(src2) | this->taintEngine->readTaint(src3);
+        expr2->isTainted = this->taintEngine->setTaint(src1, this->taintEngine->isTainted(src2) | this->taintEngine->isTainted(src3), this->taintEngine->getTaintLabels(src2) | this->taintEngine->getTaintLabels(src3));
         expr3->isTainted = this->taintEngine->taintAssignment(src2, src1);
         expr4->isTainted = this->taintEngine->taintAssignment(src3, src1);
 
@@ -4449,10 +4449,10 @@ namespace triton {
           expr6 = this->symbolicEngine->createSymbolicExpression(inst, this->astCtxt.extract(31, 0, node3), src3, "XCHG8B EAX operation");
 
         /* Spread taint */
-        expr1->isTainted = this->taintEngine->isTainted(src1) | this->taintEngine->isTainted(src2) | this->taintEngine->isTainted(src3);
-        expr2->isTainted = this->taintEngine->setTaint(src1, this->taintEngine->isTainted(src2) | this->taintEngine->isTainted(src3));
-        expr3->isTainted = this->taintEngine->isTainted(src1) | this->taintEngine->isTainted(src2) | this->taintEngine->isTainted(src3);
-        expr4->isTainted = this->taintEngine->isTainted(src1) | this->taintEngine->isTainted(src2) | this->taintEngine->isTainted(src3);
+        expr1->isTainted = this->taintEngine->readTaint(src1) | this->taintEngine->readTaint(src2) | this->taintEngine->readTaint(src3);
+        expr2->isTainted = this->taintEngine->setTaint(src1, this->taintEngine->isTainted(src2) | this->taintEngine->isTainted(src3), this->taintEngine->getTaintLabels(src2) | this->taintEngine->getTaintLabels(src3));
+        expr3->isTainted = this->taintEngine->readTaint(src1) | this->taintEngine->readTaint(src2) | this->taintEngine->readTaint(src3);
+        expr4->isTainted = this->taintEngine->readTaint(src1) | this->taintEngine->readTaint(src2) | this->taintEngine->readTaint(src3);
         expr5->isTainted = this->taintEngine->taintAssignment(src2, src1);
         expr6->isTainted = this->taintEngine->taintAssignment(src3, src1);
 
@@ -5039,7 +5039,7 @@ namespace triton {
             auto  op3  = this->symbolicEngine->getOperandAst(inst, src2);
             auto  node = this->astCtxt.bvmul(this->astCtxt.sx(src1.getBitSize(), op2), this->astCtxt.sx(src2.getBitSize(), op3));
             auto  expr = this->symbolicEngine->createSymbolicExpression(inst, this->astCtxt.extract(dst.getBitSize()-1, 0, node), dst, "IMUL operation");
-            expr->isTainted = this->taintEngine->setTaint(dst, this->taintEngine->isTainted(src1) | this->taintEngine->isTainted(src2));
+            expr->isTainted = this->taintEngine->setTaint(dst, this->taintEngine->isTainted(src1) | this->taintEngine->isTainted(src2), this->taintEngine->getTaintLabels(src1) | this->taintEngine->getTaintLabels(src2));
             this->cfImul_s(inst, expr, dst, this->astCtxt.bvmul(op2, op3), node);
             this->ofImul_s(inst, expr, dst, this->astCtxt.bvmul(op2, op3), node);
             break;
@@ -5752,7 +5752,7 @@ namespace triton {
         auto expr = this->symbolicEngine->createSymbolicRegisterExpression(inst, node, dst, "LEA operation");
 
         /* Spread taint */
-        expr->isTainted = this->taintEngine->setTaint(dst, this->taintEngine->isTainted(srcBase) | this->taintEngine->isTainted(srcIndex));
+        expr->isTainted = this->taintEngine->setTaint(dst, this->taintEngine->isTainted(srcBase) | this->taintEngine->isTainted(srcIndex), this->taintEngine->getTaintLabels(srcBase) | this->taintEngine->getTaintLabels(srcIndex));
 
         /* Upate the symbolic control flow */
         this->controlFlow_s(inst);
@@ -9407,8 +9407,8 @@ namespace triton {
         auto expr2 = this->symbolicEngine->createSymbolicVolatileExpression(inst, node2, "PTEST operation");
 
         /* Spread taint */
-        expr1->isTainted = this->taintEngine->isTainted(src1) | this->taintEngine->isTainted(src2);
-        expr2->isTainted = this->taintEngine->isTainted(src1) | this->taintEngine->isTainted(src2);
+        expr1->isTainted = this->taintEngine->readTaint(src1) | this->taintEngine->readTaint(src2);
+        expr2->isTainted = this->taintEngine->readTaint(src1) | this->taintEngine->readTaint(src2);
 
         /* Upate symbolic flags */
         this->clearFlag_s(inst, this->architecture->getRegister(ID_REG_AF), "Clears adjust flag");
@@ -10157,7 +10157,7 @@ namespace triton {
         auto expr1 = this->symbolicEngine->createSymbolicVolatileExpression(inst, node1, "RCL tempory operation");
 
         /* Spread taint */
-        expr1->isTainted = this->taintEngine->isTainted(dst) | this->taintEngine->isTainted(src);
+        expr1->isTainted = this->taintEngine->readTaint(dst) | this->taintEngine->readTaint(src);
 
         /* Create the semantics */
         auto node2 = this->astCtxt.extract(dst.getBitSize()-1, 0, node1);
@@ -10227,7 +10227,7 @@ namespace triton {
         auto expr1 = this->symbolicEngine->createSymbolicVolatileExpression(inst, node1, "RCR tempory operation");
 
         /* Spread taint */
-        expr1->isTainted = this->taintEngine->isTainted(dst) | this->taintEngine->isTainted(src);
+        expr1->isTainted = this->taintEngine->readTaint(dst) | this->taintEngine->readTaint(src);
 
         /* Create the semantics */
         auto node2 = this->astCtxt.extract(dst.getBitSize()-1, 0, node1);
@@ -10649,7 +10649,7 @@ namespace triton {
         auto expr2 = this->symbolicEngine->createSymbolicExpression(inst, node2, index, "Index operation");
 
         /* Spread taint */
-        expr1->isTainted = this->taintEngine->isTainted(dst) | this->taintEngine->isTainted(src);
+        expr1->isTainted = this->taintEngine->readTaint(dst) | this->taintEngine->readTaint(src);
         expr2->isTainted = this->taintEngine->taintUnion(index, index);
 
         /* Upate symbolic flags */
@@ -10702,7 +10702,7 @@ namespace triton {
         auto expr2 = this->symbolicEngine->createSymbolicExpression(inst, node2, index, "Index operation");
 
         /* Spread taint */
-        expr1->isTainted = this->taintEngine->isTainted(dst) | this->taintEngine->isTainted(src);
+        expr1->isTainted = this->taintEngine->readTaint(dst) | this->taintEngine->readTaint(src);
         expr2->isTainted = this->taintEngine->taintUnion(index, index);
 
         /* Upate symbolic flags */
@@ -10755,7 +10755,7 @@ namespace triton {
         auto expr2 = this->symbolicEngine->createSymbolicExpression(inst, node2, index, "Index operation");
 
         /* Spread taint */
-        expr1->isTainted = this->taintEngine->isTainted(dst) | this->taintEngine->isTainted(src);
+        expr1->isTainted = this->taintEngine->readTaint(dst) | this->taintEngine->readTaint(src);
         expr2->isTainted = this->taintEngine->taintUnion(index, index);
 
         /* Upate symbolic flags */
@@ -10808,7 +10808,7 @@ namespace triton {
         auto expr2 = this->symbolicEngine->createSymbolicExpression(inst, node2, index, "Index operation");
 
         /* Spread taint */
-        expr1->isTainted = this->taintEngine->isTainted(dst) | this->taintEngine->isTainted(src);
+        expr1->isTainted = this->taintEngine->readTaint(dst) | this->taintEngine->readTaint(src);
         expr2->isTainted = this->taintEngine->taintUnion(index, index);
 
         /* Upate symbolic flags */
@@ -11886,7 +11886,7 @@ namespace triton {
         auto expr = this->symbolicEngine->createSymbolicVolatileExpression(inst, node, "TEST operation");
 
         /* Spread taint */
-        expr->isTainted = this->taintEngine->isTainted(src1) | this->taintEngine->isTainted(src2);
+        expr->isTainted = this->taintEngine->readTaint(src1) | this->taintEngine->readTaint(src2);
 
         /* Upate symbolic flags */
         this->clearFlag_s(inst, this->architecture->getRegister(ID_REG_CF), "Clears carry flag");
@@ -12439,8 +12439,8 @@ namespace triton {
         auto expr2 = this->symbolicEngine->createSymbolicVolatileExpression(inst, node2, "VPTEST operation");
 
         /* Spread taint */
-        expr1->isTainted = this->taintEngine->isTainted(src1) | this->taintEngine->isTainted(src2);
-        expr2->isTainted = this->taintEngine->isTainted(src1) | this->taintEngine->isTainted(src2);
+        expr1->isTainted = this->taintEngine->readTaint(src1) | this->taintEngine->readTaint(src2);
+        expr2->isTainted = this->taintEngine->readTaint(src1) | this->taintEngine->readTaint(src2);
 
         /* Upate symbolic flags */
         this->clearFlag_s(inst, this->architecture->getRegister(ID_REG_AF), "Clears adjust flag");
@@ -12495,6 +12495,8 @@ namespace triton {
         auto& src  = inst.operands[1];
         bool  dstT = this->taintEngine->isTainted(dst);
         bool  srcT = this->taintEngine->isTainted(src);
+        auto  dstL = this->taintEngine->getTaintLabels(dst);
+        auto  srcL = this->taintEngine->getTaintLabels(src);
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->getOperandAst(inst, dst);
@@ -12509,8 +12511,8 @@ namespace triton {
         auto expr2 = this->symbolicEngine->createSymbolicExpression(inst, node2, src, "XCHG operation");
 
         /* Spread taint */
-        expr1->isTainted = this->taintEngine->setTaint(dst, srcT);
-        expr2->isTainted = this->taintEngine->setTaint(src, dstT);
+        expr1->isTainted = this->taintEngine->setTaint(dst, srcT, srcL);
+        expr2->isTainted = this->taintEngine->setTaint(src, dstT, dstL);
 
         /* Create symbolic operands */
         op1 = this->symbolicEngine->getOperandAst(inst, dst);
@@ -12543,6 +12545,8 @@ namespace triton {
         auto& src  = inst.operands[1];
         bool  dstT = this->taintEngine->isTainted(dst);
         bool  srcT = this->taintEngine->isTainted(src);
+        auto  dstL = this->taintEngine->getTaintLabels(dst);
+        auto  srcL = this->taintEngine->getTaintLabels(src);
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->getOperandAst(inst, dst);
@@ -12557,8 +12561,8 @@ namespace triton {
         auto expr2 = this->symbolicEngine->createSymbolicExpression(inst, node2, src, "XCHG operation");
 
         /* Spread taint */
-        expr1->isTainted = this->taintEngine->setTaint(dst, srcT);
-        expr2->isTainted = this->taintEngine->setTaint(src, dstT);
+        expr1->isTainted = this->taintEngine->setTaint(dst, srcT, srcL);
+        expr2->isTainted = this->taintEngine->setTaint(src, dstT, dstL);
 
         /* Upate the symbolic control flow */
         this->controlFlow_s(inst);
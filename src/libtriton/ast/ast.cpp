@@ -5,7 +5,9 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
 #include <new>
 
 #include <triton/ast.hpp>
@@ -19,22 +21,98 @@
 namespace triton {
   namespace ast {
 
+    /* Mixes the bits of a 64-bit value (splitmix64 finalizer) */
+    static inline triton::uint64 hashMix(triton::uint64 value) {
+      value ^= value >> 30;
+      value *= 0xbf58476d1ce4e5b9ULL;
+      value ^= value >> 27;
+      value *= 0x94d049bb133111ebULL;
+      value ^= value >> 31;
+      return value;
+    }
+
+
+    /* Folds a wide integer into a 64-bit hash */
+    static triton::uint64 foldHash(triton::uint512 value) {
+      triton::uint64 h = 0;
+      while (value) {
+        h = hashMix(h ^ (value & triton::ast::nativeMask(64)).convert_to<triton::uint64>());
+        value >>= 64;
+      }
+      return h;
+    }
+
+
+    /* Hashes a string (FNV-1a) */
+    static triton::uint64 stringHash(const std::string& value) {
+      triton::uint64 h = 0xcbf29ce484222325ULL;
+      for (unsigned char c : value)
+        h = (h ^ c) * 0x100000001b3ULL;
+      return h;
+    }
+
+
+    /* Returns true if the order of the children of a kind of node does not matter */
+    static bool isCommutative(enum kind_e kind) {
+      switch (kind) {
+        case BVADD_NODE:
+        case BVAND_NODE:
+        case BVMUL_NODE:
+        case BVNAND_NODE:
+        case BVNOR_NODE:
+        case BVOR_NODE:
+        case BVXNOR_NODE:
+        case BVXOR_NODE:
+        case DISTINCT_NODE:
+        case EQUAL_NODE:
+        case LAND_NODE:
+        case LOR_NODE:
+          return true;
+
+        default:
+          break;
+      }
+
+      return false;
+    }
+
+
     /* ====== Abstract node */
 
     AbstractNode::AbstractNode(enum kind_e kind, AstContext& ctxt): ctxt(ctxt) {
-      this->eval        = 0;
-      this->kind        = kind;
-      this->size        = 0;
-      this->symbolized  = false;
+      this->eval64       = 0;
+      this->hashValue    = 0;
+      this->kind         = kind;
+      this->level        = 1;
+      this->parentsSweep = AST_PARENTS_LINEAR_SIZE;
+      this->size         = 0;
+      this->symbolized   = false;
+    }
+
+
+    AbstractNode::AbstractNode(const AbstractNode& other): std::enable_shared_from_this<AbstractNode>(), ctxt(other.ctxt) {
+      this->children     = other.children;
+      this->eval.reset(other.eval ? new triton::uint512(*other.eval) : nullptr);
+      this->eval64       = other.eval64;
+      this->hashValue    = other.hashValue;
+      this->kind         = other.kind;
+      this->level        = other.level;
+      this->parentsSweep = AST_PARENTS_LINEAR_SIZE;
+      this->size         = other.size;
+      this->symbolized   = other.symbolized;
     }
 
 
     AbstractNode::AbstractNode(const AbstractNode& other, AstContext& ctxt): ctxt(ctxt) {
-      this->eval        = other.eval;
-      this->kind        = other.kind;
-      this->parents     = other.parents;
-      this->size        = other.size;
-      this->symbolized  = other.symbolized;
+      this->eval.reset(other.eval ? new triton::uint512(*other.eval) : nullptr);
+      this->eval64       = other.eval64;
+      this->hashValue    = other.hashValue;
+      this->kind         = other.kind;
+      this->level        = other.level;
+      this->parents      = other.parents;
+      this->parentsSweep = other.parentsSweep;
+      this->size         = other.size;
+      this->symbolized   = other.symbolized;
 
       for (triton::uint32 index = 0; index < other.children.size(); index++)
         this->children.push_back(triton::ast::newInstance(other.children[index].get()));
@@ -69,7 +147,10 @@ namespace triton {
 
 
     bool AbstractNode::isSigned(void) const {
-      if ((this->eval >> (this->size-1)) & 1)
+      if (this->isNative())
+        return ((this->eval64 >> (this->size-1)) & 1);
+
+      if (this->eval && ((*this->eval >> (this->size-1)) & 1))
         return true;
       return false;
     }
@@ -105,15 +186,74 @@ namespace triton {
     }
 
 
+    bool AbstractNode::isNative(void) const {
+      return (this->size != 0 && this->size <= 64);
+    }
+
+
     bool AbstractNode::equalTo(const SharedAbstractNode& other) const {
-      return (this->evaluate() == other->evaluate()) &&
-             (this->getBitvectorSize() == other->getBitvectorSize()) &&
-             (this->hash(1) == other->hash(1));
+      return (this->getHash() == other->getHash()) &&
+             (this->evaluate() == other->evaluate()) &&
+             (this->getBitvectorSize() == other->getBitvectorSize());
+    }
+
+
+    triton::uint64 AbstractNode::getHash(void) const {
+      return this->hashValue;
+    }
+
+
+    triton::uint512 AbstractNode::hash(triton::uint32) const {
+      return this->hashValue;
+    }
+
+
+    triton::uint512& AbstractNode::wideEval(void) {
+      if (!this->eval)
+        this->eval.reset(new triton::uint512(0));
+      return *this->eval;
+    }
+
+
+    triton::uint32 AbstractNode::getLevel(void) const {
+      return this->level;
     }
 
 
     triton::uint512 AbstractNode::evaluate(void) const {
-      return this->eval;
+      if (this->isNative())
+        return this->eval64;
+      if (this->eval)
+        return *this->eval;
+      return 0;
+    }
+
+
+    triton::uint64 AbstractNode::evaluate64(void) const {
+      if (this->isNative())
+        return this->eval64;
+      if (this->eval)
+        return (*this->eval & triton::ast::nativeMask(64)).convert_to<triton::uint64>();
+      return 0;
+    }
+
+
+    void AbstractNode::initHash(triton::uint64 payload) {
+      triton::uint64 h   = hashMix(hashMix(this->kind) ^ payload);
+      triton::uint64 sum = 0;
+      bool commutative   = isCommutative(this->kind);
+
+      this->level = 1;
+      for (const auto& child : this->children) {
+        /* The hashes of the children are chained unless their order does not matter */
+        if (commutative)
+          sum += hashMix(child->getHash());
+        else
+          h = hashMix(h ^ child->getHash());
+        this->level = std::max(this->level, child->getLevel() + 1);
+      }
+
+      this->hashValue = hashMix(h + sum + this->children.size());
     }
 
 
@@ -123,50 +263,65 @@ namespace triton {
     }
 
 
-    std::vector<SharedAbstractNode>& AbstractNode::getChildren(void) {
+    ChildVector& AbstractNode::getChildren(void) {
       return this->children;
     }
 
 
     std::vector<SharedAbstractNode> AbstractNode::getParents(void) {
       std::vector<SharedAbstractNode> res;
-      std::vector<AbstractNode*> toRemove;
 
-      for (auto& kv: parents) {
-        if (auto sp = kv.second.lock())
+      this->compactParents();
+      res.reserve(this->parents.size());
+
+      for (auto& parent : this->parents) {
+        if (auto sp = parent.second.lock())
           res.push_back(sp);
-        else
-          toRemove.push_back(kv.first);
       }
 
-      for(auto* an: toRemove)
-        parents.erase(an);
-
       return res;
     }
 
 
-    void AbstractNode::setParent(AbstractNode* p) {
-      auto it = parents.find(p);
-      if (it == parents.end()) {
-        auto A = p->shared_from_this();
-        this->parents.insert(std::make_pair(p, std::weak_ptr<AbstractNode>(A)));
+    void AbstractNode::compactParents(void) {
+      /* Remove expired parents */
+      auto last = std::remove_if(this->parents.begin(), this->parents.end(),
+                    [](const std::pair<AbstractNode*, WeakAbstractNode>& parent) { return parent.second.expired(); });
+      this->parents.erase(last, this->parents.end());
+
+      /* Remove duplicated parents */
+      if (this->parents.size() > 1) {
+        std::sort(this->parents.begin(), this->parents.end(),
+          [](const std::pair<AbstractNode*, WeakAbstractNode>& a, const std::pair<AbstractNode*, WeakAbstractNode>& b) { return a.first < b.first; });
+        last = std::unique(this->parents.begin(), this->parents.end(),
+                 [](const std::pair<AbstractNode*, WeakAbstractNode>& a, const std::pair<AbstractNode*, WeakAbstractNode>& b) { return a.first == b.first; });
+        this->parents.erase(last, this->parents.end());
       }
-      else {
-        if (it->second.expired()) {
-          parents.erase(it);
-          auto A = p->shared_from_this();
-          this->parents.insert(std::make_pair(p, std::weak_ptr<AbstractNode>(A)));
-        }
-        else {
-          /* Ptr already in */
+
+      this->parentsSweep = std::max<triton::usize>(AST_PARENTS_LINEAR_SIZE, this->parents.size() * 2);
+    }
+
+
+    void AbstractNode::setParent(AbstractNode* p) {
+      /* Small lists are kept without duplicate, bigger ones are compacted when they double */
+      if (this->parents.size() <= AST_PARENTS_LINEAR_SIZE) {
+        for (auto& parent : this->parents) {
+          if (parent.first == p && !parent.second.expired())
+            return;
         }
       }
+      else if (this->parents.size() >= this->parentsSweep) {
+        this->compactParents();
+      }
+
+      this->parents.push_back(std::make_pair(p, WeakAbstractNode(p->shared_from_this())));
     }
 
 
     void AbstractNode::removeParent(AbstractNode* p) {
-      this->parents.erase(parents.find(p));
+      auto last = std::remove_if(this->parents.begin(), this->parents.end(),
+                    [p](const std::pair<AbstractNode*, WeakAbstractNode>& parent) { return parent.first == p; });
+      this->parents.erase(last, this->parents.end());
     }
 
 
@@ -188,12 +343,12 @@ namespace triton {
       if (child == nullptr)
         throw triton::exceptions::Ast("AbstractNode::setChild(): child cannot be null.");
 
-      /* Setup the parent of the child */
-      child->setParent(this);
-
       /* Remove the parent of the old child */
       this->children[index]->removeParent(this);
 
+      /* Setup the parent of the child */
+      child->setParent(this);
+
       /* Setup the child of the parent */
       this->children[index] = child;
     }
@@ -231,7 +386,10 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->children[0]->getBitvectorSize();
-      this->eval = ((this->children[0]->evaluate() + this->children[1]->evaluate()) & this->getBitvectorMask());
+      if (this->isNative())
+        this->eval64 = ((this->children[0]->evaluate64() + this->children[1]->evaluate64()) & triton::ast::nativeMask(this->size));
+      else
+        this->wideEval() = ((this->children[0]->evaluate() + this->children[1]->evaluate()) & this->getBitvectorMask());
 
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
@@ -239,20 +397,14 @@ namespace triton {
         this->symbolized |= this->children[index]->isSymbolized();
       }
 
+      /* Init hash */
+      this->initHash();
+
       /* Init parents */
       this->initParents();
     }
 
 
-    triton::uint512 BvaddNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->children.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * this->children[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
-    }
-
-
     /* ====== bvand */
 
 
@@ -271,7 +423,10 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->children[0]->getBitvectorSize();
-      this->eval = (this->children[0]->evaluate() & this->children[1]->evaluate());
+      if (this->isNative())
+        this->eval64 = (this->children[0]->evaluate64() & this->children[1]->evaluate64());
+      else
+        this->wideEval() = (this->children[0]->evaluate() & this->children[1]->evaluate());
 
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
@@ -279,20 +434,14 @@ namespace triton {
         this->symbolized |= this->children[index]->isSymbolized();
       }
 
+      /* Init hash */
+      this->initHash();
+
       /* Init parents */
       this->initParents();
     }
 
 
-    triton::uint512 BvandNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->children.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * this->children[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
-    }
-
-
 
     /* ====== bvashr (shift with sign extension fill) */
 
@@ -314,35 +463,45 @@ namespace triton {
       if (this->children[0]->getBitvectorSize() != this->children[1]->getBitvectorSize())
         throw triton::exceptions::Ast("BvashrNode::init(): Must take two nodes of same size.");
 
-      value = this->children[0]->evaluate();
-      shift = this->children[1]->evaluate().convert_to<triton::uint32>();
-
       /* Init attributes */
       this->size = this->children[0]->getBitvectorSize();
 
-      /* Mask based on the sign */
-      if (this->children[0]->isSigned()) {
-        mask = 1;
-        mask = ((mask << (this->size-1)) & this->getBitvectorMask());
+      /* Native arithmetic shift */
+      if (this->isNative()) {
+        if (this->children[1]->evaluate64() >= this->size)
+          this->eval64 = this->children[0]->isSigned() ? triton::ast::nativeMask(this->size) : 0;
+        else
+          this->eval64 = (static_cast<triton::uint64>(triton::ast::nativeSignExtend(this->children[0].get()) >> this->children[1]->evaluate64()) & triton::ast::nativeMask(this->size));
       }
 
-      if (shift >= this->size && this->children[0]->isSigned()) {
-        this->eval = -1;
-        this->eval &= this->getBitvectorMask();
-      }
+      else {
+        value = this->children[0]->evaluate();
+        shift = this->children[1]->evaluate().convert_to<triton::uint32>();
 
-      else if (shift >= this->size && !this->children[0]->isSigned()) {
-        this->eval = 0;
-      }
+        /* Mask based on the sign */
+        if (this->children[0]->isSigned()) {
+          mask = 1;
+          mask = ((mask << (this->size-1)) & this->getBitvectorMask());
+        }
 
-      else if (shift == 0) {
-        this->eval = value;
-      }
+        if (shift >= this->size && this->children[0]->isSigned()) {
+          this->wideEval() = -1;
+          this->wideEval() &= this->getBitvectorMask();
+        }
 
-      else {
-        this->eval = value & this->getBitvectorMask();
-        for (triton::uint32 index = 0; index < shift; index++) {
-          this->eval = (((this->eval >> 1) | mask) & this->getBitvectorMask());
+        else if (shift >= this->size && !this->children[0]->isSigned()) {
+          this->wideEval() = 0;
+        }
+
+        else if (shift == 0) {
+          this->wideEval() = value;
+        }
+
+        else {
+          this->wideEval() = value & this->getBitvectorMask();
+          for (triton::uint32 index = 0; index < shift; index++) {
+            this->wideEval() = (((this->wideEval() >> 1) | mask) & this->getBitvectorMask());
+          }
         }
       }
 
@@ -352,20 +511,14 @@ namespace triton {
         this->symbolized |= this->children[index]->isSymbolized();
       }
 
+      /* Init hash */
+      this->initHash();
+
       /* Init parents */
       this->initParents();
     }
 
 
-    triton::uint512 BvashrNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->children.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::pow(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
-
     /* ====== bvlshr (shift with zero filled) */
 
 
@@ -384,7 +537,10 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->children[0]->getBitvectorSize();
-      this->eval = (this->children[0]->evaluate() >> this->children[1]->evaluate().convert_to<triton::uint32>());
+      if (this->isNative())
+        this->eval64 = (this->children[1]->evaluate64() >= this->size) ? 0 : (this->children[0]->evaluate64() >> this->children[1]->evaluate64());
+      else
+        this->wideEval() = (this->children[0]->evaluate() >> this->children[1]->evaluate().convert_to<triton::uint32>());
 
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
@@ -392,20 +548,14 @@ namespace triton {
         this->symbolized |= this->children[index]->isSymbolized();
       }
 
+      /* Init hash */
+      this->initHash();
+
       /* Init parents */
       this->initParents();
     }
 
 
-    triton::uint512 BvlshrNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->children.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::pow(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
-
     /* ====== bvmul */
 
 
@@ -424,7 +574,10 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->children[0]->getBitvectorSize();
-      this->eval = ((this->children[0]->evaluate() * this->children[1]->evaluate()) & this->getBitvectorMask());
+      if (this->isNative())
+        this->eval64 = ((this->children[0]->evaluate64() * this->children[1]->evaluate64()) & triton::ast::nativeMask(this->size));
+      else
+        this->wideEval() = ((this->children[0]->evaluate() * this->children[1]->evaluate()) & this->getBitvectorMask());
 
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
@@ -432,20 +585,14 @@ namespace triton {
         this->symbolized |= this->children[index]->isSymbolized();
       }
 
+      /* Init hash */
+      this->initHash();
+
       /* Init parents */
       this->initParents();
     }
 
 
-    triton::uint512 BvmulNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->children.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * this->children[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
-    }
-
-
     /* ====== bvnand */
 
 
@@ -464,7 +611,10 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->children[0]->getBitvectorSize();
-      this->eval = (~(this->children[0]->evaluate() & this->children[1]->evaluate()) & this->getBitvectorMask());
+      if (this->isNative())
+        this->eval64 = (~(this->children[0]->evaluate64() & this->children[1]->evaluate64()) & triton::ast::nativeMask(this->size));
+      else
+        this->wideEval() = (~(this->children[0]->evaluate() & this->children[1]->evaluate()) & this->getBitvectorMask());
 
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
@@ -472,20 +622,14 @@ namespace triton {
         this->symbolized |= this->children[index]->isSymbolized();
       }
 
+      /* Init hash */
+      this->initHash();
+
       /* Init parents */
       this->initParents();
     }
 
 
-    triton::uint512 BvnandNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->children.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * this->children[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
-    }
-
-
     /* ====== bvneg */
 
 
@@ -500,7 +644,10 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->children[0]->getBitvectorSize();
-      this->eval = ((-(this->children[0]->evaluate().convert_to<triton::sint512>())).convert_to<triton::uint512>() & this->getBitvectorMask());
+      if (this->isNative())
+        this->eval64 = ((~this->children[0]->evaluate64() + 1) & triton::ast::nativeMask(this->size));
+      else
+        this->wideEval() = ((-(this->children[0]->evaluate().convert_to<triton::sint512>())).convert_to<triton::uint512>() & this->getBitvectorMask());
 
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
@@ -508,20 +655,14 @@ namespace triton {
         this->symbolized |= this->children[index]->isSymbolized();
       }
 
+      /* Init hash */
+      this->initHash();
+
       /* Init parents */
       this->initParents();
     }
 
 
-    triton::uint512 BvnegNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->children.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * this->children[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
-    }
-
-
     /* ====== bvnor */
 
 
@@ -540,7 +681,10 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->children[0]->getBitvectorSize();
-      this->eval = (~(this->children[0]->evaluate() | this->children[1]->evaluate()) & this->getBitvectorMask());
+      if (this->isNative())
+        this->eval64 = (~(this->children[0]->evaluate64() | this->children[1]->evaluate64()) & triton::ast::nativeMask(this->size));
+      else
+        this->wideEval() = (~(this->children[0]->evaluate() | this->children[1]->evaluate()) & this->getBitvectorMask());
 
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
@@ -548,20 +692,14 @@ namespace triton {
         this->symbolized |= this->children[index]->isSymbolized();
       }
 
+      /* Init hash */
+      this->initHash();
+
       /* Init parents */
       this->initParents();
     }
 
 
-    triton::uint512 BvnorNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->children.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * this->children[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
-    }
-
-
     /* ====== bvnot */
 
 
@@ -576,7 +714,10 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->children[0]->getBitvectorSize();
-      this->eval = (~this->children[0]->evaluate() & this->getBitvectorMask());
+      if (this->isNative())
+        this->eval64 = (~this->children[0]->evaluate64() & triton::ast::nativeMask(this->size));
+      else
+        this->wideEval() = (~this->children[0]->evaluate() & this->getBitvectorMask());
 
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
@@ -584,20 +725,14 @@ namespace triton {
         this->symbolized |= this->children[index]->isSymbolized();
       }
 
+      /* Init hash */
+      this->initHash();
+
       /* Init parents */
       this->initParents();
     }
 
 
-    triton::uint512 BvnotNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->children.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * this->children[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
-    }
-
-
     /* ====== bvor */
 
 
@@ -616,7 +751,10 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->children[0]->getBitvectorSize();
-      this->eval = (this->children[0]->evaluate() | this->children[1]->evaluate());
+      if (this->isNative())
+        this->eval64 = (this->children[0]->evaluate64() | this->children[1]->evaluate64());
+      else
+        this->wideEval() = (this->children[0]->evaluate() | this->children[1]->evaluate());
 
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
@@ -624,20 +762,14 @@ namespace triton {
         this->symbolized |= this->children[index]->isSymbolized();
       }
 
+      /* Init hash */
+      this->initHash();
+
       /* Init parents */
       this->initParents();
     }
 
 
-    triton::uint512 BvorNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->children.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * this->children[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
-    }
-
-
     /* ====== bvrol */
 
 
@@ -652,8 +784,7 @@ namespace triton {
 
 
     void BvrolNode::init(void) {
-      triton::uint32 rot    = 0;
-      triton::uint512 value = 0;
+      triton::uint32 rot = 0;
 
       if (this->children.size() < 2)
         throw triton::exceptions::Ast("BvrolNode::init(): Must take at least two children.");
@@ -661,13 +792,20 @@ namespace triton {
       if (this->children[0]->getKind() != DECIMAL_NODE)
         throw triton::exceptions::Ast("BvrolNode::init(): rot must be a DECIMAL_NODE.");
 
-      rot   = reinterpret_cast<DecimalNode*>(this->children[0].get())->getValue().convert_to<triton::uint32>();
-      value = this->children[1]->evaluate();
+      rot = reinterpret_cast<DecimalNode*>(this->children[0].get())->getValue().convert_to<triton::uint32>();
 
       /* Init attributes */
       this->size = this->children[1]->getBitvectorSize();
       rot %= this->size;
-      this->eval = (((value << rot) | (value >> (this->size - rot))) & this->getBitvectorMask());
+
+      if (this->isNative()) {
+        triton::uint64 value = this->children[1]->evaluate64();
+        this->eval64 = (rot == 0) ? value : (((value << rot) | (value >> (this->size - rot))) & triton::ast::nativeMask(this->size));
+      }
+      else {
+        triton::uint512 value = this->children[1]->evaluate();
+        this->wideEval() = (((value << rot) | (value >> (this->size - rot))) & this->getBitvectorMask());
+      }
 
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
@@ -675,20 +813,14 @@ namespace triton {
         this->symbolized |= this->children[index]->isSymbolized();
       }
 
+      /* Init hash */
+      this->initHash();
+
       /* Init parents */
       this->initParents();
     }
 
 
-    triton::uint512 BvrolNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->children.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::pow(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
-
     /* ====== bvror */
 
 
@@ -703,8 +835,7 @@ namespace triton {
 
 
     void BvrorNode::init(void) {
-      triton::uint32 rot    = 0;
-      triton::uint512 value = 0;
+      triton::uint32 rot = 0;
 
       if (this->children.size() < 2)
         throw triton::exceptions::Ast("BvrorNode::init(): Must take at least two children.");
@@ -712,13 +843,20 @@ namespace triton {
       if (this->children[0]->getKind() != DECIMAL_NODE)
         throw triton::exceptions::Ast("BvrorNode::init(): rot must be a DECIMAL_NODE.");
 
-      rot   = reinterpret_cast<DecimalNode*>(this->children[0].get())->getValue().convert_to<triton::uint32>();
-      value = this->children[1]->evaluate();
+      rot = reinterpret_cast<DecimalNode*>(this->children[0].get())->getValue().convert_to<triton::uint32>();
 
       /* Init attributes */
       this->size = this->children[1]->getBitvectorSize();
       rot %= this->size;
-      this->eval = (((value >> rot) | (value << (this->size - rot))) & this->getBitvectorMask());
+
+      if (this->isNative()) {
+        triton::uint64 value = this->children[1]->evaluate64();
+        this->eval64 = (rot == 0) ? value : (((value >> rot) | (value << (this->size - rot))) & triton::ast::nativeMask(this->size));
+      }
+      else {
+        triton::uint512 value = this->children[1]->evaluate();
+        this->wideEval() = (((value >> rot) | (value << (this->size - rot))) & this->getBitvectorMask());
+      }
 
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
@@ -726,20 +864,14 @@ namespace triton {
         this->symbolized |= this->children[index]->isSymbolized();
       }
 
+      /* Init hash */
+      this->initHash();
+
       /* Init parents */
       this->initParents();
     }
 
 
-    triton::uint512 BvrorNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->children.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::pow(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
-
     /* ====== bvsdiv */
 
 
@@ -759,19 +891,34 @@ namespace triton {
       if (this->children[0]->getBitvectorSize() != this->children[1]->getBitvectorSize())
         throw triton::exceptions::Ast("BvsdivNode::init(): Must take two nodes of same size.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->children[0].get());
-      op2Signed = triton::ast::modularSignExtend(this->children[1].get());
-
       /* Init attributes */
       this->size = this->children[0]->getBitvectorSize();
 
-      if (op2Signed == 0) {
-        this->eval = (op1Signed < 0 ? 1 : -1);
-        this->eval &= this->getBitvectorMask();
+      if (this->isNative()) {
+        triton::sint64 op1 = triton::ast::nativeSignExtend(this->children[0].get());
+        triton::sint64 op2 = triton::ast::nativeSignExtend(this->children[1].get());
+
+        /* -1 is handled apart as INT64_MIN / -1 overflows */
+        if (op2 == 0)
+          this->eval64 = ((op1 < 0 ? 1 : -1) & triton::ast::nativeMask(this->size));
+        else if (op2 == -1)
+          this->eval64 = ((~static_cast<triton::uint64>(op1) + 1) & triton::ast::nativeMask(this->size));
+        else
+          this->eval64 = (static_cast<triton::uint64>(op1 / op2) & triton::ast::nativeMask(this->size));
+      }
+
+      else {
+        /* Sign extend */
+        op1Signed = triton::ast::modularSignExtend(this->children[0].get());
+        op2Signed = triton::ast::modularSignExtend(this->children[1].get());
+
+        if (op2Signed == 0) {
+          this->wideEval() = (op1Signed < 0 ? 1 : -1);
+          this->wideEval() &= this->getBitvectorMask();
+        }
+        else
+          this->wideEval() = ((op1Signed / op2Signed).convert_to<triton::uint512>() & this->getBitvectorMask());
       }
-      else
-        this->eval = ((op1Signed / op2Signed).convert_to<triton::uint512>() & this->getBitvectorMask());
 
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
@@ -779,20 +926,14 @@ namespace triton {
         this->symbolized |= this->children[index]->isSymbolized();
       }
 
+      /* Init hash */
+      this->initHash();
+
       /* Init parents */
       this->initParents();
     }
 
 
-    triton::uint512 BvsdivNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->children.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::pow(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
-
     /* ====== bvsge */
 
 
@@ -812,13 +953,18 @@ namespace triton {
       if (this->children[0]->getBitvectorSize() != this->children[1]->getBitvectorSize())
         throw triton::exceptions::Ast("BvsgeNode::init(): Must take two nodes of same size.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->children[0].get());
-      op2Signed = triton::ast::modularSignExtend(this->children[1].get());
-
       /* Init attributes */
       this->size = 1;
-      this->eval = (op1Signed >= op2Signed);
+
+      if (this->children[0]->isNative())
+        this->eval64 = (triton::ast::nativeSignExtend(this->children[0].get()) >= triton::ast::nativeSignExtend(this->children[1].get()));
+
+      else {
+        /* Sign extend */
+        op1Signed = triton::ast::modularSignExtend(this->children[0].get());
+        op2Signed = triton::ast::modularSignExtend(this->children[1].get());
+        this->eval64 = (op1Signed >= op2Signed);
+      }
 
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
@@ -826,20 +972,14 @@ namespace triton {
         this->symbolized |= this->children[index]->isSymbolized();
       }
 
+      /* Init hash */
+      this->initHash();
+
       /* Init parents */
       this->initParents();
     }
 
 
-    triton::uint512 BvsgeNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->children.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::pow(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
-
     /* ====== bvsgt */
 
 
@@ -859,13 +999,18 @@ namespace triton {
       if (this->children[0]->getBitvectorSize() != this->children[1]->getBitvectorSize())
         throw triton::exceptions::Ast("BvsgtNode::init(): Must take two nodes of same size.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->children[0].get());
-      op2Signed = triton::ast::modularSignExtend(this->children[1].get());
-
       /* Init attributes */
       this->size = 1;
-      this->eval = (op1Signed > op2Signed);
+
+      if (this->children[0]->isNative())
+        this->eval64 = (triton::ast::nativeSignExtend(this->children[0].get()) > triton::ast::nativeSignExtend(this->children[1].get()));
+
+      else {
+        /* Sign extend */
+        op1Signed = triton::ast::modularSignExtend(this->children[0].get());
+        op2Signed = triton::ast::modularSignExtend(this->children[1].get());
+        this->eval64 = (op1Signed > op2Signed);
+      }
 
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
@@ -873,20 +1018,14 @@ namespace triton {
         this->symbolized |= this->children[index]->isSymbolized();
       }
 
+      /* Init hash */
+      this->initHash();
+
       /* Init parents */
       this->initParents();
     }
 
 
-    triton::uint512 BvsgtNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->children.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::pow(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
-
     /* ====== bvshl */
 
 
@@ -905,7 +1044,10 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->children[0]->getBitvectorSize();
-      this->eval = ((this->children[0]->evaluate() << this->children[1]->evaluate().convert_to<triton::uint32>()) & this->getBitvectorMask());
+      if (this->isNative())
+        this->eval64 = (this->children[1]->evaluate64() >= this->size) ? 0 : ((this->children[0]->evaluate64() << this->children[1]->evaluate64()) & triton::ast::nativeMask(this->size));
+      else
+        this->wideEval() = ((this->children[0]->evaluate() << this->children[1]->evaluate().convert_to<triton::uint32>()) & this->getBitvectorMask());
 
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
@@ -913,20 +1055,14 @@ namespace triton {
         this->symbolized |= this->children[index]->isSymbolized();
       }
 
+      /* Init hash */
+      this->initHash();
+
       /* Init parents */
       this->initParents();
     }
 
 
-    triton::uint512 BvshlNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->children.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::pow(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
-
     /* ====== bvsle */
 
 
@@ -945,13 +1081,18 @@ namespace triton {
       if (this->children[0]->getBitvectorSize() != this->children[1]->getBitvectorSize())
         throw triton::exceptions::Ast("BvsleNode::init(): Must take two nodes of same size.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->children[0].get());
-      op2Signed = triton::ast::modularSignExtend(this->children[1].get());
-
       /* Init attributes */
       this->size = 1;
-      this->eval = (op1Signed <= op2Signed);
+
+      if (this->children[0]->isNative())
+        this->eval64 = (triton::ast::nativeSignExtend(this->children[0].get()) <= triton::ast::nativeSignExtend(this->children[1].get()));
+
+      else {
+        /* Sign extend */
+        op1Signed = triton::ast::modularSignExtend(this->children[0].get());
+        op2Signed = triton::ast::modularSignExtend(this->children[1].get());
+        this->eval64 = (op1Signed <= op2Signed);
+      }
 
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
@@ -959,20 +1100,14 @@ namespace triton {
         this->symbolized |= this->children[index]->isSymbolized();
       }
 
+      /* Init hash */
+      this->initHash();
+
       /* Init parents */
       this->initParents();
     }
 
 
-    triton::uint512 BvsleNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->children.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::pow(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
-
     /* ====== bvslt */
 
 
@@ -992,13 +1127,18 @@ namespace triton {
       if (this->children[0]->getBitvectorSize() != this->children[1]->getBitvectorSize())
         throw triton::exceptions::Ast("BvsltNode::init(): Must take two nodes of same size.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->children[0].get());
-      op2Signed = triton::ast::modularSignExtend(this->children[1].get());
-
       /* Init attributes */
       this->size = 1;
-      this->eval = (op1Signed < op2Signed);
+
+      if (this->children[0]->isNative())
+        this->eval64 = (triton::ast::nativeSignExtend(this->children[0].get()) < triton::ast::nativeSignExtend(this->children[1].get()));
+
+      else {
+        /* Sign extend */
+        op1Signed = triton::ast::modularSignExtend(this->children[0].get());
+        op2Signed = triton::ast::modularSignExtend(this->children[1].get());
+        this->eval64 = (op1Signed < op2Signed);
+      }
 
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
@@ -1006,20 +1146,14 @@ namespace triton {
         this->symbolized |= this->children[index]->isSymbolized();
       }
 
+      /* Init hash */
+      this->initHash();
+
       /* Init parents */
       this->initParents();
     }
 
 
-    triton::uint512 BvsltNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->children.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::pow(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
-
     /* ====== bvsmod - 2's complement signed remainder (sign follows divisor) */
 
 
@@ -1039,17 +1173,38 @@ namespace triton {
       if (this->children[0]->getBitvectorSize() != this->children[1]->getBitvectorSize())
         throw triton::exceptions::Ast("BvsmodNode::init(): Must take two nodes of same size.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->children[0].get());
-      op2Signed = triton::ast::modularSignExtend(this->children[1].get());
-
       /* Init attributes */
       this->size = this->children[0]->getBitvectorSize();
 
-      if (this->children[1]->evaluate() == 0)
-        this->eval = this->children[0]->evaluate();
-      else
-        this->eval = ((((op1Signed % op2Signed) + op2Signed) % op2Signed).convert_to<triton::uint512>() & this->getBitvectorMask());
+      if (this->isNative()) {
+        triton::sint64 op1 = triton::ast::nativeSignExtend(this->children[0].get());
+        triton::sint64 op2 = triton::ast::nativeSignExtend(this->children[1].get());
+
+        if (op2 == 0)
+          this->eval64 = this->children[0]->evaluate64();
+
+        else {
+          /* -1 is handled apart as INT64_MIN % -1 overflows */
+          triton::sint64 rem = (op2 == -1) ? 0 : (op1 % op2);
+
+          /* The sign follows the divisor */
+          if (rem != 0 && ((rem < 0) != (op2 < 0)))
+            rem += op2;
+
+          this->eval64 = (static_cast<triton::uint64>(rem) & triton::ast::nativeMask(this->size));
+        }
+      }
+
+      else {
+        /* Sign extend */
+        op1Signed = triton::ast::modularSignExtend(this->children[0].get());
+        op2Signed = triton::ast::modularSignExtend(this->children[1].get());
+
+        if (this->children[1]->evaluate() == 0)
+          this->wideEval() = this->children[0]->evaluate();
+        else
+          this->wideEval() = ((((op1Signed % op2Signed) + op2Signed) % op2Signed).convert_to<triton::uint512>() & this->getBitvectorMask());
+      }
 
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
@@ -1057,20 +1212,14 @@ namespace triton {
         this->symbolized |= this->children[index]->isSymbolized();
       }
 
+      /* Init hash */
+      this->initHash();
+
       /* Init parents */
       this->initParents();
     }
 
 
-    triton::uint512 BvsmodNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->children.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::pow(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
-
     /* ====== bvsrem - 2's complement signed remainder (sign follows dividend) */
 
 
@@ -1090,17 +1239,32 @@ namespace triton {
       if (this->children[0]->getBitvectorSize() != this->children[1]->getBitvectorSize())
         throw triton::exceptions::Ast("BvsremNode::init(): Must take two nodes of same size.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->children[0].get());
-      op2Signed = triton::ast::modularSignExtend(this->children[1].get());
-
       /* Init attributes */
       this->size = this->children[0]->getBitvectorSize();
 
-      if (this->children[1]->evaluate() == 0)
-        this->eval = this->children[0]->evaluate();
-      else
-        this->eval = ((op1Signed - ((op1Signed / op2Signed) * op2Signed)).convert_to<triton::uint512>() & this->getBitvectorMask());
+      if (this->isNative()) {
+        triton::sint64 op1 = triton::ast::nativeSignExtend(this->children[0].get());
+        triton::sint64 op2 = triton::ast::nativeSignExtend(this->children[1].get());
+
+        /* -1 is handled apart as INT64_MIN % -1 overflows */
+        if (op2 == 0)
+          this->eval64 = this->children[0]->evaluate64();
+        else if (op2 == -1)
+          this->eval64 = 0;
+        else
+          this->eval64 = (static_cast<triton::uint64>(op1 % op2) & triton::ast::nativeMask(this->size));
+      }
+
+      else {
+        /* Sign extend */
+        op1Signed = triton::ast::modularSignExtend(this->children[0].get());
+        op2Signed = triton::ast::modularSignExtend(this->children[1].get());
+
+        if (this->children[1]->evaluate() == 0)
+          this->wideEval() = this->children[0]->evaluate();
+        else
+          this->wideEval() = ((op1Signed - ((op1Signed / op2Signed) * op2Signed)).convert_to<triton::uint512>() & this->getBitvectorMask());
+      }
 
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
@@ -1108,20 +1272,14 @@ namespace triton {
         this->symbolized |= this->children[index]->isSymbolized();
       }
 
+      /* Init hash */
+      this->initHash();
+
       /* Init parents */
       this->initParents();
     }
 
 
-    triton::uint512 BvsremNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->children.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::pow(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
-
     /* ====== bvsub */
 
 
@@ -1140,7 +1298,10 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->children[0]->getBitvectorSize();
-      this->eval = ((this->children[0]->evaluate() - this->children[1]->evaluate()) & this->getBitvectorMask());
+      if (this->isNative())
+        this->eval64 = ((this->children[0]->evaluate64() - this->children[1]->evaluate64()) & triton::ast::nativeMask(this->size));
+      else
+        this->wideEval() = ((this->children[0]->evaluate() - this->children[1]->evaluate()) & this->getBitvectorMask());
 
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
@@ -1148,20 +1309,14 @@ namespace triton {
         this->symbolized |= this->children[index]->isSymbolized();
       }
 
+      /* Init hash */
+      this->initHash();
+
       /* Init parents */
       this->initParents();
     }
 
 
-    triton::uint512 BvsubNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->children.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::pow(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
-
     /* ====== bvudiv */
 
 
@@ -1181,10 +1336,18 @@ namespace triton {
       /* Init attributes */
       this->size = this->children[0]->getBitvectorSize();
 
-      if (this->children[1]->evaluate() == 0)
-        this->eval = (-1 & this->getBitvectorMask());
-      else
-        this->eval = (this->children[0]->evaluate() / this->children[1]->evaluate());
+      if (this->isNative()) {
+        if (this->children[1]->evaluate64() == 0)
+          this->eval64 = triton::ast::nativeMask(this->size);
+        else
+          this->eval64 = (this->children[0]->evaluate64() / this->children[1]->evaluate64());
+      }
+      else {
+        if (this->children[1]->evaluate() == 0)
+          this->wideEval() = (-1 & this->getBitvectorMask());
+        else
+          this->wideEval() = (this->children[0]->evaluate() / this->children[1]->evaluate());
+      }
 
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
@@ -1192,20 +1355,14 @@ namespace triton {
         this->symbolized |= this->children[index]->isSymbolized();
       }
 
+      /* Init hash */
+      this->initHash();
+
       /* Init parents */
       this->initParents();
     }
 
 
-    triton::uint512 BvudivNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->children.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::pow(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
-
     /* ====== bvuge */
 
 
@@ -1224,7 +1381,10 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->children[0]->evaluate() >= this->children[1]->evaluate());
+      if (this->children[0]->isNative())
+        this->eval64 = (this->children[0]->evaluate64() >= this->children[1]->evaluate64());
+      else
+        this->eval64 = (this->children[0]->evaluate() >= this->children[1]->evaluate());
 
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
@@ -1232,20 +1392,14 @@ namespace triton {
         this->symbolized |= this->children[index]->isSymbolized();
       }
 
+      /* Init hash */
+      this->initHash();
+
       /* Init parents */
       this->initParents();
     }
 
 
-    triton::uint512 BvugeNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->children.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::pow(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
-
     /* ====== bvugt */
 
 
@@ -1264,7 +1418,10 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->children[0]->evaluate() > this->children[1]->evaluate());
+      if (this->children[0]->isNative())
+        this->eval64 = (this->children[0]->evaluate64() > this->children[1]->evaluate64());
+      else
+        this->eval64 = (this->children[0]->evaluate() > this->children[1]->evaluate());
 
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
@@ -1272,20 +1429,14 @@ namespace triton {
         this->symbolized |= this->children[index]->isSymbolized();
       }
 
+      /* Init hash */
+      this->initHash();
+
       /* Init parents */
       this->initParents();
     }
 
 
-    triton::uint512 BvugtNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->children.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::pow(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
-
     /* ====== bvule */
 
 
@@ -1304,7 +1455,10 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->children[0]->evaluate() <= this->children[1]->evaluate());
+      if (this->children[0]->isNative())
+        this->eval64 = (this->children[0]->evaluate64() <= this->children[1]->evaluate64());
+      else
+        this->eval64 = (this->children[0]->evaluate() <= this->children[1]->evaluate());
 
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
@@ -1312,20 +1466,14 @@ namespace triton {
         this->symbolized |= this->children[index]->isSymbolized();
       }
 
+      /* Init hash */
+      this->initHash();
+
       /* Init parents */
       this->initParents();
     }
 
 
-    triton::uint512 BvuleNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->children.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::pow(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
-
     /* ====== bvult */
 
 
@@ -1344,7 +1492,10 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->children[0]->evaluate() < this->children[1]->evaluate());
+      if (this->children[0]->isNative())
+        this->eval64 = (this->children[0]->evaluate64() < this->children[1]->evaluate64());
+      else
+        this->eval64 = (this->children[0]->evaluate() < this->children[1]->evaluate());
 
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
@@ -1352,20 +1503,14 @@ namespace triton {
         this->symbolized |= this->children[index]->isSymbolized();
       }
 
+      /* Init hash */
+      this->initHash();
+
       /* Init parents */
       this->initParents();
     }
 
 
-    triton::uint512 BvultNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->children.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::pow(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
-
     /* ====== bvurem */
 
 
@@ -1385,10 +1530,18 @@ namespace triton {
       /* Init attributes */
       this->size = this->children[0]->getBitvectorSize();
 
-      if (this->children[1]->evaluate() == 0)
-        this->eval = this->children[0]->evaluate();
-      else
-        this->eval = (this->children[0]->evaluate() % this->children[1]->evaluate());
+      if (this->isNative()) {
+        if (this->children[1]->evaluate64() == 0)
+          this->eval64 = this->children[0]->evaluate64();
+        else
+          this->eval64 = (this->children[0]->evaluate64() % this->children[1]->evaluate64());
+      }
+      else {
+        if (this->children[1]->evaluate() == 0)
+          this->wideEval() = this->children[0]->evaluate();
+        else
+          this->wideEval() = (this->children[0]->evaluate() % this->children[1]->evaluate());
+      }
 
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
@@ -1396,20 +1549,14 @@ namespace triton {
         this->symbolized |= this->children[index]->isSymbolized();
       }
 
+      /* Init hash */
+      this->initHash();
+
       /* Init parents */
       this->initParents();
     }
 
 
-    triton::uint512 BvuremNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->children.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::pow(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
-
     /* ====== bvxnor */
 
 
@@ -1428,7 +1575,10 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->children[0]->getBitvectorSize();
-      this->eval = (~(this->children[0]->evaluate() ^ this->children[1]->evaluate()) & this->getBitvectorMask());
+      if (this->isNative())
+        this->eval64 = (~(this->children[0]->evaluate64() ^ this->children[1]->evaluate64()) & triton::ast::nativeMask(this->size));
+      else
+        this->wideEval() = (~(this->children[0]->evaluate() ^ this->children[1]->evaluate()) & this->getBitvectorMask());
 
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
@@ -1436,20 +1586,14 @@ namespace triton {
         this->symbolized |= this->children[index]->isSymbolized();
       }
 
+      /* Init hash */
+      this->initHash();
+
       /* Init parents */
       this->initParents();
     }
 
 
-    triton::uint512 BvxnorNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->children.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * this->children[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
-    }
-
-
     /* ====== bvxor */
 
 
@@ -1468,7 +1612,10 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->children[0]->getBitvectorSize();
-      this->eval = (this->children[0]->evaluate() ^ this->children[1]->evaluate());
+      if (this->isNative())
+        this->eval64 = (this->children[0]->evaluate64() ^ this->children[1]->evaluate64());
+      else
+        this->wideEval() = (this->children[0]->evaluate() ^ this->children[1]->evaluate());
 
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
@@ -1476,20 +1623,14 @@ namespace triton {
         this->symbolized |= this->children[index]->isSymbolized();
       }
 
+      /* Init hash */
+      this->initHash();
+
       /* Init parents */
       this->initParents();
     }
 
 
-    triton::uint512 BvxorNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->children.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * this->children[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
-    }
-
-
     /* ====== bv */
 
 
@@ -1520,7 +1661,10 @@ namespace triton {
 
       /* Init attributes */
       this->size = size;
-      this->eval = (value & this->getBitvectorMask());
+      if (this->isNative())
+        this->eval64 = (value & triton::ast::nativeMask(this->size)).convert_to<triton::uint64>();
+      else
+        this->wideEval() = (value & this->getBitvectorMask());
 
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
@@ -1528,20 +1672,14 @@ namespace triton {
         this->symbolized |= this->children[index]->isSymbolized();
       }
 
+      /* Init hash */
+      this->initHash();
+
       /* Init parents */
       this->initParents();
     }
 
 
-    triton::uint512 BvNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->children.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::pow(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
-
     /* ====== concat */
 
 
@@ -1573,9 +1711,16 @@ namespace triton {
       if (this->size > MAX_BITS_SUPPORTED)
         throw triton::exceptions::Ast("ConcatNode::init(): Size connot be greater than MAX_BITS_SUPPORTED.");
 
-      this->eval = this->children[0]->evaluate();
-      for (triton::uint32 index = 0; index < this->children.size()-1; index++)
-        this->eval = ((this->eval << this->children[index+1]->getBitvectorSize()) | this->children[index+1]->evaluate());
+      if (this->isNative()) {
+        this->eval64 = this->children[0]->evaluate64();
+        for (triton::uint32 index = 0; index < this->children.size()-1; index++)
+          this->eval64 = ((this->eval64 << this->children[index+1]->getBitvectorSize()) | this->children[index+1]->evaluate64());
+      }
+      else {
+        this->wideEval() = this->children[0]->evaluate();
+        for (triton::uint32 index = 0; index < this->children.size()-1; index++)
+          this->wideEval() = ((this->wideEval() << this->children[index+1]->getBitvectorSize()) | this->children[index+1]->evaluate());
+      }
 
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
@@ -1583,20 +1728,14 @@ namespace triton {
         this->symbolized |= this->children[index]->isSymbolized();
       }
 
+      /* Init hash */
+      this->initHash();
+
       /* Init parents */
       this->initParents();
     }
 
 
-    triton::uint512 ConcatNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->children.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::pow(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
-
     /* ====== Decimal node */
 
 
@@ -1607,10 +1746,13 @@ namespace triton {
 
     void DecimalNode::init(void) {
       /* Init attributes */
-      this->eval        = 0;
+      this->eval.reset();
       this->size        = 0;
       this->symbolized  = false;
 
+      /* Init hash */
+      this->initHash(foldHash(this->value));
+
       /* Init parents */
       this->initParents();
     }
@@ -1621,12 +1763,6 @@ namespace triton {
     }
 
 
-    triton::uint512 DecimalNode::hash(triton::uint32 deep) const {
-      triton::uint512 hash = this->kind ^ this->value;
-      return hash;
-    }
-
-
     /* ====== Distinct node */
 
 
@@ -1645,7 +1781,10 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->children[0]->evaluate() != this->children[1]->evaluate());
+      if (this->children[0]->isNative())
+        this->eval64 = (this->children[0]->evaluate64() != this->children[1]->evaluate64());
+      else
+        this->eval64 = (this->children[0]->evaluate() != this->children[1]->evaluate());
 
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
@@ -1653,20 +1792,14 @@ namespace triton {
         this->symbolized |= this->children[index]->isSymbolized();
       }
 
+      /* Init hash */
+      this->initHash();
+
       /* Init parents */
       this->initParents();
     }
 
 
-    triton::uint512 DistinctNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->children.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * this->children[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
-    }
-
-
     /* ====== equal */
 
 
@@ -1685,7 +1818,10 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->children[0]->evaluate() == this->children[1]->evaluate());
+      if (this->children[0]->isNative())
+        this->eval64 = (this->children[0]->evaluate64() == this->children[1]->evaluate64());
+      else
+        this->eval64 = (this->children[0]->evaluate() == this->children[1]->evaluate());
 
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
@@ -1693,20 +1829,14 @@ namespace triton {
         this->symbolized |= this->children[index]->isSymbolized();
       }
 
+      /* Init hash */
+      this->initHash();
+
       /* Init parents */
       this->initParents();
     }
 
 
-    triton::uint512 EqualNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->children.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * this->children[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
-    }
-
-
     /* ====== extract */
 
 
@@ -1735,31 +1865,31 @@ namespace triton {
 
       /* Init attributes */
       this->size = ((high - low) + 1);
-      this->eval = ((this->children[2]->evaluate() >> low) & this->getBitvectorMask());
 
       if (this->size > this->children[2]->getBitvectorSize() || high >= this->children[2]->getBitvectorSize())
         throw triton::exceptions::Ast("ExtractNode::init(): The size of the extraction is higher than the child expression.");
 
+      if (this->children[2]->isNative())
+        this->eval64 = ((this->children[2]->evaluate64() >> low) & triton::ast::nativeMask(this->size));
+      else if (this->isNative())
+        this->eval64 = ((this->children[2]->evaluate() >> low) & triton::ast::nativeMask(this->size)).convert_to<triton::uint64>();
+      else
+        this->wideEval() = ((this->children[2]->evaluate() >> low) & this->getBitvectorMask());
+
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
       }
 
+      /* Init hash */
+      this->initHash();
+
       /* Init parents */
       this->initParents();
     }
 
 
-    triton::uint512 ExtractNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->children.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::pow(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
-
     /* ====== ite */
 
 
@@ -1782,7 +1912,10 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->children[1]->getBitvectorSize();
-      this->eval = this->children[0]->evaluate() ? this->children[1]->evaluate() : this->children[2]->evaluate();
+      if (this->isNative())
+        this->eval64 = this->children[0]->evaluate64() ? this->children[1]->evaluate64() : this->children[2]->evaluate64();
+      else
+        this->wideEval() = this->children[0]->evaluate64() ? this->children[1]->evaluate() : this->children[2]->evaluate();
 
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
@@ -1790,20 +1923,14 @@ namespace triton {
         this->symbolized |= this->children[index]->isSymbolized();
       }
 
+      /* Init hash */
+      this->initHash();
+
       /* Init parents */
       this->initParents();
     }
 
 
-    triton::uint512 IteNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->children.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::pow(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
-
     /* ====== Land */
 
 
@@ -1828,32 +1955,26 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = 1;
+      this->eval64 = 1;
 
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
-        this->eval = this->eval && this->children[index]->evaluate();
+        this->eval64 = this->eval64 && this->children[index]->evaluate64();
 
         if (this->children[index]->isLogical() == false)
           throw triton::exceptions::Ast("LandNode::init(): Must take logical nodes as arguments.");
       }
 
+      /* Init hash */
+      this->initHash();
+
       /* Init parents */
       this->initParents();
     }
 
 
-    triton::uint512 LandNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->children.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * this->children[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
-    }
-
-
     /* ====== Let */
 
 
@@ -1873,7 +1994,10 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->children[2]->getBitvectorSize();
-      this->eval = this->children[2]->evaluate();
+      if (this->isNative())
+        this->eval64 = this->children[2]->evaluate64();
+      else
+        this->wideEval() = this->children[2]->evaluate();
 
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
@@ -1881,20 +2005,14 @@ namespace triton {
         this->symbolized |= this->children[index]->isSymbolized();
       }
 
+      /* Init hash */
+      this->initHash();
+
       /* Init parents */
       this->initParents();
     }
 
 
-    triton::uint512 LetNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->children.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::pow(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
-
     /* ====== Lnot */
 
 
@@ -1909,7 +2027,7 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = !(this->children[0]->evaluate());
+      this->eval64 = !(this->children[0]->evaluate64());
 
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
@@ -1921,20 +2039,14 @@ namespace triton {
       }
 
 
+      /* Init hash */
+      this->initHash();
+
       /* Init parents */
       this->initParents();
     }
 
 
-    triton::uint512 LnotNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->children.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * this->children[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
-    }
-
-
     /* ====== Lor */
 
 
@@ -1959,32 +2071,26 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = 0;
+      this->eval64 = 0;
 
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
         this->children[index]->setParent(this);
         this->symbolized |= this->children[index]->isSymbolized();
-        this->eval = this->eval || this->children[index]->evaluate();
+        this->eval64 = this->eval64 || this->children[index]->evaluate64();
 
         if (this->children[index]->isLogical() == false)
           throw triton::exceptions::Ast("LorNode::init(): Must take logical nodes as arguments.");
       }
 
+      /* Init hash */
+      this->initHash();
+
       /* Init parents */
       this->initParents();
     }
 
 
-    triton::uint512 LorNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->children.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * this->children[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
-    }
-
-
     /* ====== Reference node */
 
 
@@ -1996,23 +2102,24 @@ namespace triton {
 
     void ReferenceNode::init(void) {
       /* Init attributes */
-      this->eval        = this->expr->getAst()->evaluate();
       this->size        = this->expr->getAst()->getBitvectorSize();
       this->symbolized  = this->expr->getAst()->isSymbolized();
 
+      if (this->isNative())
+        this->eval64 = this->expr->getAst()->evaluate64();
+      else
+        this->wideEval() = this->expr->getAst()->evaluate();
+
       this->expr->getAst()->setParent(this);
 
+      /* Init hash */
+      this->initHash(this->expr->getId());
+
       /* Init parents */
       this->initParents();
     }
 
 
-    triton::uint512 ReferenceNode::hash(triton::uint32 deep) const {
-      triton::uint512 hash = this->kind ^ this->expr->getId();
-      return hash;
-    }
-
-
     const triton::engines::symbolic::SharedSymbolicExpression& ReferenceNode::getSymbolicExpression(void) const {
       return this->expr;
     }
@@ -2028,10 +2135,13 @@ namespace triton {
 
     void StringNode::init(void) {
       /* Init attributes */
-      this->eval        = 0;
+      this->eval.reset();
       this->size        = 0;
       this->symbolized  = false;
 
+      /* Init hash */
+      this->initHash(stringHash(this->value));
+
       /* Init parents */
       this->initParents();
     }
@@ -2042,15 +2152,6 @@ namespace triton {
     }
 
 
-    triton::uint512 StringNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind;
-      triton::uint32 index = 1;
-      for (std::string::const_iterator it=this->value.cbegin(); it != this->value.cend(); it++)
-        h = h ^ triton::ast::pow(*it, index++);
-      return triton::ast::rotl(h, deep);
-    }
-
-
     /* ====== sx */
 
 
@@ -2076,7 +2177,10 @@ namespace triton {
       if (size > MAX_BITS_SUPPORTED)
         throw triton::exceptions::Ast("SxNode::SxNode(): Size connot be greater than MAX_BITS_SUPPORTED.");
 
-      this->eval = ((((this->children[1]->evaluate() >> (this->children[1]->getBitvectorSize()-1)) == 0) ? this->children[1]->evaluate() : (this->children[1]->evaluate() | ~(this->children[1]->getBitvectorMask()))) & this->getBitvectorMask());
+      if (this->isNative())
+        this->eval64 = (static_cast<triton::uint64>(triton::ast::nativeSignExtend(this->children[1].get())) & triton::ast::nativeMask(this->size));
+      else
+        this->wideEval() = ((((this->children[1]->evaluate() >> (this->children[1]->getBitvectorSize()-1)) == 0) ? this->children[1]->evaluate() : (this->children[1]->evaluate() | ~(this->children[1]->getBitvectorMask()))) & this->getBitvectorMask());
 
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
@@ -2084,20 +2188,14 @@ namespace triton {
         this->symbolized |= this->children[index]->isSymbolized();
       }
 
+      /* Init hash */
+      this->initHash();
+
       /* Init parents */
       this->initParents();
     }
 
 
-    triton::uint512 SxNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->children.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::pow(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
-
     /* ====== Variable node */
 
 
@@ -2110,9 +2208,16 @@ namespace triton {
 
     void VariableNode::init(void) {
       this->size        = this->symVar.getSize();
-      this->eval        = ctxt.getVariableValue(this->symVar.getName()) & this->getBitvectorMask();
       this->symbolized  = true;
 
+      if (this->isNative())
+        this->eval64 = (ctxt.getVariableValue(this->symVar.getId()) & triton::ast::nativeMask(this->size)).convert_to<triton::uint64>();
+      else
+        this->wideEval() = ctxt.getVariableValue(this->symVar.getId()) & this->getBitvectorMask();
+
+      /* Init hash */
+      this->initHash(stringHash(this->symVar.getName()));
+
       /* Init parents */
       this->initParents();
     }
@@ -2123,17 +2228,6 @@ namespace triton {
     }
 
 
-    triton::uint512 VariableNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind;
-      triton::uint32 index = 1;
-
-      for (char c : this->symVar.getName())
-        h = h ^ triton::ast::pow(c, index++);
-
-      return triton::ast::rotl(h, deep);
-    }
-
-
     /* ====== zx */
 
 
@@ -2159,7 +2253,10 @@ namespace triton {
       if (size > MAX_BITS_SUPPORTED)
         throw triton::exceptions::Ast("ZxNode::init(): Size connot be greater than MAX_BITS_SUPPORTED.");
 
-      this->eval = (this->children[1]->evaluate() & this->getBitvectorMask());
+      if (this->isNative())
+        this->eval64 = this->children[1]->evaluate64();
+      else
+        this->wideEval() = (this->children[1]->evaluate() & this->getBitvectorMask());
 
       /* Init children and spread information */
       for (triton::uint32 index = 0; index < this->children.size(); index++) {
@@ -2167,19 +2264,13 @@ namespace triton {
         this->symbolized |= this->children[index]->isSymbolized();
       }
 
+      /* Init hash */
+      this->initHash();
+
       /* Init parents */
       this->initParents();
     }
 
-
-    triton::uint512 ZxNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->children.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->children.size(); index++)
-        h = h * triton::ast::pow(this->children[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
   }; /* ast namespace */
 }; /* triton namespace */
 
@@ -2234,6 +2325,23 @@ namespace triton {
       return value;
     }
 
+
+    triton::uint64 nativeMask(triton::uint32 size) {
+      if (size >= 64)
+        return std::numeric_limits<triton::uint64>::max();
+      return ((static_cast<triton::uint64>(1) << size) - 1);
+    }
+
+
+    triton::sint64 nativeSignExtend(AbstractNode* node) {
+      triton::uint64 value = node->evaluate64();
+
+      if ((value >> (node->getBitvectorSize()-1)) & 1)
+        value |= ~triton::ast::nativeMask(node->getBitvectorSize());
+
+      return static_cast<triton::sint64>(value);
+    }
+
   }; /* ast namespace */
 }; /* triton namespace */
 
@@ -2251,51 +2359,51 @@ namespace triton {
         return nullptr;
 
       switch (node->getKind()) {
-        case BVADD_NODE:                newNode = std::make_shared<BvaddNode>(*reinterpret_cast<BvaddNode*>(node)); break;
-        case BVAND_NODE:                newNode = std::make_shared<BvandNode>(*reinterpret_cast<BvandNode*>(node)); break;
-        case BVASHR_NODE:               newNode = std::make_shared<BvashrNode>(*reinterpret_cast<BvashrNode*>(node)); break;
-        case BVLSHR_NODE:               newNode = std::make_shared<BvlshrNode>(*reinterpret_cast<BvlshrNode*>(node)); break;
-        case BVMUL_NODE:                newNode = std::make_shared<BvmulNode>(*reinterpret_cast<BvmulNode*>(node)); break;
-        case BVNAND_NODE:               newNode = std::make_shared<BvnandNode>(*reinterpret_cast<BvnandNode*>(node)); break;
-        case BVNEG_NODE:                newNode = std::make_shared<BvnegNode>(*reinterpret_cast<BvnegNode*>(node)); break;
-        case BVNOR_NODE:                newNode = std::make_shared<BvnorNode>(*reinterpret_cast<BvnorNode*>(node)); break;
-        case BVNOT_NODE:                newNode = std::make_shared<BvnotNode>(*reinterpret_cast<BvnotNode*>(node)); break;
-        case BVOR_NODE:                 newNode = std::make_shared<BvorNode>(*reinterpret_cast<BvorNode*>(node)); break;
-        case BVROL_NODE:                newNode = std::make_shared<BvrolNode>(*reinterpret_cast<BvrolNode*>(node)); break;
-        case BVROR_NODE:                newNode = std::make_shared<BvrorNode>(*reinterpret_cast<BvrorNode*>(node)); break;
-        case BVSDIV_NODE:               newNode = std::make_shared<BvsdivNode>(*reinterpret_cast<BvsdivNode*>(node)); break;
-        case BVSGE_NODE:                newNode = std::make_shared<BvsgeNode>(*reinterpret_cast<BvsgeNode*>(node)); break;
-        case BVSGT_NODE:                newNode = std::make_shared<BvsgtNode>(*reinterpret_cast<BvsgtNode*>(node)); break;
-        case BVSHL_NODE:                newNode = std::make_shared<BvshlNode>(*reinterpret_cast<BvshlNode*>(node)); break;
-        case BVSLE_NODE:                newNode = std::make_shared<BvsleNode>(*reinterpret_cast<BvsleNode*>(node)); break;
-        case BVSLT_NODE:                newNode = std::make_shared<BvsltNode>(*reinterpret_cast<BvsltNode*>(node)); break;
-        case BVSMOD_NODE:               newNode = std::make_shared<BvsmodNode>(*reinterpret_cast<BvsmodNode*>(node)); break;
-        case BVSREM_NODE:               newNode = std::make_shared<BvsremNode>(*reinterpret_cast<BvsremNode*>(node)); break;
-        case BVSUB_NODE:                newNode = std::make_shared<BvsubNode>(*reinterpret_cast<BvsubNode*>(node)); break;
-        case BVUDIV_NODE:               newNode = std::make_shared<BvudivNode>(*reinterpret_cast<BvudivNode*>(node)); break;
-        case BVUGE_NODE:                newNode = std::make_shared<BvugeNode>(*reinterpret_cast<BvugeNode*>(node)); break;
-        case BVUGT_NODE:                newNode = std::make_shared<BvugtNode>(*reinterpret_cast<BvugtNode*>(node)); break;
-        case BVULE_NODE:                newNode = std::make_shared<BvuleNode>(*reinterpret_cast<BvuleNode*>(node)); break;
-        case BVULT_NODE:                newNode = std::make_shared<BvultNode>(*reinterpret_cast<BvultNode*>(node)); break;
-        case BVUREM_NODE:               newNode = std::make_shared<BvuremNode>(*reinterpret_cast<BvuremNode*>(node)); break;
-        case BVXNOR_NODE:               newNode = std::make_shared<BvxnorNode>(*reinterpret_cast<BvxnorNode*>(node)); break;
-        case BVXOR_NODE:                newNode = std::make_shared<BvxorNode>(*reinterpret_cast<BvxorNode*>(node)); break;
-        case BV_NODE:                   newNode = std::make_shared<BvNode>(*reinterpret_cast<BvNode*>(node)); break;
-        case CONCAT_NODE:               newNode = std::make_shared<ConcatNode>(*reinterpret_cast<ConcatNode*>(node)); break;
-        case DECIMAL_NODE:              newNode = std::make_shared<DecimalNode>(*reinterpret_cast<DecimalNode*>(node)); break;
-        case DISTINCT_NODE:             newNode = std::make_shared<DistinctNode>(*reinterpret_cast<DistinctNode*>(node)); break;
-        case EQUAL_NODE:                newNode = std::make_shared<EqualNode>(*reinterpret_cast<EqualNode*>(node)); break;
-        case EXTRACT_NODE:              newNode = std::make_shared<ExtractNode>(*reinterpret_cast<ExtractNode*>(node)); break;
-        case ITE_NODE:                  newNode = std::make_shared<IteNode>(*reinterpret_cast<IteNode*>(node)); break;
-        case LAND_NODE:                 newNode = std::make_shared<LandNode>(*reinterpret_cast<LandNode*>(node)); break;
-        case LET_NODE:                  newNode = std::make_shared<LetNode>(*reinterpret_cast<LetNode*>(node)); break;
-        case LNOT_NODE:                 newNode = std::make_shared<LnotNode>(*reinterpret_cast<LnotNode*>(node)); break;
-        case LOR_NODE:                  newNode = std::make_shared<LorNode>(*reinterpret_cast<LorNode*>(node)); break;
-        case REFERENCE_NODE:            newNode = std::make_shared<ReferenceNode>(*reinterpret_cast<ReferenceNode*>(node)); break;
-        case STRING_NODE:               newNode = std::make_shared<StringNode>(*reinterpret_cast<StringNode*>(node)); break;
-        case SX_NODE:                   newNode = std::make_shared<SxNode>(*reinterpret_cast<SxNode*>(node)); break;
-        case VARIABLE_NODE:             newNode = std::make_shared<VariableNode>(*reinterpret_cast<VariableNode*>(node)); break;
-        case ZX_NODE:                   newNode = std::make_shared<ZxNode>(*reinterpret_cast<ZxNode*>(node)); break;
+        case BVADD_NODE:                newNode = std::allocate_shared<BvaddNode>(node->getContext().getNodeAllocator(), *reinterpret_cast<BvaddNode*>(node)); break;
+        case BVAND_NODE:                newNode = std::allocate_shared<BvandNode>(node->getContext().getNodeAllocator(), *reinterpret_cast<BvandNode*>(node)); break;
+        case BVASHR_NODE:               newNode = std::allocate_shared<BvashrNode>(node->getContext().getNodeAllocator(), *reinterpret_cast<BvashrNode*>(node)); break;
+        case BVLSHR_NODE:               newNode = std::allocate_shared<BvlshrNode>(node->getContext().getNodeAllocator(), *reinterpret_cast<BvlshrNode*>(node)); break;
+        case BVMUL_NODE:                newNode = std::allocate_shared<BvmulNode>(node->getContext().getNodeAllocator(), *reinterpret_cast<BvmulNode*>(node)); break;
+        case BVNAND_NODE:               newNode = std::allocate_shared<BvnandNode>(node->getContext().getNodeAllocator(), *reinterpret_cast<BvnandNode*>(node)); break;
+        case BVNEG_NODE:                newNode = std::allocate_shared<BvnegNode>(node->getContext().getNodeAllocator(), *reinterpret_cast<BvnegNode*>(node)); break;
+        case BVNOR_NODE:                newNode = std::allocate_shared<BvnorNode>(node->getContext().getNodeAllocator(), *reinterpret_cast<BvnorNode*>(node)); break;
+        case BVNOT_NODE:                newNode = std::allocate_shared<BvnotNode>(node->getContext().getNodeAllocator(), *reinterpret_cast<BvnotNode*>(node)); break;
+        case BVOR_NODE:                 newNode = std::allocate_shared<BvorNode>(node->getContext().getNodeAllocator(), *reinterpret_cast<BvorNode*>(node)); break;
+        case BVROL_NODE:                newNode = std::allocate_shared<BvrolNode>(node->getContext().getNodeAllocator(), *reinterpret_cast<BvrolNode*>(node)); break;
+        case BVROR_NODE:                newNode = std::allocate_shared<BvrorNode>(node->getContext().getNodeAllocator(), *reinterpret_cast<BvrorNode*>(node)); break;
+        case BVSDIV_NODE:               newNode = std::allocate_shared<BvsdivNode>(node->getContext().getNodeAllocator(), *reinterpret_cast<BvsdivNode*>(node)); break;
+        case BVSGE_NODE:                newNode = std::allocate_shared<BvsgeNode>(node->getContext().getNodeAllocator(), *reinterpret_cast<BvsgeNode*>(node)); break;
+        case BVSGT_NODE:                newNode = std::allocate_shared<BvsgtNode>(node->getContext().getNodeAllocator(), *reinterpret_cast<BvsgtNode*>(node)); break;
+        case BVSHL_NODE:                newNode = std::allocate_shared<BvshlNode>(node->getContext().getNodeAllocator(), *reinterpret_cast<BvshlNode*>(node)); break;
+        case BVSLE_NODE:                newNode = std::allocate_shared<BvsleNode>(node->getContext().getNodeAllocator(), *reinterpret_cast<BvsleNode*>(node)); break;
+        case BVSLT_NODE:                newNode = std::allocate_shared<BvsltNode>(node->getContext().getNodeAllocator(), *reinterpret_cast<BvsltNode*>(node)); break;
+        case BVSMOD_NODE:               newNode = std::allocate_shared<BvsmodNode>(node->getContext().getNodeAllocator(), *reinterpret_cast<BvsmodNode*>(node)); break;
+        case BVSREM_NODE:               newNode = std::allocate_shared<BvsremNode>(node->getContext().getNodeAllocator(), *reinterpret_cast<BvsremNode*>(node)); break;
+        case BVSUB_NODE:                newNode = std::allocate_shared<BvsubNode>(node->getContext().getNodeAllocator(), *reinterpret_cast<BvsubNode*>(node)); break;
+        case BVUDIV_NODE:               newNode = std::allocate_shared<BvudivNode>(node->getContext().getNodeAllocator(), *reinterpret_cast<BvudivNode*>(node)); break;
+        case BVUGE_NODE:                newNode = std::allocate_shared<BvugeNode>(node->getContext().getNodeAllocator(), *reinterpret_cast<BvugeNode*>(node)); break;
+        case BVUGT_NODE:                newNode = std::allocate_shared<BvugtNode>(node->getContext().getNodeAllocator(), *reinterpret_cast<BvugtNode*>(node)); break;
+        case BVULE_NODE:                newNode = std::allocate_shared<BvuleNode>(node->getContext().getNodeAllocator(), *reinterpret_cast<BvuleNode*>(node)); break;
+        case BVULT_NODE:                newNode = std::allocate_shared<BvultNode>(node->getContext().getNodeAllocator(), *reinterpret_cast<BvultNode*>(node)); break;
+        case BVUREM_NODE:               newNode = std::allocate_shared<BvuremNode>(node->getContext().getNodeAllocator(), *reinterpret_cast<BvuremNode*>(node)); break;
+        case BVXNOR_NODE:               newNode = std::allocate_shared<BvxnorNode>(node->getContext().getNodeAllocator(), *reinterpret_cast<BvxnorNode*>(node)); break;
+        case BVXOR_NODE:                newNode = std::allocate_shared<BvxorNode>(node->getContext().getNodeAllocator(), *reinterpret_cast<BvxorNode*>(node)); break;
+        case BV_NODE:                   newNode = std::allocate_shared<BvNode>(node->getContext().getNodeAllocator(), *reinterpret_cast<BvNode*>(node)); break;
+        case CONCAT_NODE:               newNode = std::allocate_shared<ConcatNode>(node->getContext().getNodeAllocator(), *reinterpret_cast<ConcatNode*>(node)); break;
+        case DECIMAL_NODE:              newNode = std::allocate_shared<DecimalNode>(node->getContext().getNodeAllocator(), *reinterpret_cast<DecimalNode*>(node)); break;
+        case DISTINCT_NODE:             newNode = std::allocate_shared<DistinctNode>(node->getContext().getNodeAllocator(), *reinterpret_cast<DistinctNode*>(node)); break;
+        case EQUAL_NODE:                newNode = std::allocate_shared<EqualNode>(node->getContext().getNodeAllocator(), *reinterpret_cast<EqualNode*>(node)); break;
+        case EXTRACT_NODE:              newNode = std::allocate_shared<ExtractNode>(node->getContext().getNodeAllocator(), *reinterpret_cast<ExtractNode*>(node)); break;
+        case ITE_NODE:                  newNode = std::allocate_shared<IteNode>(node->getContext().getNodeAllocator(), *reinterpret_cast<IteNode*>(node)); break;
+        case LAND_NODE:                 newNode = std::allocate_shared<LandNode>(node->getContext().getNodeAllocator(), *reinterpret_cast<LandNode*>(node)); break;
+        case LET_NODE:                  newNode = std::allocate_shared<LetNode>(node->getContext().getNodeAllocator(), *reinterpret_cast<LetNode*>(node)); break;
+        case LNOT_NODE:                 newNode = std::allocate_shared<LnotNode>(node->getContext().getNodeAllocator(), *reinterpret_cast<LnotNode*>(node)); break;
+        case LOR_NODE:                  newNode = std::allocate_shared<LorNode>(node->getContext().getNodeAllocator(), *reinterpret_cast<LorNode*>(node)); break;
+        case REFERENCE_NODE:            newNode = std::allocate_shared<ReferenceNode>(node->getContext().getNodeAllocator(), *reinterpret_cast<ReferenceNode*>(node)); break;
+        case STRING_NODE:               newNode = std::allocate_shared<StringNode>(node->getContext().getNodeAllocator(), *reinterpret_cast<StringNode*>(node)); break;
+        case SX_NODE:                   newNode = std::allocate_shared<SxNode>(node->getContext().getNodeAllocator(), *reinterpret_cast<SxNode*>(node)); break;
+        case VARIABLE_NODE:             newNode = std::allocate_shared<VariableNode>(node->getContext().getNodeAllocator(), *reinterpret_cast<VariableNode*>(node)); break;
+        case ZX_NODE:                   newNode = std::allocate_shared<ZxNode>(node->getContext().getNodeAllocator(), *reinterpret_cast<ZxNode*>(node)); break;
         default:
           throw triton::exceptions::Ast("triton::ast::newInstance(): Invalid kind node.");
       }
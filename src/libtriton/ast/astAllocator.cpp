@@ -0,0 +1,99 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <cstring>
+#include <new>
+
+#include <triton/astAllocator.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+
+    NodePool::NodePool() {
+      std::memset(this->freeLists, 0x00, sizeof(this->freeLists));
+      this->cursor = nullptr;
+      this->end    = nullptr;
+      this->blocks   = 0;
+      this->orphaned = false;
+    }
+
+
+    NodePool::~NodePool() {
+      for (triton::uint8* slab : this->slabs)
+        ::operator delete(slab);
+    }
+
+
+    void NodePool::release(void) {
+      if (this->blocks == 0)
+        delete this;
+      else
+        this->orphaned = true;
+    }
+
+
+    void* NodePool::allocate(triton::usize size) {
+      this->blocks++;
+
+      if (size == 0 || size > NODE_POOL_MAX_BLOCK_SIZE)
+        return ::operator new(size);
+
+      triton::usize index = (size - 1) / NODE_POOL_ALIGNMENT;
+
+      /* Reuse a freed block of the same size class */
+      if (this->freeLists[index]) {
+        void* block = this->freeLists[index];
+        this->freeLists[index] = *static_cast<void**>(block);
+        return block;
+      }
+
+      /* Carve a new block from the current slab */
+      triton::usize blockSize = (index + 1) * NODE_POOL_ALIGNMENT;
+      if (this->cursor == nullptr || static_cast<triton::usize>(this->end - this->cursor) < blockSize) {
+        this->cursor = static_cast<triton::uint8*>(::operator new(NODE_POOL_SLAB_SIZE));
+        this->end    = this->cursor + NODE_POOL_SLAB_SIZE;
+        this->slabs.push_back(this->cursor);
+      }
+
+      void* block = this->cursor;
+      this->cursor += blockSize;
+
+      return block;
+    }
+
+
+    void NodePool::deallocate(void* block, triton::usize size) {
+      this->blocks--;
+
+      if (size == 0 || size > NODE_POOL_MAX_BLOCK_SIZE) {
+        ::operator delete(block);
+      }
+      else {
+        triton::usize index = (size - 1) / NODE_POOL_ALIGNMENT;
+        *static_cast<void**>(block) = this->freeLists[index];
+        this->freeLists[index] = block;
+      }
+
+      /* The last node of a released pool */
+      if (this->blocks == 0 && this->orphaned)
+        delete this;
+    }
+
+
+    triton::usize NodePool::getNumberOfBlocks(void) const {
+      return this->blocks;
+    }
+
+
+    triton::usize NodePool::getNumberOfSlabs(void) const {
+      return this->slabs.size();
+    }
+
+  }; /* ast namespace */
+}; /* triton namespace */
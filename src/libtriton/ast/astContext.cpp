@@ -5,349 +5,468 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <algorithm>
+
 #include <triton/ast.hpp>
 #include <triton/astContext.hpp>
 #include <triton/exceptions.hpp>
+#include <triton/symbolicEngine.hpp>
 
 
 
 namespace triton {
   namespace ast {
 
-    AstContext::AstContext() {
+    /* The minimal size of the table of interned nodes before removing expired nodes */
+    const triton::usize INTERNED_NODES_MIN_SWEEP = 0x1000;
+
+
+    AstContext::AstContext()
+      : allocator(new NodePool()) {
+      this->hashConsing    = false;
+      this->internedSweep  = INTERNED_NODES_MIN_SWEEP;
+      this->symbolicEngine = nullptr;
     }
 
 
     AstContext::AstContext(const AstContext& other)
       : astRepresentation(other.astRepresentation),
-        valueMapping(other.valueMapping) {
+        valueMapping(other.valueMapping),
+        allocator(new NodePool()) {
+      /* Interned nodes belong to the other context */
+      this->hashConsing    = other.hashConsing;
+      this->internedSweep  = INTERNED_NODES_MIN_SWEEP;
+      this->symbolicEngine = other.symbolicEngine;
     }
 
 
     AstContext::~AstContext() {
       this->valueMapping.clear();
+      this->internedNodes.clear();
+      this->allocator.getPool()->release();
     }
 
 
     AstContext& AstContext::operator=(const AstContext& other) {
       this->astRepresentation = other.astRepresentation;
       this->valueMapping = other.valueMapping;
+      this->hashConsing = other.hashConsing;
+      this->internedNodes.clear();
+      this->internedSweep = INTERNED_NODES_MIN_SWEEP;
+      this->symbolicEngine = other.symbolicEngine;
       return *this;
     }
 
 
+    /* Returns true if two initialized nodes are structurally identical */
+    static bool isSameNode(AbstractNode* a, AbstractNode* b) {
+      if (a->getKind() != b->getKind() || a->getBitvectorSize() != b->getBitvectorSize() || a->getHash() != b->getHash())
+        return false;
+
+      switch (a->getKind()) {
+        case DECIMAL_NODE:
+          return reinterpret_cast<DecimalNode*>(a)->getValue() == reinterpret_cast<DecimalNode*>(b)->getValue();
+
+        case REFERENCE_NODE:
+          return reinterpret_cast<ReferenceNode*>(a)->getSymbolicExpression() == reinterpret_cast<ReferenceNode*>(b)->getSymbolicExpression();
+
+        case STRING_NODE:
+          return reinterpret_cast<StringNode*>(a)->getValue() == reinterpret_cast<StringNode*>(b)->getValue();
+
+        case VARIABLE_NODE:
+          return &reinterpret_cast<VariableNode*>(a)->getVar() == &reinterpret_cast<VariableNode*>(b)->getVar();
+
+        default:
+          break;
+      }
+
+      const ChildVector& ca = a->getChildren();
+      const ChildVector& cb = b->getChildren();
+
+      if (ca.size() != cb.size())
+        return false;
+
+      for (triton::uint32 index = 0; index < ca.size(); index++) {
+        if (ca[index] != cb[index])
+          return false;
+      }
+
+      return true;
+    }
+
+
+    SharedAbstractNode AstContext::intern(const SharedAbstractNode& node) {
+      if (this->hashConsing == false)
+        return node;
+
+      triton::uint64 key = node->getHash();
+      auto range = this->internedNodes.equal_range(key);
+
+      for (auto it = range.first; it != range.second;) {
+        SharedAbstractNode other = it->second.lock();
+        if (other == nullptr) {
+          it = this->internedNodes.erase(it);
+          continue;
+        }
+        /* The new node is dropped, its children forget it when they compact their parents */
+        if (isSameNode(other.get(), node.get()))
+          return other;
+        ++it;
+      }
+
+      /* Remove expired nodes when the table has grown enough since the last sweep */
+      if (this->internedNodes.size() >= this->internedSweep) {
+        for (auto it = this->internedNodes.begin(); it != this->internedNodes.end();) {
+          if (it->second.expired())
+            it = this->internedNodes.erase(it);
+          else
+            ++it;
+        }
+        this->internedSweep = std::max(INTERNED_NODES_MIN_SWEEP, this->internedNodes.size() * 2);
+      }
+
+      this->internedNodes.insert(std::make_pair(key, WeakAbstractNode(node)));
+
+      return node;
+    }
+
+
+    void AstContext::enableHashConsing(bool flag) {
+      this->hashConsing = flag;
+      if (flag == false) {
+        this->internedNodes.clear();
+        this->internedSweep = INTERNED_NODES_MIN_SWEEP;
+      }
+    }
+
+
+    bool AstContext::isHashConsingEnabled(void) const {
+      return this->hashConsing;
+    }
+
+
+    triton::usize AstContext::getNumberOfInternedNodes(void) const {
+      return this->internedNodes.size();
+    }
+
+
+    const NodeAllocator<AbstractNode>& AstContext::getNodeAllocator(void) const {
+      return this->allocator;
+    }
+
+
     SharedAbstractNode AstContext::bv(triton::uint512 value, triton::uint32 size) {
-      SharedAbstractNode node = std::make_shared<BvNode>(value, size, *this);
+      SharedAbstractNode node = std::allocate_shared<BvNode>(this->allocator, value, size, *this);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
     SharedAbstractNode AstContext::bvadd(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvaddNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<BvaddNode>(this->allocator, expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
     SharedAbstractNode AstContext::bvand(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvandNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<BvandNode>(this->allocator, expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
     SharedAbstractNode AstContext::bvashr(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvashrNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<BvashrNode>(this->allocator, expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
     SharedAbstractNode AstContext::bvfalse(void) {
-      SharedAbstractNode node = std::make_shared<BvNode>(0, 1, *this);
+      SharedAbstractNode node = std::allocate_shared<BvNode>(this->allocator, 0, 1, *this);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
     SharedAbstractNode AstContext::bvlshr(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvlshrNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<BvlshrNode>(this->allocator, expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
     SharedAbstractNode AstContext::bvmul(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvmulNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<BvmulNode>(this->allocator, expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
     SharedAbstractNode AstContext::bvnand(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvnandNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<BvnandNode>(this->allocator, expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
     SharedAbstractNode AstContext::bvneg(const SharedAbstractNode& expr) {
-      SharedAbstractNode node = std::make_shared<BvnegNode>(expr);
+      SharedAbstractNode node = std::allocate_shared<BvnegNode>(this->allocator, expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
     SharedAbstractNode AstContext::bvnor(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvnorNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<BvnorNode>(this->allocator, expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
     SharedAbstractNode AstContext::bvnot(const SharedAbstractNode& expr) {
-      SharedAbstractNode node = std::make_shared<BvnotNode>(expr);
+      SharedAbstractNode node = std::allocate_shared<BvnotNode>(this->allocator, expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
     SharedAbstractNode AstContext::bvor(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvorNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<BvorNode>(this->allocator, expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
     SharedAbstractNode AstContext::bvrol(triton::uint32 rot, const SharedAbstractNode& expr) {
-      SharedAbstractNode node = std::make_shared<BvrolNode>(rot, expr);
+      SharedAbstractNode node = std::allocate_shared<BvrolNode>(this->allocator, rot, expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
     SharedAbstractNode AstContext::bvrol(const SharedAbstractNode& rot, const SharedAbstractNode& expr) {
-      SharedAbstractNode node = std::make_shared<BvrolNode>(rot, expr);
+      SharedAbstractNode node = std::allocate_shared<BvrolNode>(this->allocator, rot, expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
     SharedAbstractNode AstContext::bvror(triton::uint32 rot, const SharedAbstractNode& expr) {
-      SharedAbstractNode node = std::make_shared<BvrorNode>(rot, expr);
+      SharedAbstractNode node = std::allocate_shared<BvrorNode>(this->allocator, rot, expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
     SharedAbstractNode AstContext::bvror(const SharedAbstractNode& rot, const SharedAbstractNode& expr) {
-      SharedAbstractNode node = std::make_shared<BvrorNode>(rot, expr);
+      SharedAbstractNode node = std::allocate_shared<BvrorNode>(this->allocator, rot, expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
     SharedAbstractNode AstContext::bvsdiv(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvsdivNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<BvsdivNode>(this->allocator, expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
     SharedAbstractNode AstContext::bvsge(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvsgeNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<BvsgeNode>(this->allocator, expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
     SharedAbstractNode AstContext::bvsgt(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvsgtNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<BvsgtNode>(this->allocator, expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
     SharedAbstractNode AstContext::bvshl(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvshlNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<BvshlNode>(this->allocator, expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
     SharedAbstractNode AstContext::bvsle(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvsleNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<BvsleNode>(this->allocator, expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
     SharedAbstractNode AstContext::bvslt(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvsltNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<BvsltNode>(this->allocator, expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
     SharedAbstractNode AstContext::bvsmod(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvsmodNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<BvsmodNode>(this->allocator, expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
     SharedAbstractNode AstContext::bvsrem(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvsremNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<BvsremNode>(this->allocator, expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
     SharedAbstractNode AstContext::bvsub(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvsubNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<BvsubNode>(this->allocator, expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
     SharedAbstractNode AstContext::bvtrue(void) {
-      SharedAbstractNode node = std::make_shared<BvNode>(1, 1, *this);
+      SharedAbstractNode node = std::allocate_shared<BvNode>(this->allocator, 1, 1, *this);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
     SharedAbstractNode AstContext::bvudiv(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvudivNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<BvudivNode>(this->allocator, expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
     SharedAbstractNode AstContext::bvuge(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvugeNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<BvugeNode>(this->allocator, expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
     SharedAbstractNode AstContext::bvugt(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvugtNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<BvugtNode>(this->allocator, expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
     SharedAbstractNode AstContext::bvule(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvuleNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<BvuleNode>(this->allocator, expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
     SharedAbstractNode AstContext::bvult(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvultNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<BvultNode>(this->allocator, expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
     SharedAbstractNode AstContext::bvurem(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvuremNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<BvuremNode>(this->allocator, expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
      SharedAbstractNode AstContext::bvxnor(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvxnorNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<BvxnorNode>(this->allocator, expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
     SharedAbstractNode AstContext::bvxor(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<BvxorNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<BvxorNode>(this->allocator, expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
     SharedAbstractNode AstContext::concat(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<ConcatNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<ConcatNode>(this->allocator, expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
@@ -355,38 +474,38 @@ namespace triton {
     template TRITON_EXPORT SharedAbstractNode AstContext::concat(const std::list<SharedAbstractNode>& exprs);
     template <typename T>
     SharedAbstractNode AstContext::concat(const T& exprs) {
-      SharedAbstractNode node = std::make_shared<ConcatNode>(exprs, *this);
+      SharedAbstractNode node = std::allocate_shared<ConcatNode>(this->allocator, exprs, *this);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
     SharedAbstractNode AstContext::decimal(triton::uint512 value) {
-      SharedAbstractNode node = std::make_shared<DecimalNode>(value, *this);
+      SharedAbstractNode node = std::allocate_shared<DecimalNode>(this->allocator, value, *this);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
     SharedAbstractNode AstContext::distinct(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<DistinctNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<DistinctNode>(this->allocator, expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
     SharedAbstractNode AstContext::equal(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<EqualNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<EqualNode>(this->allocator, expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
@@ -395,31 +514,31 @@ namespace triton {
       if (low == 0 && (high + 1) == expr->getBitvectorSize())
         return expr;
 
-      SharedAbstractNode node = std::make_shared<ExtractNode>(high, low, expr);
+      SharedAbstractNode node = std::allocate_shared<ExtractNode>(this->allocator, high, low, expr);
 
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
 
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
     SharedAbstractNode AstContext::ite(const SharedAbstractNode& ifExpr, const SharedAbstractNode& thenExpr, const SharedAbstractNode& elseExpr) {
-      SharedAbstractNode node = std::make_shared<IteNode>(ifExpr, thenExpr, elseExpr);
+      SharedAbstractNode node = std::allocate_shared<IteNode>(this->allocator, ifExpr, thenExpr, elseExpr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
     SharedAbstractNode AstContext::land(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<LandNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<LandNode>(this->allocator, expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
@@ -427,38 +546,38 @@ namespace triton {
     template TRITON_EXPORT SharedAbstractNode AstContext::land(const std::list<SharedAbstractNode>& exprs);
     template <typename T>
     SharedAbstractNode AstContext::land(const T& exprs) {
-      SharedAbstractNode node = std::make_shared<LandNode>(exprs, *this);
+      SharedAbstractNode node = std::allocate_shared<LandNode>(this->allocator, exprs, *this);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
     SharedAbstractNode AstContext::let(std::string alias, const SharedAbstractNode& expr2, const SharedAbstractNode& expr3) {
-      SharedAbstractNode node = std::make_shared<LetNode>(alias, expr2, expr3);
+      SharedAbstractNode node = std::allocate_shared<LetNode>(this->allocator, alias, expr2, expr3);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
     SharedAbstractNode AstContext::lnot(const SharedAbstractNode& expr) {
-      SharedAbstractNode node = std::make_shared<LnotNode>(expr);
+      SharedAbstractNode node = std::allocate_shared<LnotNode>(this->allocator, expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
     SharedAbstractNode AstContext::lor(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2) {
-      SharedAbstractNode node = std::make_shared<LorNode>(expr1, expr2);
+      SharedAbstractNode node = std::allocate_shared<LorNode>(this->allocator, expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
@@ -466,29 +585,29 @@ namespace triton {
     template TRITON_EXPORT SharedAbstractNode AstContext::lor(const std::list<SharedAbstractNode>& exprs);
     template <typename T>
     SharedAbstractNode AstContext::lor(const T& exprs) {
-      SharedAbstractNode node = std::make_shared<LorNode>(exprs, *this);
+      SharedAbstractNode node = std::allocate_shared<LorNode>(this->allocator, exprs, *this);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
     SharedAbstractNode AstContext::reference(const triton::engines::symbolic::SharedSymbolicExpression& expr) {
-      SharedAbstractNode node = std::make_shared<ReferenceNode>(expr);
+      SharedAbstractNode node = std::allocate_shared<ReferenceNode>(this->allocator, expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
     SharedAbstractNode AstContext::string(std::string value) {
-      SharedAbstractNode node = std::make_shared<StringNode>(value, *this);
+      SharedAbstractNode node = std::allocate_shared<StringNode>(this->allocator, value, *this);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
@@ -497,22 +616,20 @@ namespace triton {
       if (sizeExt == 0)
         return expr;
 
-      SharedAbstractNode node = std::make_shared<SxNode>(sizeExt, expr);
+      SharedAbstractNode node = std::allocate_shared<SxNode>(this->allocator, sizeExt, expr);
 
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
 
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
     SharedAbstractNode AstContext::variable(triton::engines::symbolic::SymbolicVariable& symVar) {
       // try to get node from variable pool
-      auto it = this->valueMapping.find(symVar.getName());
-      if (it != this->valueMapping.end()) {
-        auto& node = it->second.first;
-
+      SharedAbstractNode node = this->getVariableNode(symVar.getId());
+      if (node != nullptr) {
         if (node->getBitvectorSize() != symVar.getSize())
           throw triton::exceptions::Ast("Node builders - Missmatching variable size.");
 
@@ -522,8 +639,8 @@ namespace triton {
       }
       else {
         // if not found, create a new variable node
-        SharedAbstractNode node = std::make_shared<VariableNode>(symVar, *this);
-        this->initVariable(symVar.getName(), 0, node);
+        node = std::allocate_shared<VariableNode>(this->allocator, symVar, *this);
+        this->initVariable(symVar.getId(), 0, node);
         if (node == nullptr)
           throw triton::exceptions::Ast("Node builders - Not enough memory");
         node->init();
@@ -537,47 +654,90 @@ namespace triton {
       if (sizeExt == 0)
         return expr;
 
-      SharedAbstractNode node = std::make_shared<ZxNode>(sizeExt, expr);
+      SharedAbstractNode node = std::allocate_shared<ZxNode>(this->allocator, sizeExt, expr);
 
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
 
       node->init();
-      return node;
+      return this->intern(node);
     }
 
 
-    void AstContext::initVariable(const std::string& name, const triton::uint512& value, const SharedAbstractNode& node) {
-      auto it = this->valueMapping.find(name);
-      if (it == this->valueMapping.end())
-        this->valueMapping.insert(std::make_pair(name, std::make_pair(node, value)));
-      else
+    void AstContext::initVariable(triton::usize id, const triton::uint512& value, const SharedAbstractNode& node) {
+      if (id >= this->valueMapping.size())
+        this->valueMapping.resize(id + 1);
+
+      auto& kv = this->valueMapping[id];
+      if (kv.first != nullptr)
         throw triton::exceptions::Ast("Ast variable already initialized");
+
+      kv.first  = node;
+      kv.second = value;
     }
 
 
-    void AstContext::updateVariable(const std::string& name, const triton::uint512& value) {
-      auto& kv = this->valueMapping.at(name);
+    void AstContext::initVariable(const std::string& name, const triton::uint512& value, const SharedAbstractNode& node) {
+      this->initVariable(this->getVariableId(name, "AstContext::initVariable()"), value, node);
+    }
+
+
+    void AstContext::updateVariable(triton::usize id, const triton::uint512& value) {
+      if (id >= this->valueMapping.size() || this->valueMapping[id].first == nullptr)
+        throw triton::exceptions::Ast("AstContext::updateVariable(): Variable doesn't exists");
+
+      auto& kv = this->valueMapping[id];
       kv.second = value;
       kv.first->init();
     }
 
 
-    SharedAbstractNode AstContext::getVariableNode(const std::string& name) {
-      auto it = this->valueMapping.find(name);
-      if (it == this->valueMapping.end())
+    void AstContext::updateVariable(const std::string& name, const triton::uint512& value) {
+      this->updateVariable(this->getVariableId(name, "AstContext::updateVariable()"), value);
+    }
+
+
+    void AstContext::removeVariable(triton::usize id) {
+      if (id < this->valueMapping.size())
+        this->valueMapping[id] = std::make_pair(nullptr, 0);
+    }
+
+
+    SharedAbstractNode AstContext::getVariableNode(triton::usize id) {
+      if (id >= this->valueMapping.size())
         return nullptr;
-      else
-        return it->second.first;
+      return this->valueMapping[id].first;
     }
 
 
-    const triton::uint512& AstContext::getVariableValue(const std::string& varName) const {
-      try {
-        return this->valueMapping.at(varName).second;
-      } catch (const std::out_of_range&) {
+    const triton::uint512& AstContext::getVariableValue(triton::usize id) const {
+      if (id >= this->valueMapping.size() || this->valueMapping[id].first == nullptr)
         throw triton::exceptions::Ast("AstContext::getVariableValue(): Variable doesn't exists");
-      }
+      return this->valueMapping[id].second;
+    }
+
+
+    const triton::uint512& AstContext::getVariableValue(const std::string& varName) const {
+      return this->getVariableValue(this->getVariableId(varName, "AstContext::getVariableValue()"));
+    }
+
+
+    void AstContext::setSymbolicEngine(const triton::engines::symbolic::SymbolicEngine* engine) {
+      this->symbolicEngine = engine;
+    }
+
+
+    triton::usize AstContext::getVariableId(const std::string& name, const char* where) const {
+      /* The names are indexed by the symbolic engine */
+      const triton::engines::symbolic::SymbolicVariable* symVar = nullptr;
+
+      if (this->symbolicEngine != nullptr)
+        symVar = this->symbolicEngine->getSymbolicVariableFromName(name);
+
+      if (symVar == nullptr)
+        throw triton::exceptions::Ast(std::string(where) + ": Variable doesn't exists");
+
+      return symVar->getId();
     }
 
 
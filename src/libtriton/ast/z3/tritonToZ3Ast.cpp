@@ -14,13 +14,28 @@
 namespace triton {
   namespace ast {
 
-    TritonToZ3Ast::TritonToZ3Ast(triton::engines::symbolic::SymbolicEngine* symbolicEngine, bool eval)
+    TritonToZ3Ast::TritonToZ3Ast(triton::engines::symbolic::SymbolicEngine* symbolicEngine, bool eval, bool persistent)
       : context() {
       if (symbolicEngine == nullptr)
         throw triton::exceptions::AstTranslations("TritonToZ3Ast::TritonToZ3Ast(): The symbolicEngine API cannot be null.");
 
+      /* The concrete values of the variables may change between two evaluations */
+      if (eval && persistent)
+        throw triton::exceptions::AstTranslations("TritonToZ3Ast::TritonToZ3Ast(): A persistent converter cannot be used to evaluate nodes.");
+
       this->symbolicEngine = symbolicEngine;
       this->isEval = eval;
+      this->isPersistent = persistent;
+    }
+
+
+    z3::context& TritonToZ3Ast::getContext(void) {
+      return this->context;
+    }
+
+
+    triton::usize TritonToZ3Ast::getNumberOfConvertedExpressions(void) const {
+      return this->isPersistent ? this->exprs.size() : 0;
     }
 
 
@@ -43,117 +58,149 @@ namespace triton {
 
 
     z3::expr TritonToZ3Ast::convert(const triton::ast::SharedAbstractNode& node) {
+      /*
+       * The caches are only valid during one conversion (e.g. variables may be concretized, nodes
+       * may be freed). A persistent converter keeps the symbolic expressions which are checked
+       * against their current ast.
+       */
+      this->nodes.clear();
+      if (!this->isPersistent)
+        this->exprs.clear();
+
+      z3::expr expr = this->translate(node);
+
+      this->nodes.clear();
+      if (!this->isPersistent)
+        this->exprs.clear();
+
+      return expr;
+    }
+
+
+    z3::expr TritonToZ3Ast::translate(const triton::ast::SharedAbstractNode& node) {
       if (node == nullptr)
         throw triton::exceptions::AstTranslations("TritonToZ3Ast::convert(): node cannot be null.");
 
+      auto it = this->nodes.find(node.get());
+      if (it != this->nodes.end())
+        return it->second;
+
+      z3::expr expr = this->translateNode(node);
+      this->nodes.insert(std::make_pair(node.get(), expr));
+
+      return expr;
+    }
+
+
+    z3::expr TritonToZ3Ast::translateNode(const triton::ast::SharedAbstractNode& node) {
       switch (node->getKind()) {
         case BVADD_NODE:
-          return to_expr(this->context, Z3_mk_bvadd(this->context, this->convert(node->getChildren()[0]), this->convert(node->getChildren()[1])));
+          return to_expr(this->context, Z3_mk_bvadd(this->context, this->translate(node->getChildren()[0]), this->translate(node->getChildren()[1])));
 
         case BVAND_NODE:
-          return to_expr(this->context, Z3_mk_bvand(this->context, this->convert(node->getChildren()[0]), this->convert(node->getChildren()[1])));
+          return to_expr(this->context, Z3_mk_bvand(this->context, this->translate(node->getChildren()[0]), this->translate(node->getChildren()[1])));
 
         case BVASHR_NODE:
-          return to_expr(this->context, Z3_mk_bvashr(this->context, this->convert(node->getChildren()[0]), this->convert(node->getChildren()[1])));
+          return to_expr(this->context, Z3_mk_bvashr(this->context, this->translate(node->getChildren()[0]), this->translate(node->getChildren()[1])));
 
         case BVLSHR_NODE:
-          return to_expr(this->context, Z3_mk_bvlshr(this->context, this->convert(node->getChildren()[0]), this->convert(node->getChildren()[1])));
+          return to_expr(this->context, Z3_mk_bvlshr(this->context, this->translate(node->getChildren()[0]), this->translate(node->getChildren()[1])));
 
         case BVMUL_NODE:
-          return to_expr(this->context, Z3_mk_bvmul(this->context, this->convert(node->getChildren()[0]), this->convert(node->getChildren()[1])));
+          return to_expr(this->context, Z3_mk_bvmul(this->context, this->translate(node->getChildren()[0]), this->translate(node->getChildren()[1])));
 
         case BVNAND_NODE:
-          return to_expr(this->context, Z3_mk_bvnand(this->context, this->convert(node->getChildren()[0]), this->convert(node->getChildren()[1])));
+          return to_expr(this->context, Z3_mk_bvnand(this->context, this->translate(node->getChildren()[0]), this->translate(node->getChildren()[1])));
 
         case BVNEG_NODE:
-          return to_expr(this->context, Z3_mk_bvneg(this->context, this->convert(node->getChildren()[0])));
+          return to_expr(this->context, Z3_mk_bvneg(this->context, this->translate(node->getChildren()[0])));
 
         case BVNOR_NODE:
-          return to_expr(this->context, Z3_mk_bvnor(this->context, this->convert(node->getChildren()[0]), this->convert(node->getChildren()[1])));
+          return to_expr(this->context, Z3_mk_bvnor(this->context, this->translate(node->getChildren()[0]), this->translate(node->getChildren()[1])));
 
         case BVNOT_NODE:
-          return to_expr(this->context, Z3_mk_bvnot(this->context, this->convert(node->getChildren()[0])));
+          return to_expr(this->context, Z3_mk_bvnot(this->context, this->translate(node->getChildren()[0])));
 
         case BVOR_NODE:
-          return to_expr(this->context, Z3_mk_bvor(this->context, this->convert(node->getChildren()[0]), this->convert(node->getChildren()[1])));
+          return to_expr(this->context, Z3_mk_bvor(this->context, this->translate(node->getChildren()[0]), this->translate(node->getChildren()[1])));
 
         case BVROL_NODE: {
           triton::uint32 op1 = reinterpret_cast<triton::ast::DecimalNode*>(node->getChildren()[0].get())->getValue().convert_to<triton::uint32>();
-          return to_expr(this->context, Z3_mk_rotate_left(this->context, op1, this->convert(node->getChildren()[1])));
+          return to_expr(this->context, Z3_mk_rotate_left(this->context, op1, this->translate(node->getChildren()[1])));
         }
 
         case BVROR_NODE: {
           triton::uint32 op1 = reinterpret_cast<triton::ast::DecimalNode*>(node->getChildren()[0].get())->getValue().convert_to<triton::uint32>();
-          return to_expr(this->context, Z3_mk_rotate_right(this->context, op1, this->convert(node->getChildren()[1])));
+          return to_expr(this->context, Z3_mk_rotate_right(this->context, op1, this->translate(node->getChildren()[1])));
         }
 
         case BVSDIV_NODE:
-          return to_expr(this->context, Z3_mk_bvsdiv(this->context, this->convert(node->getChildren()[0]), this->convert(node->getChildren()[1])));
+          return to_expr(this->context, Z3_mk_bvsdiv(this->context, this->translate(node->getChildren()[0]), this->translate(node->getChildren()[1])));
 
         case BVSGE_NODE:
-          return to_expr(this->context, Z3_mk_bvsge(this->context, this->convert(node->getChildren()[0]), this->convert(node->getChildren()[1])));
+          return to_expr(this->context, Z3_mk_bvsge(this->context, this->translate(node->getChildren()[0]), this->translate(node->getChildren()[1])));
 
         case BVSGT_NODE:
-          return to_expr(this->context, Z3_mk_bvsgt(this->context, this->convert(node->getChildren()[0]), this->convert(node->getChildren()[1])));
+          return to_expr(this->context, Z3_mk_bvsgt(this->context, this->translate(node->getChildren()[0]), this->translate(node->getChildren()[1])));
 
         case BVSHL_NODE:
-          return to_expr(this->context, Z3_mk_bvshl(this->context, this->convert(node->getChildren()[0]), this->convert(node->getChildren()[1])));
+          return to_expr(this->context, Z3_mk_bvshl(this->context, this->translate(node->getChildren()[0]), this->translate(node->getChildren()[1])));
 
         case BVSLE_NODE:
-          return to_expr(this->context, Z3_mk_bvsle(this->context, this->convert(node->getChildren()[0]), this->convert(node->getChildren()[1])));
+          return to_expr(this->context, Z3_mk_bvsle(this->context, this->translate(node->getChildren()[0]), this->translate(node->getChildren()[1])));
 
         case BVSLT_NODE:
-          return to_expr(this->context, Z3_mk_bvslt(this->context, this->convert(node->getChildren()[0]), this->convert(node->getChildren()[1])));
+          return to_expr(this->context, Z3_mk_bvslt(this->context, this->translate(node->getChildren()[0]), this->translate(node->getChildren()[1])));
 
         case BVSMOD_NODE:
-          return to_expr(this->context, Z3_mk_bvsmod(this->context, this->convert(node->getChildren()[0]), this->convert(node->getChildren()[1])));
+          return to_expr(this->context, Z3_mk_bvsmod(this->context, this->translate(node->getChildren()[0]), this->translate(node->getChildren()[1])));
 
         case BVSREM_NODE:
-          return to_expr(this->context, Z3_mk_bvsrem(this->context, this->convert(node->getChildren()[0]), this->convert(node->getChildren()[1])));
+          return to_expr(this->context, Z3_mk_bvsrem(this->context, this->translate(node->getChildren()[0]), this->translate(node->getChildren()[1])));
 
         case BVSUB_NODE:
-          return to_expr(this->context, Z3_mk_bvsub(this->context, this->convert(node->getChildren()[0]), this->convert(node->getChildren()[1])));
+          return to_expr(this->context, Z3_mk_bvsub(this->context, this->translate(node->getChildren()[0]), this->translate(node->getChildren()[1])));
 
         case BVUDIV_NODE:
-          return to_expr(this->context, Z3_mk_bvudiv(this->context, this->convert(node->getChildren()[0]), this->convert(node->getChildren()[1])));
+          return to_expr(this->context, Z3_mk_bvudiv(this->context, this->translate(node->getChildren()[0]), this->translate(node->getChildren()[1])));
 
         case BVUGE_NODE:
-          return to_expr(this->context, Z3_mk_bvuge(this->context, this->convert(node->getChildren()[0]), this->convert(node->getChildren()[1])));
+          return to_expr(this->context, Z3_mk_bvuge(this->context, this->translate(node->getChildren()[0]), this->translate(node->getChildren()[1])));
 
         case BVUGT_NODE:
-          return to_expr(this->context, Z3_mk_bvugt(this->context, this->convert(node->getChildren()[0]), this->convert(node->getChildren()[1])));
+          return to_expr(this->context, Z3_mk_bvugt(this->context, this->translate(node->getChildren()[0]), this->translate(node->getChildren()[1])));
 
         case BVULE_NODE:
-          return to_expr(this->context, Z3_mk_bvule(this->context, this->convert(node->getChildren()[0]), this->convert(node->getChildren()[1])));
+          return to_expr(this->context, Z3_mk_bvule(this->context, this->translate(node->getChildren()[0]), this->translate(node->getChildren()[1])));
 
         case BVULT_NODE:
-          return to_expr(this->context, Z3_mk_bvult(this->context, this->convert(node->getChildren()[0]), this->convert(node->getChildren()[1])));
+          return to_expr(this->context, Z3_mk_bvult(this->context, this->translate(node->getChildren()[0]), this->translate(node->getChildren()[1])));
 
         case BVUREM_NODE:
-          return to_expr(this->context, Z3_mk_bvurem(this->context, this->convert(node->getChildren()[0]), this->convert(node->getChildren()[1])));
+          return to_expr(this->context, Z3_mk_bvurem(this->context, this->translate(node->getChildren()[0]), this->translate(node->getChildren()[1])));
 
         case BVXNOR_NODE:
-          return to_expr(this->context, Z3_mk_bvxnor(this->context, this->convert(node->getChildren()[0]), this->convert(node->getChildren()[1])));
+          return to_expr(this->context, Z3_mk_bvxnor(this->context, this->translate(node->getChildren()[0]), this->translate(node->getChildren()[1])));
 
         case BVXOR_NODE:
-          return to_expr(this->context, Z3_mk_bvxor(this->context, this->convert(node->getChildren()[0]), this->convert(node->getChildren()[1])));
+          return to_expr(this->context, Z3_mk_bvxor(this->context, this->translate(node->getChildren()[0]), this->translate(node->getChildren()[1])));
 
         case BV_NODE: {
-          z3::expr value        = this->convert(node->getChildren()[0]);
-          z3::expr size         = this->convert(node->getChildren()[1]);
+          z3::expr value        = this->translate(node->getChildren()[0]);
+          z3::expr size         = this->translate(node->getChildren()[1]);
           triton::uint32 bvsize = static_cast<triton::uint32>(this->getUintValue(size));
           return this->context.bv_val(this->getStringValue(value).c_str(), bvsize);
         }
 
         case CONCAT_NODE: {
-          const std::vector<triton::ast::SharedAbstractNode>& children = node->getChildren();
+          const triton::ast::ChildVector& children = node->getChildren();
 
-          z3::expr currentValue = this->convert(node->getChildren()[0]);
+          z3::expr currentValue = this->translate(node->getChildren()[0]);
           z3::expr nextValue(this->context);
 
           // Child[0] is the LSB
           for (triton::uint32 idx = 1; idx < children.size(); idx++) {
-            nextValue = this->convert(children[idx]);
+            nextValue = this->translate(children[idx]);
             currentValue = to_expr(this->context, Z3_mk_concat(this->context, currentValue, nextValue));
           }
 
@@ -161,25 +208,25 @@ namespace triton {
         }
 
         case DECIMAL_NODE: {
-          std::string value(reinterpret_cast<triton::ast::DecimalNode*>(node.get())->getValue());
+          std::string value(reinterpret_cast<triton::ast::DecimalNode*>(node.get())->getValue().str());
           return this->context.int_val(value.c_str());
         }
 
         case DISTINCT_NODE: {
-          z3::expr op1 = this->convert(node->getChildren()[0]);
-          z3::expr op2 = this->convert(node->getChildren()[1]);
+          z3::expr op1 = this->translate(node->getChildren()[0]);
+          z3::expr op2 = this->translate(node->getChildren()[1]);
           Z3_ast ops[] = {op1, op2};
 
           return to_expr(this->context, Z3_mk_distinct(this->context, 2, ops));
         }
 
         case EQUAL_NODE:
-          return to_expr(this->context, Z3_mk_eq(this->context, this->convert(node->getChildren()[0]), this->convert(node->getChildren()[1])));
+          return to_expr(this->context, Z3_mk_eq(this->context, this->translate(node->getChildren()[0]), this->translate(node->getChildren()[1])));
 
         case EXTRACT_NODE: {
-          z3::expr high     = this->convert(node->getChildren()[0]);
-          z3::expr low      = this->convert(node->getChildren()[1]);
-          z3::expr value    = this->convert(node->getChildren()[2]);
+          z3::expr high     = this->translate(node->getChildren()[0]);
+          z3::expr low      = this->translate(node->getChildren()[1]);
+          z3::expr value    = this->translate(node->getChildren()[2]);
           triton::uint32 hv = static_cast<triton::uint32>(this->getUintValue(high));
           triton::uint32 lv = static_cast<triton::uint32>(this->getUintValue(low));
 
@@ -187,24 +234,24 @@ namespace triton {
         }
 
         case ITE_NODE: {
-          z3::expr op1 = this->convert(node->getChildren()[0]); // condition
-          z3::expr op2 = this->convert(node->getChildren()[1]); // if true
-          z3::expr op3 = this->convert(node->getChildren()[2]); // if false
+          z3::expr op1 = this->translate(node->getChildren()[0]); // condition
+          z3::expr op2 = this->translate(node->getChildren()[1]); // if true
+          z3::expr op3 = this->translate(node->getChildren()[2]); // if false
 
           return to_expr(this->context, Z3_mk_ite(this->context, op1, op2, op3));
         }
 
         case LAND_NODE: {
-          const std::vector<triton::ast::SharedAbstractNode>& children = node->getChildren();
+          const triton::ast::ChildVector& children = node->getChildren();
 
-          z3::expr currentValue = this->convert(node->getChildren()[0]);
+          z3::expr currentValue = this->translate(node->getChildren()[0]);
           if (!currentValue.get_sort().is_bool()) {
             throw triton::exceptions::AstTranslations("TritonToZ3Ast::LandNode(): Land can be apply only on bool value.");
           }
           z3::expr nextValue(this->context);
 
           for (triton::uint32 idx = 1; idx < children.size(); idx++) {
-            nextValue = this->convert(children[idx]);
+            nextValue = this->translate(children[idx]);
             if (!nextValue.get_sort().is_bool()) {
               throw triton::exceptions::AstTranslations("TritonToZ3Ast::LandNode(): Land can be apply only on bool value.");
             }
@@ -217,14 +264,20 @@ namespace triton {
 
 
         case LET_NODE: {
-          std::string symbol    = reinterpret_cast<triton::ast::StringNode*>(node->getChildren()[0].get())->getValue();
+          std::string symbol = reinterpret_cast<triton::ast::StringNode*>(node->getChildren()[0].get())->getValue();
+
+          /* The nodes converted so far may depend on the previous binding of the symbol */
+          auto it = this->symbols.find(symbol);
+          if (it != this->symbols.end() && it->second != node->getChildren()[1])
+            this->nodes.clear();
+
           this->symbols[symbol] = node->getChildren()[1];
 
-          return this->convert(node->getChildren()[2]);
+          return this->translate(node->getChildren()[2]);
         }
 
         case LNOT_NODE: {
-          z3::expr value = this->convert(node->getChildren()[0]);
+          z3::expr value = this->translate(node->getChildren()[0]);
           if (!value.get_sort().is_bool()) {
             throw triton::exceptions::AstTranslations("TritonToZ3Ast::LnotNode(): Lnot can be apply only on bool value.");
           }
@@ -232,16 +285,16 @@ namespace triton {
         }
 
         case LOR_NODE: {
-          const std::vector<triton::ast::SharedAbstractNode>& children = node->getChildren();
+          const triton::ast::ChildVector& children = node->getChildren();
 
-          z3::expr currentValue = this->convert(node->getChildren()[0]);
+          z3::expr currentValue = this->translate(node->getChildren()[0]);
           if (!currentValue.get_sort().is_bool()) {
             throw triton::exceptions::AstTranslations("TritonToZ3Ast::LnotNode(): Lnot can be apply only on bool value.");
           }
           z3::expr nextValue(this->context);
 
           for (triton::uint32 idx = 1; idx < children.size(); idx++) {
-            nextValue = this->convert(children[idx]);
+            nextValue = this->translate(children[idx]);
             if (!nextValue.get_sort().is_bool()) {
               throw triton::exceptions::AstTranslations("TritonToZ3Ast::LnotNode(): Lnot can be apply only on bool value.");
             }
@@ -252,8 +305,22 @@ namespace triton {
           return currentValue;
         }
 
-        case REFERENCE_NODE:
-          return this->convert(reinterpret_cast<triton::ast::ReferenceNode*>(node.get())->getSymbolicExpression()->getAst());
+        case REFERENCE_NODE: {
+          const triton::engines::symbolic::SharedSymbolicExpression& expr = reinterpret_cast<triton::ast::ReferenceNode*>(node.get())->getSymbolicExpression();
+
+          /* Another reference node may point to the same expression */
+          const triton::ast::SharedAbstractNode& ast = expr->getAst();
+          auto it = this->exprs.find(expr->getId());
+          if (it != this->exprs.end() && it->second.first == ast)
+            return it->second.second;
+
+          z3::expr value = this->translate(ast);
+          if (it != this->exprs.end())
+            this->exprs.erase(it);
+          this->exprs.insert(std::make_pair(expr->getId(), std::make_pair(ast, value)));
+
+          return value;
+        }
 
         case STRING_NODE: {
           std::string value = reinterpret_cast<triton::ast::StringNode*>(node.get())->getValue();
@@ -261,12 +328,12 @@ namespace triton {
           if (this->symbols.find(value) == this->symbols.end())
             throw triton::exceptions::AstTranslations("TritonToZ3Ast::convert(): [STRING_NODE] Symbols not found.");
 
-          return this->convert(this->symbols[value]);
+          return this->translate(this->symbols[value]);
         }
 
         case SX_NODE: {
-          z3::expr ext        = this->convert(node->getChildren()[0]);
-          z3::expr value      = this->convert(node->getChildren()[1]);
+          z3::expr ext        = this->translate(node->getChildren()[0]);
+          z3::expr value      = this->translate(node->getChildren()[1]);
           triton::uint32 extv = static_cast<triton::uint32>(this->getUintValue(ext));
 
           return to_expr(this->context, Z3_mk_sign_ext(this->context, extv, value));
@@ -282,7 +349,7 @@ namespace triton {
           /* If the conversion is used to evaluate a node, we concretize symbolic variables */
           if (this->isEval) {
             triton::uint512 value = reinterpret_cast<triton::ast::VariableNode*>(node.get())->evaluate();
-            std::string strValue(value);
+            std::string strValue(value.str());
             return this->context.bv_val(strValue.c_str(), symVar->getSize());
           }
 
@@ -291,8 +358,8 @@ namespace triton {
         }
 
         case ZX_NODE: {
-          z3::expr ext        = this->convert(node->getChildren()[0]);
-          z3::expr value      = this->convert(node->getChildren()[1]);
+          z3::expr ext        = this->translate(node->getChildren()[0]);
+          z3::expr value      = this->translate(node->getChildren()[1]);
           triton::uint32 extv = static_cast<triton::uint32>(this->getUintValue(ext));
 
           return to_expr(this->context, Z3_mk_zero_ext(this->context, extv, value));
@@ -55,6 +55,7 @@ to wrap more generic concepts.
 - \ref py_OPCODE_page
 - \ref py_OPERAND_page
 - \ref py_REG_page
+- \ref py_SOLVER_STATE_page
 - \ref py_SYMEXPR_page
 - \ref py_SYSCALL_page
 - \ref py_VERSION_page
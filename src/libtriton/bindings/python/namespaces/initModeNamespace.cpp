@@ -34,6 +34,11 @@ The MODE namespace contains all kinds of mode.
 - **MODE.ALIGNED_MEMORY**<br>
 Enabled, Triton will keep a map of aligned memory to reduce the symbolic memory explosion of `LOAD` and `STORE` acceess.
 
+- **MODE.LAZY_FLAGS**<br>
+Enabled, Triton will build the symbolic expressions of the flags only when they are read (by an instruction, a path constraint
+or the API) instead of at each instruction which writes them. Deferred expressions are not linked to their instruction. This mode
+is ignored when the symbolic engine is disabled or when `MODE.ONLY_ON_TAINTED` is enabled.
+
 - **MODE.ONLY_ON_SYMBOLIZED**<br>
 Enabled, Triton will perform symbolic execution only on symbolized expressions.
 
@@ -43,6 +48,10 @@ Enabled, Triton will perform symbolic execution only on tainted instructions.
 - **MODE.PC_TRACKING_SYMBOLIC**<br>
 Enabled, Triton will track path constraints only if they are symbolized. This mode is enabled by default.
 
+- **MODE.TAINT_LABELS**<br>
+Enabled, the taint engine tracks which labels (up to 64 taint sources, see `taintMemory()` and `taintRegister()`)
+each tainted byte and register comes from. The labels are queried with `getTaintLabels()`.
+
 */
 
 
@@ -53,9 +62,11 @@ namespace triton {
 
       void initModeNamespace(PyObject* modeDict) {
         xPyDict_SetItemString(modeDict, "ALIGNED_MEMORY",         PyLong_FromUint32(triton::modes::ALIGNED_MEMORY));
+        xPyDict_SetItemString(modeDict, "LAZY_FLAGS",             PyLong_FromUint32(triton::modes::LAZY_FLAGS));
         xPyDict_SetItemString(modeDict, "ONLY_ON_SYMBOLIZED",     PyLong_FromUint32(triton::modes::ONLY_ON_SYMBOLIZED));
         xPyDict_SetItemString(modeDict, "ONLY_ON_TAINTED",        PyLong_FromUint32(triton::modes::ONLY_ON_TAINTED));
         xPyDict_SetItemString(modeDict, "PC_TRACKING_SYMBOLIC",   PyLong_FromUint32(triton::modes::PC_TRACKING_SYMBOLIC));
+        xPyDict_SetItemString(modeDict, "TAINT_LABELS",           PyLong_FromUint32(triton::modes::TAINT_LABELS));
       }
 
     }; /* python namespace */
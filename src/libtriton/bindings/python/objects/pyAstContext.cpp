@@ -393,6 +393,9 @@ e.g: `(distinct expr1 expr2)`
 - <b>\ref py_AstNode_page duplicate(\ref py_AstNode_page expr)</b><br>
 Duplicates the node and returns a new instance as \ref py_AstNode_page. When you play with a node, it's recommended to use this function before any manipulation.
 
+- <b>void enableHashConsing(bool flag)</b><br>
+Enables or disables the hash-consing of nodes. When enabled, builders return the already existing node if an identical one is alive, so identical subtrees are shared. A shared node must not be modified with `setChild()`.
+
 - <b>\ref py_AstNode_page equal(\ref py_AstNode_page expr1, \ref py_AstNode_page expr2)</b><br>
 Creates an `equal` node.<br>
 e.g: `(= expr1 epxr2)`.
@@ -401,6 +404,9 @@ e.g: `(= expr1 epxr2)`.
 Creates an `extract` node. The `high` and `low` fields represent the bits position.<br>
 e.g: `((_ extract high low) expr1)`.
 
+- <b>bool isHashConsingEnabled(void)</b><br>
+Returns true if the hash-consing of nodes is enabled.
+
 - <b>\ref py_AstNode_page ite(\ref py_AstNode_page ifExpr, \ref py_AstNode_page thenExpr, \ref py_AstNode_page elseExpr)</b><br>
 Creates an `ite` node.<br>
 e.g: `(ite ifExpr thenExpr elseExpr)`.
@@ -1191,6 +1197,22 @@ namespace triton {
       }
 
 
+      static PyObject* AstContext_enableHashConsing(PyObject* self, PyObject* flag) {
+        if (!PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "enableHashConsing(): expected a boolean as argument");
+
+        try {
+          PyAstContext_AsAstContext(self)->enableHashConsing(PyLong_AsBool(flag));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* AstContext_extract(PyObject* self, PyObject* args) {
         PyObject* op1 = nullptr;
         PyObject* op2 = nullptr;
@@ -1217,6 +1239,18 @@ namespace triton {
       }
 
 
+      static PyObject* AstContext_isHashConsingEnabled(PyObject* self, PyObject* noarg) {
+        try {
+          if (PyAstContext_AsAstContext(self)->isHashConsingEnabled() == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* AstContext_ite(PyObject* self, PyObject* args) {
         PyObject* op1 = nullptr;
         PyObject* op2 = nullptr;
@@ -1452,8 +1486,10 @@ namespace triton {
         {"concat",        AstContext_concat,          METH_O,           ""},
         {"distinct",      AstContext_distinct,        METH_VARARGS,     ""},
         {"duplicate",     AstContext_duplicate,       METH_O,           ""},
+        {"enableHashConsing", AstContext_enableHashConsing, METH_O,           ""},
         {"equal",         AstContext_equal,           METH_VARARGS,     ""},
         {"extract",       AstContext_extract,         METH_VARARGS,     ""},
+        {"isHashConsingEnabled", AstContext_isHashConsingEnabled, METH_NOARGS,      ""},
         {"ite",           AstContext_ite,             METH_VARARGS,     ""},
         {"land",          AstContext_land,            METH_O,           ""},
         {"let",           AstContext_let,             METH_VARARGS,     ""},
@@ -94,9 +94,26 @@ Returns the new symbolic volatile expression and links this expression to the in
 - <b>void disassembly(\ref py_Instruction_page inst)</b><br>
 Disassembles the instruction and setup operands. You must define an architecture before.
 
+- <b>void enableConstraintPartitioning(bool flag)</b><br>
+Enables or disables the partitioning of the constraints sent to the solver. getModel() and isSat() only solve the constraints
+which share variables with the ones not satisfied by the concrete values, the other variables keeping their concrete value in
+the model. Disabling the partitioning clears its statistics.
+
+- <b>void enableDecodeCache(bool flag)</b><br>
+Enables or disables the cache of decoded instructions. Disabling the cache clears it.
+
 - <b>void enableMode(\ref py_MODE_page mode, bool flag)</b><br>
 Enables or disables a specific mode.
 
+- <b>void enableModelCache(bool flag)</b><br>
+Enables or disables the reuse of the models already found. getModel() and isSat() first evaluate the constraint under the
+models already found (without modifying the concrete values of the variables) and only call the solver if none of them
+satisfies it. Disabling the cache clears it.
+
+- <b>void enableSolverCache(bool flag)</b><br>
+Enables or disables the cache of the solver queries (getModel(), getModels() and isSat()). Disabling the cache clears it.
+A constraint already solved is answered from the cache, its references being unrolled.
+
 - <b>void enableSymbolicEngine(bool flag)</b><br>
 Enables or disables the symbolic execution engine.
 
@@ -133,6 +150,13 @@ Returns the concrete value of a register.
 - <b>integer getConcreteVariableValue(\ref py_SymbolicVariable_page symVar)</b><br>
 Returns the concrete value of a symbolic variable.
 
+- <b>dict getConstraintPartitioningStats(void)</b><br>
+Returns the statistics of the partitioning as a dictionary of {`queries`, `constraints`, `sentConstraints`, `variables`, `sentVariables`}.
+`constraints` and `variables` are counted over all the queries, `sentConstraints` and `sentVariables` over the parts sent to the solver.
+
+- <b>dict getDecodeCacheStats(void)</b><br>
+Returns the statistics of the cache of decoded instructions as a dictionary of {`size`, `hits`, `misses`}.
+
 - <b>integer getGprBitSize(void)</b><br>
 Returns the size in bit of the General Purpose Registers.
 
@@ -148,9 +172,16 @@ Returns the AST corresponding to the \ref py_MemoryAccess_page with the SSA form
 - <b>dict getModel(\ref py_AstNode_page node)</b><br>
 Computes and returns a model as a dictionary of {integer symVarId : \ref py_SolverModel_page model} from a symbolic constraint.
 
+- <b>dict getModelCacheStats(void)</b><br>
+Returns the statistics of the reuse of the models as a dictionary of {`size`, `hits`, `misses`}. `hits` is the number of queries
+answered without the solver.
+
 - <b>[dict, ...] getModels(\ref py_AstNode_page node, integer limit)</b><br>
 Computes and returns several models from a symbolic constraint. The `limit` is the number of models returned.
 
+- <b>integer getNumberOfSolverSessionConstraints(void)</b><br>
+Returns the number of constraints pushed in the solving session.
+
 - <b>\ref py_Register_page getParentRegister(\ref py_Register_page reg)</b><br>
 Returns the parent \ref py_Register_page from a \ref py_Register_page.
 
@@ -169,6 +200,13 @@ Returns the \ref py_Register_page class corresponding to a \ref py_REG_page id.
 - <b>\ref py_AstNode_page getRegisterAst(\ref py_Register_page reg)</b><br>
 Returns the AST corresponding to the \ref py_Register_page with the SSA form.
 
+- <b>dict getSolverCacheStats(void)</b><br>
+Returns the statistics of the cache of the solver queries as a dictionary of {`size`, `hits`, `misses`}.
+
+- <b>dict getSolverSessionModel(\ref py_AstNode_page node)</b><br>
+Computes and returns a model as a dictionary of {integer symVarId : \ref py_SolverModel_page model} from the constraints of the solving session and `node`. The `node`
+is not kept in the session.
+
 - <b>\ref py_SymbolicExpression_page getSymbolicExpressionFromId(intger symExprId)</b><br>
 Returns the symbolic expression corresponding to an id.
 
@@ -205,6 +243,13 @@ Returns the symbolic variable corresponding to a symbolic variable name.
 - <b>dict getSymbolicVariables(void)</b><br>
 Returns all symbolic variable as a dictionary of {integer SymVarId : \ref py_SymbolicVariable_page var}.
 
+- <b>integer getTaintLabels(\ref py_MemoryAccess_page mem)</b><br>
+Returns the set of labels of a memory (the union of the labels of its bytes) as an integer with one bit per label.
+See `MODE.TAINT_LABELS`.
+
+- <b>integer getTaintLabels(\ref py_Register_page reg)</b><br>
+Returns the set of labels of a register as an integer with one bit per label. See `MODE.TAINT_LABELS`.
+
 - <b>[intger, ...] getTaintedMemory(void)</b><br>
 Returns the list of all tainted addresses.
 
@@ -217,6 +262,12 @@ Returns the list of all tainted symbolic expressions.
 - <b>bool isArchitectureValid(void)</b><br>
 Returns true if the architecture is valid.
 
+- <b>bool isConstraintPartitioningEnabled(void)</b><br>
+Returns true if the constraints sent to the solver are partitioned.
+
+- <b>bool isDecodeCacheEnabled(void)</b><br>
+Returns true if the cache of decoded instructions is enabled.
+
 - <b>bool isFlag(\ref py_Register_page reg)</b><br>
 Returns true if the register is a flag.
 
@@ -238,6 +289,9 @@ Returns true if the memory is tainted.
 - <b>bool isModeEnabled(\ref py_MODE_page mode)</b><br>
 Returns true if the mode is enabled.
 
+- <b>bool isModelCacheEnabled(void)</b><br>
+Returns true if the models already found are reused.
+
 - <b>bool isRegister(\ref py_Register_page reg)</b><br>
 Returns true if the register is a register (see also isFlag()).
 
@@ -253,6 +307,15 @@ Returns true if the register is valid.
 - <b>bool isSat(\ref py_AstNode_page node)</b><br>
 Returns true if an expression is satisfiable.
 
+- <b>bool isSolverCacheEnabled(void)</b><br>
+Returns true if the cache of the solver queries is enabled.
+
+- <b>bool isSolverSessionSat(\ref py_AstNode_page node)</b><br>
+Returns true if the constraints of the solving session and `node` are satisfiable. The `node` is not kept in the session.
+
+- <b>bool isSolverSessionStarted(void)</b><br>
+Returns true if an incremental solving session is started.
+
 - <b>bool isSymbolicEngineEnabled(void)</b><br>
 Returns true if the symbolic execution engine is enabled.
 
@@ -262,15 +325,24 @@ Returns true if the symbolic expression id exists.
 - <b>bool isTaintEngineEnabled(void)</b><br>
 Returns true if the taint engine is enabled.
 
+- <b>void loadSolverCache(string file)</b><br>
+Loads the solver queries saved into a `file` by saveSolverCache() in the cache of the solver queries.
+
 - <b>\ref py_SymbolicExpression_page newSymbolicExpression(\ref py_AstNode_page node, string comment)</b><br>
 Returns a new symbolic expression. Note that if there are simplification passes recorded, simplifications will be applied.
 
 - <b>\ref py_SymbolicVariable_page newSymbolicVariable(intger varSize, string comment)</b><br>
 Returns a new symbolic variable.
 
+- <b>void popSolverSessionConstraints(integer count=1)</b><br>
+Removes the `count` last constraints pushed in the solving session.
+
 - <b>bool processing(\ref py_Instruction_page inst)</b><br>
 Processes an instruction and updates engines according to the instruction semantics. Returns true if the instruction is supported. You must define an architecture before.
 
+- <b>void pushSolverSessionConstraint(\ref py_AstNode_page node)</b><br>
+Asserts a constraint in the solving session until it is popped. See \ref solver_interface_session.
+
 - <b>void removeAllCallbacks(void)</b><br>
 Removes all recorded callbacks.
 
@@ -280,6 +352,9 @@ Removes a recorded callback.
 - <b>void reset(void)</b><br>
 Resets everything.
 
+- <b>void saveSolverCache(string file)</b><br>
+Saves the cache of the solver queries into a `file`.
+
 - <b>void setArchitecture(\ref py_ARCH_page arch)</b><br>
 Initializes an architecture. This function must be called before any call to the rest of the API.
 
@@ -322,6 +397,19 @@ set to True, Triton will use z3 to simplify the given `node` before to call its
 - <b>dict sliceExpressions(\ref py_SymbolicExpression_page expr)</b><br>
 Slices expressions from a given one (backward slicing) and returns all symbolic expressions as a dictionary of {integer SymExprId : \ref py_SymbolicExpression_page expr}.
 
+- <b>[dict, ...] solveAllBranches(bool dedup=True, integer timeout=0)</b><br>
+Walks the path constraints once with an incremental solver and solves each branch which has not been taken (the taken
+branches before it and its constraint). Returns a list of dictionaries of {'index': integer, 'srcAddr': integer,
+'dstAddr': integer, 'status': \ref py_SOLVER_STATE_page, 'model': {integer SymVarId : \ref py_SolverModel_page model}}.
+If `dedup` is True, a branch is solved only once per (srcAddr, dstAddr). The `timeout` is the time budget (in
+milliseconds) of each query, 0 for no limit.
+
+- <b>void startSolverSession(void)</b><br>
+Starts an incremental solving session which keeps one solver alive between the queries. A session already started is restarted. See \ref solver_interface_session.
+
+- <b>void stopSolverSession(void)</b><br>
+Stops the incremental solving session.
+
 - <b>bool taintAssignmentMemoryImmediate(\ref py_MemoryAccess_page memDst)</b><br>
 Taints `memDst` with an assignment - `memDst` is untained. Returns true if the `memDst` is still tainted.
 
@@ -347,11 +435,13 @@ Taints `regDst` from `regSrc` with an assignment - `regDst` is tainted if `regSr
 - <b>bool taintMemory(intger addr)</b><br>
 Taints an address. Returns true if the address is tainted.
 
-- <b>bool taintMemory(\ref py_MemoryAccess_page mem)</b><br>
-Taints a memory. Returns true if the memory is tainted.
+- <b>bool taintMemory(\ref py_MemoryAccess_page mem, integer label=None)</b><br>
+Taints a memory. If the `MODE.TAINT_LABELS` mode is enabled, the optional `label` (0 to 63) is added to the labels
+of its bytes. Returns true if the memory is tainted.
 
-- <b>bool taintRegister(\ref py_Register_page reg)</b><br>
-Taints a register. Returns true if the register is tainted.
+- <b>bool taintRegister(\ref py_Register_page reg, integer label=None)</b><br>
+Taints a register. If the `MODE.TAINT_LABELS` mode is enabled, the optional `label` (0 to 63) is added to its labels.
+Returns true if the register is tainted.
 
 - <b>bool taintUnionMemoryImmediate(\ref py_MemoryAccess_page memDst)</b><br>
 Taints `memDst` with an union - `memDst` does not changes. Returns true if `memDst` is tainted.
@@ -378,8 +468,10 @@ tainted. Returns true if `regDst` is tainted.
 - <b>void unmapMemory(integer baseAddr, integer size=1)</b><br>
 Removes the range `[baseAddr:size]` from the internal memory representation.
 
-- <b>\ref py_AstNode_page unrollAst(\ref py_AstNode_page node)</b><br>
-Unrolls the SSA form of a given AST.
+- <b>\ref py_AstNode_page unrollAst(\ref py_AstNode_page node, integer maxDepth=0, integer maxNodes=0)</b><br>
+Unrolls the SSA form of a given AST. The given AST is not modified and each referenced expression is unrolled once.
+Raises an exception if more than `maxDepth` nested references have to be followed or if more than `maxNodes` nodes
+have to be created (0 means no limit).
 
 - <b>bool untaintMemory(intger addr)</b><br>
 Untaints an address. Returns true if the address is still tainted.
@@ -1090,6 +1182,38 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_enableConstraintPartitioning(PyObject* self, PyObject* flag) {
+        if (!PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "enableConstraintPartitioning(): Expects an boolean as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->enableConstraintPartitioning(PyLong_AsBool(flag));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_enableDecodeCache(PyObject* self, PyObject* flag) {
+        if (!PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "enableDecodeCache(): Expects an boolean as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->enableDecodeCache(PyLong_AsBool(flag));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_enableMode(PyObject* self, PyObject* args) {
         PyObject* mode = nullptr;
         PyObject* flag = nullptr;
@@ -1115,6 +1239,38 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_enableModelCache(PyObject* self, PyObject* flag) {
+        if (!PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "enableModelCache(): Expects an boolean as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->enableModelCache(PyLong_AsBool(flag));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_enableSolverCache(PyObject* self, PyObject* flag) {
+        if (!PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "enableSolverCache(): Expects an boolean as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->enableSolverCache(PyLong_AsBool(flag));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_enableSymbolicEngine(PyObject* self, PyObject* flag) {
         if (!PyBool_Check(flag))
           return PyErr_Format(PyExc_TypeError, "enableSymbolicEngine(): Expects an boolean as argument.");
@@ -1282,6 +1438,46 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_getConstraintPartitioningStats(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        try {
+          const triton::engines::solver::ConstraintPartitioner& partitioner = PyTritonContext_AsTritonContext(self)->getConstraintPartitioner();
+
+          ret = xPyDict_New();
+          xPyDict_SetItem(ret, PyString_FromString("queries"),         PyLong_FromUsize(partitioner.getNumberOfQueries()));
+          xPyDict_SetItem(ret, PyString_FromString("constraints"),     PyLong_FromUsize(partitioner.getNumberOfConstraints()));
+          xPyDict_SetItem(ret, PyString_FromString("sentConstraints"), PyLong_FromUsize(partitioner.getNumberOfSentConstraints()));
+          xPyDict_SetItem(ret, PyString_FromString("variables"),       PyLong_FromUsize(partitioner.getNumberOfVariables()));
+          xPyDict_SetItem(ret, PyString_FromString("sentVariables"),   PyLong_FromUsize(partitioner.getNumberOfSentVariables()));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_getDecodeCacheStats(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        try {
+          const triton::arch::DecodeCache& cache = PyTritonContext_AsTritonContext(self)->getDecodeCache();
+
+          ret = xPyDict_New();
+          xPyDict_SetItem(ret, PyString_FromString("size"),   PyLong_FromUsize(cache.getSize()));
+          xPyDict_SetItem(ret, PyString_FromString("hits"),   PyLong_FromUsize(cache.getHits()));
+          xPyDict_SetItem(ret, PyString_FromString("misses"), PyLong_FromUsize(cache.getMisses()));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
       static PyObject* TritonContext_getGprBitSize(PyObject* self, PyObject* noarg) {
         try {
           return PyLong_FromUint32(PyTritonContext_AsTritonContext(self)->getGprBitSize());
@@ -1349,6 +1545,25 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_getModelCacheStats(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        try {
+          const triton::engines::solver::ModelCache& cache = PyTritonContext_AsTritonContext(self)->getModelCache();
+
+          ret = xPyDict_New();
+          xPyDict_SetItem(ret, PyString_FromString("size"),   PyLong_FromUsize(cache.getSize()));
+          xPyDict_SetItem(ret, PyString_FromString("hits"),   PyLong_FromUsize(cache.getHits()));
+          xPyDict_SetItem(ret, PyString_FromString("misses"), PyLong_FromUsize(cache.getMisses()));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
       static PyObject* TritonContext_getModels(PyObject* self, PyObject* args) {
         PyObject* ret   = nullptr;
         PyObject* node  = nullptr;
@@ -1466,6 +1681,46 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_getSolverCacheStats(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        try {
+          const triton::engines::solver::SolverCache& cache = PyTritonContext_AsTritonContext(self)->getSolverCache();
+
+          ret = xPyDict_New();
+          xPyDict_SetItem(ret, PyString_FromString("size"),   PyLong_FromUsize(cache.getSize()));
+          xPyDict_SetItem(ret, PyString_FromString("hits"),   PyLong_FromUsize(cache.getHits()));
+          xPyDict_SetItem(ret, PyString_FromString("misses"), PyLong_FromUsize(cache.getMisses()));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_getSolverSessionModel(PyObject* self, PyObject* node) {
+        PyObject* ret = nullptr;
+
+        if (!PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "getSolverSessionModel(): Expects a AstNode as argument.");
+
+        try {
+          ret = xPyDict_New();
+          auto model = PyTritonContext_AsTritonContext(self)->getSolverSessionModel(PyAstNode_AsAstNode(node));
+          for (auto it = model.begin(); it != model.end(); it++) {
+            xPyDict_SetItem(ret, PyLong_FromUint32(it->first), PySolverModel(it->second));
+          }
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
       static PyObject* TritonContext_getSymbolicExpressionFromId(PyObject* self, PyObject* symExprId) {
         if (!PyLong_Check(symExprId) && !PyInt_Check(symExprId))
           return PyErr_Format(PyExc_TypeError, "getSymbolicExpressionFromId(): Expects an integer as argument.");
@@ -1632,12 +1887,29 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_getTaintLabels(PyObject* self, PyObject* op) {
+        try {
+          if (PyMemoryAccess_Check(op))
+            return PyLong_FromUint64(PyTritonContext_AsTritonContext(self)->getTaintLabels(*PyMemoryAccess_AsMemoryAccess(op)));
+
+          else if (PyRegister_Check(op))
+            return PyLong_FromUint64(PyTritonContext_AsTritonContext(self)->getTaintLabels(*PyRegister_AsRegister(op)));
+
+          else
+            return PyErr_Format(PyExc_TypeError, "getTaintLabels(): Expects a MemoryAccess or a Register as argument.");
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* TritonContext_getTaintedMemory(PyObject* self, PyObject* noarg) {
         PyObject* ret = nullptr;
         triton::usize size = 0, index = 0;
 
         try {
-          std::set<triton::uint64> addresses = PyTritonContext_AsTritonContext(self)->getTaintedMemory();
+          const triton::engines::taint::ShadowMemory& addresses = PyTritonContext_AsTritonContext(self)->getTaintedMemory();
 
           size = addresses.size();
           ret = xPyList_New(size);
@@ -1710,6 +1982,30 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_isConstraintPartitioningEnabled(PyObject* self, PyObject* noarg) {
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isConstraintPartitioningEnabled() == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_isDecodeCacheEnabled(PyObject* self, PyObject* noarg) {
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isDecodeCacheEnabled() == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* TritonContext_isFlag(PyObject* self, PyObject* reg) {
         if (!PyRegister_Check(reg))
           return PyErr_Format(PyExc_TypeError, "isFlag(): Expects a Register as argument.");
@@ -1800,6 +2096,18 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_isModelCacheEnabled(PyObject* self, PyObject* noarg) {
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isModelCacheEnabled() == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* TritonContext_isRegister(PyObject* self, PyObject* reg) {
         if (!PyRegister_Check(reg))
           return PyErr_Format(PyExc_TypeError, "isRegister(): Expects a Register as argument.");
@@ -1875,6 +2183,45 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_isSolverCacheEnabled(PyObject* self, PyObject* noarg) {
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isSolverCacheEnabled() == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_isSolverSessionSat(PyObject* self, PyObject* node) {
+        if (!PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "isSolverSessionSat(): Expects a AstNode as argument.");
+
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isSolverSessionSat(PyAstNode_AsAstNode(node)) == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_isSolverSessionStarted(PyObject* self, PyObject* noarg) {
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isSolverSessionStarted() == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* TritonContext_isSymbolicEngineEnabled(PyObject* self, PyObject* noarg) {
         try {
           if (PyTritonContext_AsTritonContext(self)->isSymbolicEngineEnabled() == true)
@@ -1929,6 +2276,22 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_loadSolverCache(PyObject* self, PyObject* file) {
+        if (!PyString_Check(file))
+          return PyErr_Format(PyExc_TypeError, "loadSolverCache(): Expects a string as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->getSolverCache().load(PyString_AsString(file));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_newSymbolicExpression(PyObject* self, PyObject* args) {
         PyObject* node          = nullptr;
         PyObject* comment       = nullptr;
@@ -1981,6 +2344,27 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_popSolverSessionConstraints(PyObject* self, PyObject* args) {
+        PyObject* count = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|O", &count);
+
+        if (count != nullptr && !PyLong_Check(count) && !PyInt_Check(count))
+          return PyErr_Format(PyExc_TypeError, "popSolverSessionConstraints(): Expects an integer as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->popSolverSessionConstraints(count != nullptr ? PyLong_AsUsize(count) : 1);
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_processing(PyObject* self, PyObject* inst) {
         if (!PyInstruction_Check(inst))
           return PyErr_Format(PyExc_TypeError, "processing(): Expects an Instruction as argument.");
@@ -1996,6 +2380,22 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_pushSolverSessionConstraint(PyObject* self, PyObject* node) {
+        if (!PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "pushSolverSessionConstraint(): Expects a AstNode as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->pushSolverSessionConstraint(PyAstNode_AsAstNode(node));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_removeAllCallbacks(PyObject* self, PyObject* noarg) {
         try {
           PyTritonContext_AsTritonContext(self)->removeAllCallbacks();
@@ -2073,6 +2473,22 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_saveSolverCache(PyObject* self, PyObject* file) {
+        if (!PyString_Check(file))
+          return PyErr_Format(PyExc_TypeError, "saveSolverCache(): Expects a string as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->getSolverCache().save(PyString_AsString(file));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_setArchitecture(PyObject* self, PyObject* arg) {
         if (!PyLong_Check(arg) && !PyInt_Check(arg))
           return PyErr_Format(PyExc_TypeError, "setArchitecture(): Expects an ARCH as argument.");
@@ -2369,6 +2785,74 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_solveAllBranches(PyObject* self, PyObject* args) {
+        PyObject* ret     = nullptr;
+        PyObject* dedup   = nullptr;
+        PyObject* timeout = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &dedup, &timeout);
+
+        if (dedup != nullptr && !PyBool_Check(dedup))
+          return PyErr_Format(PyExc_TypeError, "solveAllBranches(): Expects a boolean as first argument.");
+
+        if (timeout != nullptr && !PyLong_Check(timeout) && !PyInt_Check(timeout))
+          return PyErr_Format(PyExc_TypeError, "solveAllBranches(): Expects an integer as second argument.");
+
+        try {
+          auto solutions = PyTritonContext_AsTritonContext(self)->solveAllBranches(dedup != nullptr ? PyLong_AsBool(dedup) : true, timeout != nullptr ? PyLong_AsUint32(timeout) : 0);
+
+          ret = xPyList_New(solutions.size());
+          for (triton::usize index = 0; index != solutions.size(); index++) {
+            const auto& solution = solutions[index];
+            PyObject* model = xPyDict_New();
+            PyObject* dict  = xPyDict_New();
+
+            for (auto it = solution.model.begin(); it != solution.model.end(); it++)
+              xPyDict_SetItem(model, PyLong_FromUint32(it->first), PySolverModel(it->second));
+
+            xPyDict_SetItem(dict, PyString_FromString("index"),   PyLong_FromUsize(solution.index));
+            xPyDict_SetItem(dict, PyString_FromString("srcAddr"), PyLong_FromUint64(solution.srcAddr));
+            xPyDict_SetItem(dict, PyString_FromString("dstAddr"), PyLong_FromUint64(solution.dstAddr));
+            xPyDict_SetItem(dict, PyString_FromString("status"),  PyLong_FromUint32(solution.status));
+            xPyDict_SetItem(dict, PyString_FromString("model"),   model);
+            PyList_SetItem(ret, index, dict);
+          }
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_startSolverSession(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->startSolverSession();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_stopSolverSession(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->stopSolverSession();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_taintAssignmentMemoryImmediate(PyObject* self, PyObject* mem) {
         if (!PyMemoryAccess_Check(mem))
           return PyErr_Format(PyExc_TypeError, "taintAssignmentMemoryImmediate(): Expects a MemoryAccess as argument.");
@@ -2495,9 +2979,28 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_taintMemory(PyObject* self, PyObject* mem) {
+      static PyObject* TritonContext_taintMemory(PyObject* self, PyObject* args) {
+        PyObject* mem   = nullptr;
+        PyObject* label = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &mem, &label);
+
+        if (mem == nullptr)
+          return PyErr_Format(PyExc_TypeError, "taintMemory(): Expects a MemoryAccess or an integer as first argument.");
+
+        if (label != nullptr && !PyLong_Check(label) && !PyInt_Check(label))
+          return PyErr_Format(PyExc_TypeError, "taintMemory(): Expects an integer as second argument.");
+
         try {
-          if (PyMemoryAccess_Check(mem)) {
+          if (label != nullptr) {
+            if (!PyMemoryAccess_Check(mem))
+              return PyErr_Format(PyExc_TypeError, "taintMemory(): Expects a MemoryAccess as first argument.");
+            if (PyTritonContext_AsTritonContext(self)->taintMemory(*PyMemoryAccess_AsMemoryAccess(mem), PyLong_AsUint32(label)) == true)
+              Py_RETURN_TRUE;
+          }
+
+          else if (PyMemoryAccess_Check(mem)) {
             if (PyTritonContext_AsTritonContext(self)->taintMemory(*PyMemoryAccess_AsMemoryAccess(mem)) == true)
               Py_RETURN_TRUE;
           }
@@ -2517,11 +3020,26 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_taintRegister(PyObject* self, PyObject* reg) {
-        if (!PyRegister_Check(reg))
-          return PyErr_Format(PyExc_TypeError, "taintRegister(): Expects a Register as argument.");
+      static PyObject* TritonContext_taintRegister(PyObject* self, PyObject* args) {
+        PyObject* reg   = nullptr;
+        PyObject* label = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &reg, &label);
+
+        if (reg == nullptr || !PyRegister_Check(reg))
+          return PyErr_Format(PyExc_TypeError, "taintRegister(): Expects a Register as first argument.");
+
+        if (label != nullptr && !PyLong_Check(label) && !PyInt_Check(label))
+          return PyErr_Format(PyExc_TypeError, "taintRegister(): Expects an integer as second argument.");
 
         try {
+          if (label != nullptr) {
+            if (PyTritonContext_AsTritonContext(self)->taintRegister(*PyRegister_AsRegister(reg), PyLong_AsUint32(label)) == true)
+              Py_RETURN_TRUE;
+            Py_RETURN_FALSE;
+          }
+
           if (PyTritonContext_AsTritonContext(self)->taintRegister(*PyRegister_AsRegister(reg)) == true)
             Py_RETURN_TRUE;
           Py_RETURN_FALSE;
@@ -2688,12 +3206,31 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_unrollAst(PyObject* self, PyObject* node) {
-        if (!PyAstNode_Check(node))
-          return PyErr_Format(PyExc_TypeError, "unrollAst(): Expects a AstNode as argument.");
+      static PyObject* TritonContext_unrollAst(PyObject* self, PyObject* args) {
+        PyObject* node           = nullptr;
+        PyObject* maxDepth       = nullptr;
+        PyObject* maxNodes       = nullptr;
+        triton::usize c_maxDepth = 0;
+        triton::usize c_maxNodes = 0;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OOO", &node, &maxDepth, &maxNodes);
+
+        if (node == nullptr || !PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "unrollAst(): Expects a AstNode as first argument.");
+
+        if (maxDepth != nullptr && !PyLong_Check(maxDepth) && !PyInt_Check(maxDepth))
+          return PyErr_Format(PyExc_TypeError, "unrollAst(): Expects an integer as second argument.");
+
+        if (maxNodes != nullptr && !PyLong_Check(maxNodes) && !PyInt_Check(maxNodes))
+          return PyErr_Format(PyExc_TypeError, "unrollAst(): Expects an integer as third argument.");
 
         try {
-          return PyAstNode(PyTritonContext_AsTritonContext(self)->unrollAst(PyAstNode_AsAstNode(node)));
+          if (maxDepth != nullptr)
+            c_maxDepth = PyLong_AsUsize(maxDepth);
+          if (maxNodes != nullptr)
+            c_maxNodes = PyLong_AsUsize(maxNodes);
+          return PyAstNode(PyTritonContext_AsTritonContext(self)->unrollAst(PyAstNode_AsAstNode(node), c_maxDepth, c_maxNodes));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -2738,6 +3275,16 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_getNumberOfSolverSessionConstraints(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->getNumberOfSolverSessionConstraints());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* TritonContext_getParentRegister(PyObject* self, PyObject* reg) {
         if (!PyRegister_Check(reg))
           return PyErr_Format(PyExc_TypeError, "getParentRegister(): Expects a Register as argument.");
@@ -2795,7 +3342,11 @@ namespace triton {
         {"createSymbolicRegisterExpression",    (PyCFunction)TritonContext_createSymbolicRegisterExpression,       METH_VARARGS,       ""},
         {"createSymbolicVolatileExpression",    (PyCFunction)TritonContext_createSymbolicVolatileExpression,       METH_VARARGS,       ""},
         {"disassembly",                         (PyCFunction)TritonContext_disassembly,                            METH_O,             ""},
+        {"enableConstraintPartitioning",        (PyCFunction)TritonContext_enableConstraintPartitioning,           METH_O,             ""},
+        {"enableDecodeCache",                   (PyCFunction)TritonContext_enableDecodeCache,                      METH_O,             ""},
         {"enableMode",                          (PyCFunction)TritonContext_enableMode,                             METH_VARARGS,       ""},
+        {"enableModelCache",                    (PyCFunction)TritonContext_enableModelCache,                       METH_O,             ""},
+        {"enableSolverCache",                   (PyCFunction)TritonContext_enableSolverCache,                      METH_O,             ""},
         {"enableSymbolicEngine",                (PyCFunction)TritonContext_enableSymbolicEngine,                   METH_O,             ""},
         {"enableTaintEngine",                   (PyCFunction)TritonContext_enableTaintEngine,                      METH_O,             ""},
         {"evaluateAstViaZ3",                    (PyCFunction)TritonContext_evaluateAstViaZ3,                       METH_O,             ""},
@@ -2807,18 +3358,24 @@ namespace triton {
         {"getConcreteMemoryValue",              (PyCFunction)TritonContext_getConcreteMemoryValue,                 METH_O,             ""},
         {"getConcreteRegisterValue",            (PyCFunction)TritonContext_getConcreteRegisterValue,               METH_O,             ""},
         {"getConcreteVariableValue",            (PyCFunction)TritonContext_getConcreteVariableValue,               METH_O,             ""},
+        {"getConstraintPartitioningStats",      (PyCFunction)TritonContext_getConstraintPartitioningStats,         METH_NOARGS,        ""},
+        {"getDecodeCacheStats",                 (PyCFunction)TritonContext_getDecodeCacheStats,                    METH_NOARGS,        ""},
         {"getGprBitSize",                       (PyCFunction)TritonContext_getGprBitSize,                          METH_NOARGS,        ""},
         {"getGprSize",                          (PyCFunction)TritonContext_getGprSize,                             METH_NOARGS,        ""},
         {"getImmediateAst",                     (PyCFunction)TritonContext_getImmediateAst,                        METH_O,             ""},
         {"getMemoryAst",                        (PyCFunction)TritonContext_getMemoryAst,                           METH_O,             ""},
         {"getModel",                            (PyCFunction)TritonContext_getModel,                               METH_O,             ""},
+        {"getModelCacheStats",                  (PyCFunction)TritonContext_getModelCacheStats,                     METH_NOARGS,        ""},
         {"getModels",                           (PyCFunction)TritonContext_getModels,                              METH_VARARGS,       ""},
+        {"getNumberOfSolverSessionConstraints", (PyCFunction)TritonContext_getNumberOfSolverSessionConstraints,    METH_NOARGS,        ""},
         {"getParentRegister",                   (PyCFunction)TritonContext_getParentRegister,                      METH_O,             ""},
         {"getParentRegisters",                  (PyCFunction)TritonContext_getParentRegisters,                     METH_NOARGS,        ""},
         {"getPathConstraints",                  (PyCFunction)TritonContext_getPathConstraints,                     METH_NOARGS,        ""},
         {"getPathConstraintsAst",               (PyCFunction)TritonContext_getPathConstraintsAst,                  METH_NOARGS,        ""},
         {"getRegister",                         (PyCFunction)TritonContext_getRegister,                            METH_O,             ""},
         {"getRegisterAst",                      (PyCFunction)TritonContext_getRegisterAst,                         METH_O,             ""},
+        {"getSolverCacheStats",                 (PyCFunction)TritonContext_getSolverCacheStats,                    METH_NOARGS,        ""},
+        {"getSolverSessionModel",               (PyCFunction)TritonContext_getSolverSessionModel,                  METH_O,             ""},
         {"getSymbolicExpressionFromId",         (PyCFunction)TritonContext_getSymbolicExpressionFromId,            METH_O,             ""},
         {"getSymbolicExpressions",              (PyCFunction)TritonContext_getSymbolicExpressions,                 METH_NOARGS,        ""},
         {"getSymbolicMemory",                   (PyCFunction)TritonContext_getSymbolicMemory,                      METH_VARARGS,       ""},
@@ -2829,29 +3386,40 @@ namespace triton {
         {"getSymbolicVariableFromId",           (PyCFunction)TritonContext_getSymbolicVariableFromId,              METH_O,             ""},
         {"getSymbolicVariableFromName",         (PyCFunction)TritonContext_getSymbolicVariableFromName,            METH_O,             ""},
         {"getSymbolicVariables",                (PyCFunction)TritonContext_getSymbolicVariables,                   METH_NOARGS,        ""},
+        {"getTaintLabels",                      (PyCFunction)TritonContext_getTaintLabels,                         METH_O,             ""},
         {"getTaintedMemory",                    (PyCFunction)TritonContext_getTaintedMemory,                       METH_NOARGS,        ""},
         {"getTaintedRegisters",                 (PyCFunction)TritonContext_getTaintedRegisters,                    METH_NOARGS,        ""},
         {"getTaintedSymbolicExpressions",       (PyCFunction)TritonContext_getTaintedSymbolicExpressions,          METH_NOARGS,        ""},
         {"isArchitectureValid",                 (PyCFunction)TritonContext_isArchitectureValid,                    METH_NOARGS,        ""},
+        {"isConstraintPartitioningEnabled",     (PyCFunction)TritonContext_isConstraintPartitioningEnabled,        METH_NOARGS,        ""},
+        {"isDecodeCacheEnabled",                (PyCFunction)TritonContext_isDecodeCacheEnabled,                   METH_NOARGS,        ""},
         {"isFlag",                              (PyCFunction)TritonContext_isFlag,                                 METH_O,             ""},
         {"isMemoryMapped",                      (PyCFunction)TritonContext_isMemoryMapped,                         METH_VARARGS,       ""},
         {"isMemorySymbolized",                  (PyCFunction)TritonContext_isMemorySymbolized,                     METH_O,             ""},
         {"isMemoryTainted",                     (PyCFunction)TritonContext_isMemoryTainted,                        METH_O,             ""},
         {"isModeEnabled",                       (PyCFunction)TritonContext_isModeEnabled,                          METH_O,             ""},
+        {"isModelCacheEnabled",                 (PyCFunction)TritonContext_isModelCacheEnabled,                    METH_NOARGS,        ""},
         {"isRegister",                          (PyCFunction)TritonContext_isRegister,                             METH_O,             ""},
         {"isRegisterSymbolized",                (PyCFunction)TritonContext_isRegisterSymbolized,                   METH_O,             ""},
         {"isRegisterTainted",                   (PyCFunction)TritonContext_isRegisterTainted,                      METH_O,             ""},
         {"isRegisterValid",                     (PyCFunction)TritonContext_isRegisterValid,                        METH_O,             ""},
         {"isSat",                               (PyCFunction)TritonContext_isSat,                                  METH_O     ,        ""},
+        {"isSolverCacheEnabled",                (PyCFunction)TritonContext_isSolverCacheEnabled,                   METH_NOARGS,        ""},
+        {"isSolverSessionSat",                  (PyCFunction)TritonContext_isSolverSessionSat,                     METH_O,             ""},
+        {"isSolverSessionStarted",              (PyCFunction)TritonContext_isSolverSessionStarted,                 METH_NOARGS,        ""},
         {"isSymbolicEngineEnabled",             (PyCFunction)TritonContext_isSymbolicEngineEnabled,                METH_NOARGS,        ""},
         {"isSymbolicExpressionIdExists",        (PyCFunction)TritonContext_isSymbolicExpressionIdExists,           METH_O,             ""},
         {"isTaintEngineEnabled",                (PyCFunction)TritonContext_isTaintEngineEnabled,                   METH_NOARGS,        ""},
+        {"loadSolverCache",                     (PyCFunction)TritonContext_loadSolverCache,                        METH_O,             ""},
         {"newSymbolicExpression",               (PyCFunction)TritonContext_newSymbolicExpression,                  METH_VARARGS,       ""},
         {"newSymbolicVariable",                 (PyCFunction)TritonContext_newSymbolicVariable,                    METH_VARARGS,       ""},
+        {"popSolverSessionConstraints",         (PyCFunction)TritonContext_popSolverSessionConstraints,            METH_VARARGS,       ""},
         {"processing",                          (PyCFunction)TritonContext_processing,                             METH_O,             ""},
+        {"pushSolverSessionConstraint",         (PyCFunction)TritonContext_pushSolverSessionConstraint,            METH_O,             ""},
         {"removeAllCallbacks",                  (PyCFunction)TritonContext_removeAllCallbacks,                     METH_NOARGS,        ""},
         {"removeCallback",                      (PyCFunction)TritonContext_removeCallback,                         METH_VARARGS,       ""},
         {"reset",                               (PyCFunction)TritonContext_reset,                                  METH_NOARGS,        ""},
+        {"saveSolverCache",                     (PyCFunction)TritonContext_saveSolverCache,                        METH_O,             ""},
         {"setArchitecture",                     (PyCFunction)TritonContext_setArchitecture,                        METH_O,             ""},
         {"setAstRepresentationMode",            (PyCFunction)TritonContext_setAstRepresentationMode,               METH_O,             ""},
         {"setConcreteMemoryAreaValue",          (PyCFunction)TritonContext_setConcreteMemoryAreaValue,             METH_VARARGS,       ""},
@@ -2862,14 +3430,17 @@ namespace triton {
         {"setTaintRegister",                    (PyCFunction)TritonContext_setTaintRegister,                       METH_VARARGS,       ""},
         {"simplify",                            (PyCFunction)TritonContext_simplify,                               METH_VARARGS,       ""},
         {"sliceExpressions",                    (PyCFunction)TritonContext_sliceExpressions,                       METH_O,             ""},
+        {"solveAllBranches",                    (PyCFunction)TritonContext_solveAllBranches,                       METH_VARARGS,       ""},
+        {"startSolverSession",                  (PyCFunction)TritonContext_startSolverSession,                     METH_NOARGS,        ""},
+        {"stopSolverSession",                   (PyCFunction)TritonContext_stopSolverSession,                      METH_NOARGS,        ""},
         {"taintAssignmentMemoryImmediate",      (PyCFunction)TritonContext_taintAssignmentMemoryImmediate,         METH_O,             ""},
         {"taintAssignmentMemoryMemory",         (PyCFunction)TritonContext_taintAssignmentMemoryMemory,            METH_VARARGS,       ""},
         {"taintAssignmentMemoryRegister",       (PyCFunction)TritonContext_taintAssignmentMemoryRegister,          METH_VARARGS,       ""},
         {"taintAssignmentRegisterImmediate",    (PyCFunction)TritonContext_taintAssignmentRegisterImmediate,       METH_O,             ""},
         {"taintAssignmentRegisterMemory",       (PyCFunction)TritonContext_taintAssignmentRegisterMemory,          METH_VARARGS,       ""},
         {"taintAssignmentRegisterRegister",     (PyCFunction)TritonContext_taintAssignmentRegisterRegister,        METH_VARARGS,       ""},
-        {"taintMemory",                         (PyCFunction)TritonContext_taintMemory,                            METH_O,             ""},
-        {"taintRegister",                       (PyCFunction)TritonContext_taintRegister,                          METH_O,             ""},
+        {"taintMemory",                         (PyCFunction)TritonContext_taintMemory,                            METH_VARARGS,       ""},
+        {"taintRegister",                       (PyCFunction)TritonContext_taintRegister,                          METH_VARARGS,       ""},
         {"taintUnionMemoryImmediate",           (PyCFunction)TritonContext_taintUnionMemoryImmediate,              METH_O,             ""},
         {"taintUnionMemoryMemory",              (PyCFunction)TritonContext_taintUnionMemoryMemory,                 METH_VARARGS,       ""},
         {"taintUnionMemoryRegister",            (PyCFunction)TritonContext_taintUnionMemoryRegister,               METH_VARARGS,       ""},
@@ -2877,7 +3448,7 @@ namespace triton {
         {"taintUnionRegisterMemory",            (PyCFunction)TritonContext_taintUnionRegisterMemory,               METH_VARARGS,       ""},
         {"taintUnionRegisterRegister",          (PyCFunction)TritonContext_taintUnionRegisterRegister,             METH_VARARGS,       ""},
         {"unmapMemory",                         (PyCFunction)TritonContext_unmapMemory,                            METH_VARARGS,       ""},
-        {"unrollAst",                           (PyCFunction)TritonContext_unrollAst,                              METH_O,             ""},
+        {"unrollAst",                           (PyCFunction)TritonContext_unrollAst,                              METH_VARARGS,       ""},
         {"untaintMemory",                       (PyCFunction)TritonContext_untaintMemory,                          METH_O,             ""},
         {"untaintRegister",                     (PyCFunction)TritonContext_untaintRegister,                        METH_O,             ""},
         {nullptr,                               nullptr,                                                           0,                  nullptr}
@@ -0,0 +1,232 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <unordered_map>
+#include <vector>
+
+#include <triton/astContext.hpp>
+#include <triton/constraintPartitioner.hpp>
+#include <triton/symbolicExpression.hpp>
+#include <triton/symbolicVariable.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      /* The summary of a subtree without variable */
+      static const triton::usize NO_VARIABLE = static_cast<triton::usize>(-1);
+
+
+      /* The variables of a query, merged when they appear in the same subtree */
+      class VariableSets {
+        private:
+          //! The union-find forest of the variables (index -> parent index).
+          std::vector<triton::usize> parents;
+
+          //! The summary of the nodes already visited (node -> index of one of its variables or NO_VARIABLE).
+          std::unordered_map<triton::ast::AbstractNode*, triton::usize> summaries;
+
+          //! The indexes of the variables (variable id -> index).
+          std::unordered_map<triton::usize, triton::usize> indexes;
+
+        public:
+          //! The variables (index -> node).
+          std::vector<triton::ast::VariableNode*> nodes;
+
+          //! Returns the representative of the set of a variable.
+          triton::usize find(triton::usize index) {
+            while (this->parents[index] != index) {
+              this->parents[index] = this->parents[this->parents[index]];
+              index = this->parents[index];
+            }
+            return index;
+          }
+
+          //! Merges the sets of two variables.
+          void merge(triton::usize a, triton::usize b) {
+            a = this->find(a);
+            b = this->find(b);
+            if (a != b)
+              this->parents[std::max(a, b)] = std::min(a, b);
+          }
+
+          /*
+           * Merges the sets of the variables of a node and returns one of them (NO_VARIABLE if there is none).
+           * Each node is visited once, its summary being kept.
+           */
+          triton::usize summarize(const triton::ast::SharedAbstractNode& node) {
+            auto it = this->summaries.find(node.get());
+            if (it != this->summaries.end())
+              return it->second;
+
+            triton::usize summary = NO_VARIABLE;
+
+            switch (node->getKind()) {
+              case triton::ast::REFERENCE_NODE:
+                summary = this->summarize(reinterpret_cast<triton::ast::ReferenceNode*>(node.get())->getSymbolicExpression()->getAst());
+                break;
+
+              case triton::ast::VARIABLE_NODE: {
+                auto var = reinterpret_cast<triton::ast::VariableNode*>(node.get());
+                auto iit = this->indexes.find(var->getVar().getId());
+                if (iit != this->indexes.end()) {
+                  summary = iit->second;
+                }
+                else {
+                  summary = this->nodes.size();
+                  this->indexes[var->getVar().getId()] = summary;
+                  this->parents.push_back(summary);
+                  this->nodes.push_back(var);
+                }
+                break;
+              }
+
+              default:
+                for (const auto& child : node->getChildren()) {
+                  triton::usize index = this->summarize(child);
+                  if (index == NO_VARIABLE)
+                    continue;
+                  if (summary == NO_VARIABLE)
+                    summary = index;
+                  else
+                    this->merge(summary, index);
+                }
+                break;
+            }
+
+            this->summaries[node.get()] = summary;
+            return summary;
+          }
+      };
+
+
+      ConstraintPartitioner::ConstraintPartitioner() {
+        this->enabled = false;
+        this->clear();
+      }
+
+
+      bool ConstraintPartitioner::isEnabled(void) const {
+        return this->enabled;
+      }
+
+
+      void ConstraintPartitioner::enable(bool flag) {
+        this->enabled = flag;
+        if (flag == false)
+          this->clear();
+      }
+
+
+      triton::usize ConstraintPartitioner::getNumberOfQueries(void) const {
+        return this->queries;
+      }
+
+
+      triton::usize ConstraintPartitioner::getNumberOfConstraints(void) const {
+        return this->constraints;
+      }
+
+
+      triton::usize ConstraintPartitioner::getNumberOfSentConstraints(void) const {
+        return this->sentConstraints;
+      }
+
+
+      triton::usize ConstraintPartitioner::getNumberOfVariables(void) const {
+        return this->variables;
+      }
+
+
+      triton::usize ConstraintPartitioner::getNumberOfSentVariables(void) const {
+        return this->sentVariables;
+      }
+
+
+      triton::ast::SharedAbstractNode ConstraintPartitioner::partition(const triton::ast::SharedAbstractNode& node, std::map<triton::uint32, SolverModel>& concrete) {
+        std::vector<triton::ast::SharedAbstractNode> conjuncts;
+        std::vector<triton::ast::SharedAbstractNode> worklist = {node};
+        std::vector<triton::ast::SharedAbstractNode> sent;
+        std::vector<triton::usize> summaries;
+        std::vector<bool> relevant;
+        VariableSets sets;
+
+        /* Split the conjunctions */
+        while (!worklist.empty()) {
+          triton::ast::SharedAbstractNode n = worklist.back();
+          worklist.pop_back();
+          if (n->getKind() == triton::ast::LAND_NODE) {
+            const auto& children = n->getChildren();
+            worklist.insert(worklist.end(), children.rbegin(), children.rend());
+          }
+          else {
+            conjuncts.push_back(n);
+          }
+        }
+
+        /* Put the conjuncts which share variables in the same partition */
+        for (const auto& conjunct : conjuncts)
+          summaries.push_back(sets.summarize(conjunct));
+
+        /* The partitions of the conjuncts not satisfied by the concrete values are relevant */
+        relevant.resize(sets.nodes.size(), false);
+        for (triton::usize index = 0; index < conjuncts.size(); index++) {
+          if (conjuncts[index]->evaluate() == 0) {
+            if (summaries[index] == NO_VARIABLE)
+              sent.push_back(conjuncts[index]);
+            else
+              relevant[sets.find(summaries[index])] = true;
+          }
+        }
+
+        for (triton::usize index = 0; index < conjuncts.size(); index++) {
+          if (summaries[index] != NO_VARIABLE && relevant[sets.find(summaries[index])])
+            sent.push_back(conjuncts[index]);
+        }
+
+        /* The other variables keep their concrete value */
+        triton::usize sentVariables = 0;
+        concrete.clear();
+        for (triton::usize index = 0; index < sets.nodes.size(); index++) {
+          if (relevant[sets.find(index)]) {
+            sentVariables++;
+            continue;
+          }
+          const auto& var = sets.nodes[index]->getVar();
+          SolverModel model(var.getName(), node->getContext().getVariableValue(var.getId()));
+          concrete[model.getId()] = model;
+        }
+
+        this->queries++;
+        this->constraints     += conjuncts.size();
+        this->sentConstraints += sent.size();
+        this->variables       += sets.nodes.size();
+        this->sentVariables   += sentVariables;
+
+        if (sent.empty())
+          return nullptr;
+
+        if (sent.size() == 1)
+          return sent.front();
+
+        return node->getContext().land(sent);
+      }
+
+
+      void ConstraintPartitioner::clear(void) {
+        this->queries         = 0;
+        this->constraints     = 0;
+        this->sentConstraints = 0;
+        this->variables       = 0;
+        this->sentVariables   = 0;
+      }
+
+    };
+  };
+};
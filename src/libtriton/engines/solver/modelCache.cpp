@@ -0,0 +1,482 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/astContext.hpp>
+#include <triton/modelCache.hpp>
+#include <triton/symbolicExpression.hpp>
+#include <triton/symbolicVariable.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      /* Collects the variables of a node (variable id -> node), through its references */
+      static void collectVariables(const triton::ast::SharedAbstractNode& node,
+                                   std::unordered_set<triton::ast::AbstractNode*>& visited,
+                                   std::map<triton::usize, triton::ast::VariableNode*>& variables) {
+
+        if (visited.insert(node.get()).second == false)
+          return;
+
+        switch (node->getKind()) {
+          case triton::ast::REFERENCE_NODE:
+            collectVariables(reinterpret_cast<triton::ast::ReferenceNode*>(node.get())->getSymbolicExpression()->getAst(), visited, variables);
+            break;
+
+          case triton::ast::VARIABLE_NODE: {
+            auto var = reinterpret_cast<triton::ast::VariableNode*>(node.get());
+            variables[var->getVar().getId()] = var;
+            break;
+          }
+
+          default:
+            for (const auto& child : node->getChildren())
+              collectVariables(child, visited, variables);
+            break;
+        }
+      }
+
+
+      /* Returns the mask of a bitvector of `size` bits */
+      static triton::uint512 bitMask(triton::uint32 size) {
+        triton::uint512 mask = -1;
+        return mask >> (512 - size);
+      }
+
+
+      /* Returns true if the sign bit of a bitvector of `size` bits is set */
+      static bool isNegative(const triton::uint512& value, triton::uint32 size) {
+        return ((value >> (size - 1)) & 1) != 0;
+      }
+
+
+      /* Returns the two's complement of a bitvector of `size` bits */
+      static triton::uint512 negate(const triton::uint512& value, triton::uint32 size) {
+        return ((~value + 1) & bitMask(size));
+      }
+
+
+      /* Returns the magnitude of a signed bitvector of `size` bits */
+      static triton::uint512 magnitude(const triton::uint512& value, triton::uint32 size) {
+        return isNegative(value, size) ? negate(value, size) : value;
+      }
+
+
+      /* Returns the value of a decimal child (a size, a rotation or an extraction bound) */
+      static triton::uint32 decimalValue(const triton::ast::SharedAbstractNode& node) {
+        return reinterpret_cast<triton::ast::DecimalNode*>(node.get())->getValue().convert_to<triton::uint32>();
+      }
+
+
+      /*
+       * Returns the value of a node where the variables take `values` (variable id -> value) and the references
+       * the value of their expression. The AST is only read: no node is built and no parent is touched. `cache`
+       * keeps the values of the nodes already evaluated, so a shared subtree is evaluated once.
+       */
+      static triton::uint512 evaluate(const triton::ast::SharedAbstractNode& node,
+                                      const std::map<triton::usize, triton::uint512>& values,
+                                      std::unordered_map<triton::ast::AbstractNode*, triton::uint512>& cache) {
+
+        auto it = cache.find(node.get());
+        if (it != cache.end())
+          return it->second;
+
+        const triton::ast::ChildVector& children = node->getChildren();
+        triton::uint32 size = node->getBitvectorSize();
+        triton::uint512 ret = 0;
+
+        auto arg = [&](triton::uint32 index) {
+          return evaluate(children[index], values, cache);
+        };
+
+        switch (node->getKind()) {
+          case triton::ast::BVADD_NODE:
+            ret = ((arg(0) + arg(1)) & bitMask(size));
+            break;
+
+          case triton::ast::BVAND_NODE:
+            ret = (arg(0) & arg(1));
+            break;
+
+          case triton::ast::BVASHR_NODE: {
+            triton::uint512 value = arg(0);
+            triton::uint512 shift = arg(1);
+            if (shift >= size)
+              ret = isNegative(value, size) ? bitMask(size) : 0;
+            else if (isNegative(value, size))
+              ret = ((value >> shift.convert_to<triton::uint32>()) | (bitMask(size) ^ (bitMask(size) >> shift.convert_to<triton::uint32>())));
+            else
+              ret = (value >> shift.convert_to<triton::uint32>());
+            break;
+          }
+
+          case triton::ast::BVLSHR_NODE: {
+            triton::uint512 shift = arg(1);
+            ret = (shift >= size) ? 0 : (arg(0) >> shift.convert_to<triton::uint32>());
+            break;
+          }
+
+          case triton::ast::BVMUL_NODE:
+            ret = ((arg(0) * arg(1)) & bitMask(size));
+            break;
+
+          case triton::ast::BVNAND_NODE:
+            ret = (~(arg(0) & arg(1)) & bitMask(size));
+            break;
+
+          case triton::ast::BVNEG_NODE:
+            ret = negate(arg(0), size);
+            break;
+
+          case triton::ast::BVNOR_NODE:
+            ret = (~(arg(0) | arg(1)) & bitMask(size));
+            break;
+
+          case triton::ast::BVNOT_NODE:
+            ret = (~arg(0) & bitMask(size));
+            break;
+
+          case triton::ast::BVOR_NODE:
+            ret = (arg(0) | arg(1));
+            break;
+
+          case triton::ast::BVROL_NODE:
+          case triton::ast::BVROR_NODE: {
+            triton::uint32 rot = decimalValue(children[0]) % size;
+            triton::uint512 value = arg(1);
+            if (rot != 0 && node->getKind() == triton::ast::BVROL_NODE)
+              value = (((value << rot) | (value >> (size - rot))) & bitMask(size));
+            else if (rot != 0)
+              value = (((value >> rot) | (value << (size - rot))) & bitMask(size));
+            ret = value;
+            break;
+          }
+
+          case triton::ast::BVSDIV_NODE: {
+            triton::uint512 op1 = arg(0);
+            triton::uint512 op2 = arg(1);
+            if (op2 == 0)
+              ret = isNegative(op1, size) ? 1 : bitMask(size);
+            else {
+              ret = (magnitude(op1, size) / magnitude(op2, size));
+              if (isNegative(op1, size) != isNegative(op2, size))
+                ret = negate(ret, size);
+            }
+            break;
+          }
+
+          case triton::ast::BVSMOD_NODE: {
+            triton::uint512 op1 = arg(0);
+            triton::uint512 op2 = arg(1);
+            if (op2 == 0)
+              ret = op1;
+            else {
+              /* The sign follows the divisor */
+              triton::uint512 rem = (magnitude(op1, size) % magnitude(op2, size));
+              if (rem != 0 && isNegative(op1, size) != isNegative(op2, size))
+                rem = (isNegative(op1, size) ? (op2 - rem) : (rem + op2)) & bitMask(size);
+              else if (rem != 0 && isNegative(op1, size))
+                rem = negate(rem, size);
+              ret = rem;
+            }
+            break;
+          }
+
+          case triton::ast::BVSREM_NODE: {
+            triton::uint512 op1 = arg(0);
+            triton::uint512 op2 = arg(1);
+            if (op2 == 0)
+              ret = op1;
+            else {
+              /* The sign follows the dividend */
+              ret = (magnitude(op1, size) % magnitude(op2, size));
+              if (isNegative(op1, size))
+                ret = negate(ret, size);
+            }
+            break;
+          }
+
+          case triton::ast::BVSHL_NODE: {
+            triton::uint512 shift = arg(1);
+            ret = (shift >= size) ? 0 : ((arg(0) << shift.convert_to<triton::uint32>()) & bitMask(size));
+            break;
+          }
+
+          case triton::ast::BVSUB_NODE:
+            ret = ((arg(0) - arg(1)) & bitMask(size));
+            break;
+
+          case triton::ast::BVUDIV_NODE: {
+            triton::uint512 op2 = arg(1);
+            ret = (op2 == 0) ? bitMask(size) : (arg(0) / op2);
+            break;
+          }
+
+          case triton::ast::BVUREM_NODE: {
+            triton::uint512 op2 = arg(1);
+            ret = (op2 == 0) ? arg(0) : (arg(0) % op2);
+            break;
+          }
+
+          case triton::ast::BVXNOR_NODE:
+            ret = (~(arg(0) ^ arg(1)) & bitMask(size));
+            break;
+
+          case triton::ast::BVXOR_NODE:
+            ret = (arg(0) ^ arg(1));
+            break;
+
+          /* Signed comparisons are unsigned ones once the sign bits are flipped */
+          case triton::ast::BVSGE_NODE:
+          case triton::ast::BVSGT_NODE:
+          case triton::ast::BVSLE_NODE:
+          case triton::ast::BVSLT_NODE: {
+            triton::uint512 sign = triton::uint512(1) << (children[0]->getBitvectorSize() - 1);
+            triton::uint512 op1  = (arg(0) ^ sign);
+            triton::uint512 op2  = (arg(1) ^ sign);
+            switch (node->getKind()) {
+              case triton::ast::BVSGE_NODE: ret = (op1 >= op2); break;
+              case triton::ast::BVSGT_NODE: ret = (op1 > op2);  break;
+              case triton::ast::BVSLE_NODE: ret = (op1 <= op2); break;
+              default:                      ret = (op1 < op2);  break;
+            }
+            break;
+          }
+
+          case triton::ast::BVUGE_NODE:
+            ret = (arg(0) >= arg(1));
+            break;
+
+          case triton::ast::BVUGT_NODE:
+            ret = (arg(0) > arg(1));
+            break;
+
+          case triton::ast::BVULE_NODE:
+            ret = (arg(0) <= arg(1));
+            break;
+
+          case triton::ast::BVULT_NODE:
+            ret = (arg(0) < arg(1));
+            break;
+
+          case triton::ast::BV_NODE:
+            ret = (reinterpret_cast<triton::ast::DecimalNode*>(children[0].get())->getValue() & bitMask(size));
+            break;
+
+          case triton::ast::CONCAT_NODE:
+            ret = arg(0);
+            for (triton::uint32 index = 1; index < children.size(); index++)
+              ret = ((ret << children[index]->getBitvectorSize()) | arg(index));
+            break;
+
+          case triton::ast::DECIMAL_NODE:
+            ret = reinterpret_cast<triton::ast::DecimalNode*>(node.get())->getValue();
+            break;
+
+          case triton::ast::DISTINCT_NODE:
+            ret = (arg(0) != arg(1));
+            break;
+
+          case triton::ast::EQUAL_NODE:
+            ret = (arg(0) == arg(1));
+            break;
+
+          case triton::ast::EXTRACT_NODE:
+            ret = ((arg(2) >> decimalValue(children[1])) & bitMask(size));
+            break;
+
+          case triton::ast::ITE_NODE:
+            ret = (arg(0) != 0) ? arg(1) : arg(2);
+            break;
+
+          case triton::ast::LAND_NODE:
+            ret = 1;
+            for (triton::uint32 index = 0; ret != 0 && index < children.size(); index++)
+              ret = (arg(index) != 0);
+            break;
+
+          case triton::ast::LET_NODE:
+            ret = arg(2);
+            break;
+
+          case triton::ast::LNOT_NODE:
+            ret = (arg(0) == 0);
+            break;
+
+          case triton::ast::LOR_NODE:
+            ret = 0;
+            for (triton::uint32 index = 0; ret == 0 && index < children.size(); index++)
+              ret = (arg(index) != 0);
+            break;
+
+          case triton::ast::REFERENCE_NODE:
+            ret = evaluate(reinterpret_cast<triton::ast::ReferenceNode*>(node.get())->getSymbolicExpression()->getAst(), values, cache);
+            break;
+
+          case triton::ast::SX_NODE: {
+            triton::uint32 childSize = children[1]->getBitvectorSize();
+            triton::uint512 value = arg(1);
+            ret = isNegative(value, childSize) ? ((value | ~bitMask(childSize)) & bitMask(size)) : value;
+            break;
+          }
+
+          case triton::ast::VARIABLE_NODE:
+            ret = (values.at(reinterpret_cast<triton::ast::VariableNode*>(node.get())->getVar().getId()) & bitMask(size));
+            break;
+
+          case triton::ast::ZX_NODE:
+            ret = arg(1);
+            break;
+
+          /* A string has no value */
+          default:
+            break;
+        }
+
+        cache[node.get()] = ret;
+        return ret;
+      }
+
+
+      /* Returns true if two models have the same values */
+      static bool isSameModel(const std::map<triton::uint32, SolverModel>& a, const std::map<triton::uint32, SolverModel>& b) {
+        if (a.size() != b.size())
+          return false;
+
+        for (auto ait = a.begin(), bit = b.begin(); ait != a.end(); ait++, bit++) {
+          if (ait->first != bit->first || ait->second.getValue() != bit->second.getValue())
+            return false;
+        }
+
+        return true;
+      }
+
+
+      ModelCache::ModelCache() {
+        this->enabled = false;
+        this->maxSize = MODEL_CACHE_DEFAULT_SIZE;
+        this->hits    = 0;
+        this->misses  = 0;
+      }
+
+
+      bool ModelCache::isEnabled(void) const {
+        return this->enabled;
+      }
+
+
+      void ModelCache::enable(bool flag) {
+        this->enabled = flag;
+        if (flag == false)
+          this->clear();
+      }
+
+
+      triton::usize ModelCache::getMaxSize(void) const {
+        return this->maxSize;
+      }
+
+
+      void ModelCache::setMaxSize(triton::usize size) {
+        this->maxSize = size;
+        while (this->models.size() > this->maxSize)
+          this->models.pop_back();
+      }
+
+
+      triton::usize ModelCache::getSize(void) const {
+        return this->models.size();
+      }
+
+
+      triton::usize ModelCache::getHits(void) const {
+        return this->hits;
+      }
+
+
+      triton::usize ModelCache::getMisses(void) const {
+        return this->misses;
+      }
+
+
+      bool ModelCache::lookup(const triton::ast::SharedAbstractNode& node, std::map<triton::uint32, SolverModel>& model) {
+        std::map<triton::usize, triton::ast::VariableNode*> variables;
+        std::unordered_set<triton::ast::AbstractNode*> visited;
+        std::set<std::vector<triton::uint512>> tried;
+
+        collectVariables(node, visited, variables);
+
+        for (auto it = this->models.begin(); !variables.empty() && it != this->models.end(); it++) {
+          std::unordered_map<triton::ast::AbstractNode*, triton::uint512> cache;
+          std::map<triton::usize, triton::uint512> values;
+          std::vector<triton::uint512> key;
+
+          /* The variables which are not in the model take their concrete value */
+          for (const auto& var : variables) {
+            auto mit = it->find(static_cast<triton::uint32>(var.first));
+            values[var.first] = (mit != it->end()) ? mit->second.getValue() : node->getContext().getVariableValue(var.first);
+            key.push_back(values[var.first]);
+          }
+
+          /* Models may have the same values for the variables of the node */
+          if (tried.insert(key).second == false)
+            continue;
+
+          if (evaluate(node, values, cache) == 0)
+            continue;
+
+          model.clear();
+          for (const auto& var : variables) {
+            SolverModel item(var.second->getVar().getName(), values[var.first]);
+            model[item.getId()] = item;
+          }
+
+          /* Becomes the most recently used model */
+          this->models.splice(this->models.begin(), this->models, it);
+
+          this->hits++;
+          return true;
+        }
+
+        this->misses++;
+        return false;
+      }
+
+
+      void ModelCache::insert(const std::map<triton::uint32, SolverModel>& model) {
+        if (this->enabled == false || this->maxSize == 0 || model.empty())
+          return;
+
+        for (auto it = this->models.begin(); it != this->models.end(); it++) {
+          if (isSameModel(*it, model)) {
+            this->models.erase(it);
+            break;
+          }
+        }
+
+        this->models.push_front(model);
+        this->setMaxSize(this->maxSize);
+      }
+
+
+      void ModelCache::clear(void) {
+        this->models.clear();
+        this->hits   = 0;
+        this->misses = 0;
+      }
+
+    };
+  };
+};
@@ -0,0 +1,427 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+#include <triton/exceptions.hpp>
+#include <triton/solverCache.hpp>
+#include <triton/symbolicExpression.hpp>
+#include <triton/symbolicVariable.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      /* The first line of a file saved by SolverCache::save() */
+      static const char* SOLVER_CACHE_FILE_MAGIC = "triton-solver-cache 2";
+
+
+      /* Writes a string as hexadecimal digits, so a canonical line never contains a separator */
+      static void writeHexString(std::ostream& stream, const std::string& value) {
+        static const char* digits = "0123456789abcdef";
+
+        stream << "s";
+        for (unsigned char c : value)
+          stream << digits[c >> 4] << digits[c & 0xf];
+      }
+
+
+      /* Mixes the bits of a 64-bit value (splitmix64 finalizer) */
+      static triton::uint64 digestMix(triton::uint64 value) {
+        value ^= value >> 30;
+        value *= 0xbf58476d1ce4e5b9ULL;
+        value ^= value >> 27;
+        value *= 0x94d049bb133111ebULL;
+        value ^= value >> 31;
+        return value;
+      }
+
+
+      /* Returns the line of a node which is not a reference, its children being already numbered */
+      static std::string getCanonicalLine(triton::ast::AbstractNode* node, const std::unordered_map<triton::ast::AbstractNode*, triton::uint32>& nodes) {
+        std::ostringstream line;
+
+        line << node->getKind() << " " << node->getBitvectorSize();
+
+        switch (node->getKind()) {
+          case triton::ast::DECIMAL_NODE:
+            line << " " << std::hex << reinterpret_cast<triton::ast::DecimalNode*>(node)->getValue() << std::dec;
+            break;
+
+          case triton::ast::STRING_NODE:
+            line << " ";
+            writeHexString(line, reinterpret_cast<triton::ast::StringNode*>(node)->getValue());
+            break;
+
+          case triton::ast::VARIABLE_NODE:
+            line << " ";
+            writeHexString(line, reinterpret_cast<triton::ast::VariableNode*>(node)->getVar().getName());
+            break;
+
+          default:
+            break;
+        }
+
+        for (const auto& child : node->getChildren())
+          line << " " << nodes.at(child.get());
+
+        return line.str();
+      }
+
+
+      SolverCache::SolverCache() {
+        this->enabled = false;
+        this->maxSize = SOLVER_CACHE_DEFAULT_SIZE;
+        this->hits    = 0;
+        this->misses  = 0;
+      }
+
+
+      SolverCache::SolverCache(const SolverCache& other) {
+        this->copy(other);
+      }
+
+
+      SolverCache& SolverCache::operator=(const SolverCache& other) {
+        if (this != &other)
+          this->copy(other);
+        return *this;
+      }
+
+
+      void SolverCache::copy(const SolverCache& other) {
+        this->enabled = other.enabled;
+        this->maxSize = other.maxSize;
+        this->hits    = other.hits;
+        this->misses  = other.misses;
+        this->entries = other.entries;
+
+        /* The index refers to the entries of this cache */
+        this->index.clear();
+        for (auto it = this->entries.begin(); it != this->entries.end(); it++)
+          this->index.emplace(it->digest.convert_to<triton::uint64>(), it);
+      }
+
+
+      bool SolverCache::isEnabled(void) const {
+        return this->enabled;
+      }
+
+
+      void SolverCache::enable(bool flag) {
+        this->enabled = flag;
+        if (flag == false)
+          this->clear();
+      }
+
+
+      triton::usize SolverCache::getMaxSize(void) const {
+        return this->maxSize;
+      }
+
+
+      void SolverCache::setMaxSize(triton::usize size) {
+        this->maxSize = size;
+
+        while (this->entries.size() > this->maxSize)
+          this->erase(std::prev(this->entries.end()));
+      }
+
+
+      triton::usize SolverCache::getSize(void) const {
+        return this->entries.size();
+      }
+
+
+      triton::usize SolverCache::getHits(void) const {
+        return this->hits;
+      }
+
+
+      triton::usize SolverCache::getMisses(void) const {
+        return this->misses;
+      }
+
+
+      std::string SolverCache::getCanonicalForm(const triton::ast::SharedAbstractNode& node) {
+        /* The numbers of the nodes already visited and of the lines already written */
+        std::unordered_map<triton::ast::AbstractNode*, triton::uint32> nodes;
+        std::unordered_map<std::string, triton::uint32> lines;
+        /* The nodes to visit, true once their children are pushed */
+        std::vector<std::pair<triton::ast::AbstractNode*, bool>> worklist;
+        std::string form;
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("SolverCache::getCanonicalForm(): node cannot be null.");
+
+        /* Post-order, so the line of a node is written after the ones of its children */
+        worklist.push_back({node.get(), false});
+        while (!worklist.empty()) {
+          triton::ast::AbstractNode* current = worklist.back().first;
+
+          if (nodes.find(current) != nodes.end()) {
+            worklist.pop_back();
+            continue;
+          }
+
+          /* A reference has the number of the AST of its expression */
+          triton::ast::AbstractNode* ast = nullptr;
+          if (current->getKind() == triton::ast::REFERENCE_NODE)
+            ast = reinterpret_cast<triton::ast::ReferenceNode*>(current)->getSymbolicExpression()->getAst().get();
+
+          if (worklist.back().second == false) {
+            worklist.back().second = true;
+            if (ast != nullptr) {
+              worklist.push_back({ast, false});
+            }
+            else {
+              const auto& children = current->getChildren();
+              for (auto it = children.rbegin(); it != children.rend(); it++)
+                worklist.push_back({it->get(), false});
+            }
+            continue;
+          }
+
+          worklist.pop_back();
+
+          if (ast != nullptr) {
+            nodes[current] = nodes.at(ast);
+            continue;
+          }
+
+          /* Identical subtrees share the same line */
+          std::string line = getCanonicalLine(current, nodes);
+          auto it = lines.find(line);
+          if (it == lines.end()) {
+            it = lines.emplace(line, static_cast<triton::uint32>(lines.size())).first;
+            form += line;
+            form += "\n";
+          }
+
+          nodes[current] = it->second;
+        }
+
+        return form;
+      }
+
+
+      triton::uint256 SolverCache::getDigest(const std::string& form) {
+        /* Four independent lanes, each one a bijective chain over the words of the form */
+        static const triton::uint64 keys[4] = {
+          0x9e3779b97f4a7c15ULL, 0xc2b2ae3d27d4eb4fULL, 0x165667b19e3779f9ULL, 0xd6e8feb86659fd93ULL
+        };
+        triton::uint64 lanes[4] = {keys[0], keys[1], keys[2], keys[3]};
+        triton::uint256 digest = 0;
+
+        for (triton::usize offset = 0; offset < form.size(); offset += 8) {
+          triton::uint64 word = 0;
+          for (triton::usize i = offset; i < form.size() && i < offset + 8; i++)
+            word |= static_cast<triton::uint64>(static_cast<unsigned char>(form[i])) << ((i - offset) * 8);
+
+          for (triton::uint32 lane = 0; lane < 4; lane++)
+            lanes[lane] = digestMix(lanes[lane] ^ (word * (keys[lane] | 1)));
+        }
+
+        for (triton::uint32 lane = 0; lane < 4; lane++)
+          digest = (digest << 64) | digestMix(lanes[lane] ^ form.size());
+
+        return digest;
+      }
+
+
+      std::list<SolverCache::Entry>::iterator SolverCache::find(const triton::uint256& digest) {
+        auto range = this->index.equal_range(digest.convert_to<triton::uint64>());
+
+        for (auto it = range.first; it != range.second; it++) {
+          if (it->second->digest == digest)
+            return it->second;
+        }
+
+        return this->entries.end();
+      }
+
+
+      void SolverCache::erase(std::list<Entry>::iterator entry) {
+        auto range = this->index.equal_range(entry->digest.convert_to<triton::uint64>());
+
+        for (auto it = range.first; it != range.second; it++) {
+          if (it->second == entry) {
+            this->index.erase(it);
+            break;
+          }
+        }
+
+        this->entries.erase(entry);
+      }
+
+
+      bool SolverCache::lookup(const std::string& form, triton::uint32 limit, status_e& status, std::list<std::map<triton::uint32, SolverModel>>& models) {
+        auto it = this->find(SolverCache::getDigest(form));
+
+        /* The entry must know the state and enough models */
+        if (it == this->entries.end() || (it->status == SAT && limit > it->models.size() && it->complete == false)) {
+          this->misses++;
+          return false;
+        }
+
+        /* Becomes the most recently used entry */
+        this->entries.splice(this->entries.begin(), this->entries, it);
+
+        status = it->status;
+        models.clear();
+        for (const auto& model : it->models) {
+          if (models.size() >= limit)
+            break;
+          models.push_back(model);
+        }
+
+        this->hits++;
+        return true;
+      }
+
+
+      void SolverCache::insert(const std::string& form, status_e status) {
+        if (this->enabled == false || this->maxSize == 0 || (status != SAT && status != UNSAT))
+          return;
+
+        Entry entry;
+        entry.digest   = SolverCache::getDigest(form);
+        entry.status   = status;
+        entry.complete = (status == UNSAT);
+
+        /* The models of a previous query are kept */
+        auto it = this->find(entry.digest);
+        if (it != this->entries.end()) {
+          entry.models   = std::move(it->models);
+          entry.complete = it->complete;
+          this->erase(it);
+        }
+
+        this->store(std::move(entry));
+      }
+
+
+      void SolverCache::insert(const std::string& form, status_e status, const std::list<std::map<triton::uint32, SolverModel>>& models, bool complete) {
+        if (this->enabled == false || this->maxSize == 0 || (status != SAT && status != UNSAT))
+          return;
+
+        Entry entry;
+        entry.digest   = SolverCache::getDigest(form);
+        entry.status   = status;
+        entry.models   = models;
+        entry.complete = complete || (status == UNSAT);
+
+        auto it = this->find(entry.digest);
+        if (it != this->entries.end())
+          this->erase(it);
+
+        this->store(std::move(entry));
+      }
+
+
+      void SolverCache::store(Entry&& entry) {
+        this->entries.push_front(std::move(entry));
+        this->index.emplace(this->entries.front().digest.convert_to<triton::uint64>(), this->entries.begin());
+        this->setMaxSize(this->maxSize);
+      }
+
+
+      void SolverCache::save(const std::string& filename) const {
+        std::ofstream file(filename);
+
+        if (!file)
+          throw triton::exceptions::SolverEngine("SolverCache::save(): Cannot open " + filename + ".");
+
+        file << SOLVER_CACHE_FILE_MAGIC << "\n";
+
+        /* From the least recently used entry, so the order is kept by load() */
+        for (auto it = this->entries.rbegin(); it != this->entries.rend(); it++) {
+          file << "entry " << std::hex << it->digest << std::dec << " " << it->status << " " << it->complete << " " << it->models.size() << "\n";
+
+          for (const auto& model : it->models) {
+            file << "model " << model.size() << "\n";
+            for (const auto& item : model)
+              file << item.second.getName() << " " << std::hex << item.second.getValue() << std::dec << "\n";
+          }
+        }
+
+        if (!file)
+          throw triton::exceptions::SolverEngine("SolverCache::save(): Cannot write " + filename + ".");
+      }
+
+
+      void SolverCache::load(const std::string& filename) {
+        std::ifstream file(filename);
+        std::string line;
+
+        if (!file)
+          throw triton::exceptions::SolverEngine("SolverCache::load(): Cannot open " + filename + ".");
+
+        if (!std::getline(file, line) || line != SOLVER_CACHE_FILE_MAGIC)
+          throw triton::exceptions::SolverEngine("SolverCache::load(): " + filename + " is not a solver cache.");
+
+        while (std::getline(file, line)) {
+          std::istringstream header(line);
+          std::string tag, digest;
+          triton::uint32 status = 0;
+          triton::usize count = 0;
+          Entry entry;
+
+          if (!(header >> tag >> digest >> status >> entry.complete >> count) || tag != "entry" || (status != SAT && status != UNSAT))
+            throw triton::exceptions::SolverEngine("SolverCache::load(): Invalid entry in " + filename + ".");
+
+          entry.digest = triton::uint256("0x" + digest);
+          entry.status = static_cast<status_e>(status);
+
+          for (triton::usize i = 0; i < count; i++) {
+            std::map<triton::uint32, SolverModel> model;
+            triton::usize size = 0;
+
+            if (!(file >> tag >> size) || tag != "model")
+              throw triton::exceptions::SolverEngine("SolverCache::load(): Invalid model in " + filename + ".");
+
+            for (triton::usize j = 0; j < size; j++) {
+              std::string name, value;
+              if (!(file >> name >> value))
+                throw triton::exceptions::SolverEngine("SolverCache::load(): Invalid model in " + filename + ".");
+              SolverModel item(name, triton::uint512("0x" + value));
+              model[item.getId()] = item;
+            }
+
+            entry.models.push_back(std::move(model));
+          }
+
+          /* Skips the end of the last line of models */
+          if (count)
+            std::getline(file, line);
+
+          /* An entry already cached is replaced */
+          auto it = this->find(entry.digest);
+          if (it != this->entries.end())
+            this->erase(it);
+
+          this->store(std::move(entry));
+        }
+      }
+
+
+      void SolverCache::clear(void) {
+        this->entries.clear();
+        this->index.clear();
+        this->hits   = 0;
+        this->misses = 0;
+      }
+
+    };
+  };
+};
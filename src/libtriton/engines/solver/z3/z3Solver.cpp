@@ -7,10 +7,16 @@
 
 #include <z3++.h>                        // for expr, model, solver, expr_ve...
 #include <z3_api.h>                      // for Z3_ast, _Z3_ast
+#include <climits>                       // for UINT_MAX
+#include <set>                           // for set
 #include <string>                        // for string
+#include <tuple>                         // for get
 
 #include <triton/astContext.hpp>         // for AstContext
+#include <triton/constraintPartitioner.hpp> // for ConstraintPartitioner
 #include <triton/exceptions.hpp>         // for SolverEngine
+#include <triton/modelCache.hpp>         // for ModelCache
+#include <triton/solverCache.hpp>        // for SolverCache
 #include <triton/z3Solver.hpp>           // for Z3Solver
 #include <triton/solverModel.hpp>        // for SolverModel
 #include <triton/tritonToZ3Ast.hpp>      // for TritonToZ3Ast
@@ -90,6 +96,70 @@ for (auto it = model.begin(); it != model.end(); it++) {
 }
 ~~~~~~~~~~~~~
 
+\section solver_interface_session Incremental session
+<hr>
+
+Each triton::API::getModel() query builds a new Z3 context, converts the whole constraint and solves it from scratch. When several
+queries share a prefix (e.g. flipping the branches of a path one after the other), an incremental session can be used instead. The
+session keeps one Z3 context and one solver alive: the symbolic expressions are converted once for all queries, and each constraint
+pushed with triton::API::pushSolverSessionConstraint() is asserted once until it is popped. A query (triton::API::getSolverSessionModel()
+or triton::API::isSolverSessionSat()) only adds its own constraint for the time of the check.
+
+~~~~~~~~~~~~~{.py}
+>>> ctx.startSolverSession()
+>>> for pc in ctx.getPathConstraints():
+...     for branch in pc.getBranchConstraints():
+...         if branch['isTaken'] == False:
+...             model = ctx.getSolverSessionModel(branch['constraint'])
+...     ctx.pushSolverSessionConstraint(pc.getTakenPathConstraintAst())
+...
+>>> ctx.stopSolverSession()
+~~~~~~~~~~~~~
+
+\section solver_interface_cache Query cache
+<hr>
+
+The same queries are often sent several times (e.g. a branch of a loop checked at each iteration, or the same inputs replayed by
+another run). When the cache is enabled with triton::API::enableSolverCache(), the answers of triton::API::getModel(), triton::API::getModels()
+and triton::API::isSat() are kept (see triton::engines::solver::SolverCache). A constraint is identified by its canonical form, where the
+references are unrolled, so two structurally identical constraints share the same answer even if they are built from different symbolic
+expressions. The least recently used answers are dropped when the cache is full, and the cache can be kept between two runs.
+
+~~~~~~~~~~~~~{.py}
+>>> ctx.enableSolverCache(True)
+>>> ctx.loadSolverCache('solver.cache')
+>>> model = ctx.getModel(constraint)
+>>> ctx.getSolverCacheStats()
+{'hits': 1, 'misses': 0, 'size': 12}
+>>> ctx.saveSolverCache('solver.cache')
+~~~~~~~~~~~~~
+
+\section solver_interface_model_cache Model reuse
+<hr>
+
+A new constraint is often satisfied by a model already found for another one (e.g. several branches which only need an input greater
+than a bound). When the model cache is enabled with triton::API::enableModelCache(), triton::API::getModel() and triton::API::isSat()
+first evaluate the constraint under the models already found (see triton::engines::solver::ModelCache) and only call the solver if none
+of them satisfies it. The variables which are not in a model take their concrete value, which is not modified by the evaluation.
+triton::API::getModelCache() returns the number of queries answered without the solver.
+
+\section solver_interface_partitioning Constraint partitioning
+<hr>
+
+A path predicate is mostly made of constraints which do not share any variable with the branch to flip (e.g. the checks of the
+other bytes of an input). When the partitioning is enabled with triton::API::enableConstraintPartitioning(), triton::API::getModel()
+and triton::API::isSat() split the conjunctions of the query and group the constraints which share variables (see
+triton::engines::solver::ConstraintPartitioner). Only the groups of the constraints which are not satisfied by the concrete values
+are sent to the solver, and the other variables keep their concrete value in the model. triton::API::getConstraintPartitioner()
+returns the number of constraints and variables sent to the solver.
+
+~~~~~~~~~~~~~{.py}
+>>> ctx.enableConstraintPartitioning(True)
+>>> model = ctx.getModel(constraint)
+>>> ctx.getConstraintPartitioningStats()
+{'constraints': 64, 'queries': 1, 'sentConstraints': 2, 'sentVariables': 1, 'variables': 32}
+~~~~~~~~~~~~~
+
 */
 
 
@@ -109,82 +179,210 @@ namespace triton {
       }
 
 
+      /* Converts a z3's model to a Triton's model. The constraints which exclude this model are added to `escape` (if not null) */
+      static std::map<triton::uint32, SolverModel> getTritonModel(const z3::model& m, z3::expr_vector* escape) {
+        std::map<triton::uint32, SolverModel> smodel;
+        z3::context& ctx = m.ctx();
+
+        for (triton::uint32 i = 0; i < m.size(); i++) {
+
+          /* Get the z3 variable */
+          z3::func_decl z3Variable = m[i];
+
+          /* Get the name as std::string from a z3 variable */
+          std::string varName = z3Variable.name().str();
+
+          /* Get z3 expr */
+          z3::expr exp = m.get_const_interp(z3Variable);
+
+          /* Get the size of a z3 expr */
+          triton::uint32 bvSize = exp.get_sort().bv_size();
+
+          /* Get the value of a z3 expr */
+          std::string svalue = Z3_get_numeral_string(ctx, exp);
+
+          /* Convert a string value to a integer value */
+          triton::uint512 value = triton::uint512(svalue);
+
+          /* Create a triton model */
+          SolverModel trionModel = SolverModel(varName, value);
+
+          /* Map the result */
+          smodel[trionModel.getId()] = trionModel;
+
+          /* Uniq result */
+          if (escape != nullptr && exp.get_sort().is_bv())
+            escape->push_back(ctx.bv_const(varName.c_str(), bvSize) != ctx.bv_val(svalue.c_str(), bvSize));
+        }
+
+        return smodel;
+      }
+
+
+      /*! \brief An incremental solving session.
+       *
+       * \details Each constraint pushed is asserted in its own scope of the solver.
+       */
+      struct Z3Solver::Session {
+        //! The persistent converter, it owns the z3's context of the session.
+        triton::ast::TritonToZ3Ast converter;
+
+        //! The solver. Declared after the converter whose context must outlive it.
+        z3::solver solver;
+
+        //! The number of constraints pushed.
+        triton::usize constraints;
+
+        //! Constructor.
+        Session(triton::engines::symbolic::SymbolicEngine* symbolicEngine)
+          : converter(symbolicEngine, false, true),
+            solver(converter.getContext()),
+            constraints(0) {
+        }
+
+        //! Sets the time budget (in milliseconds) of each check, 0 for no limit.
+        void setTimeout(triton::uint32 timeout) {
+          z3::params p(this->converter.getContext());
+          p.set("timeout", timeout ? timeout : UINT_MAX);
+          this->solver.set(p);
+        }
+
+        //! Checks the constraints of the session and `node` (which is not kept). The model is set if it is satisfiable and `model` is not null.
+        status_e check(const triton::ast::SharedAbstractNode& node, std::map<triton::uint32, SolverModel>* model) {
+          status_e status = UNKNOWN;
+          z3::expr expr   = this->converter.convert(node);
+
+          this->solver.push();
+          this->solver.add(expr);
+
+          try {
+            switch (this->solver.check()) {
+              case z3::sat:
+                status = SAT;
+                if (model != nullptr)
+                  *model = getTritonModel(this->solver.get_model(), nullptr);
+                break;
+              case z3::unsat:
+                status = UNSAT;
+                break;
+              default:
+                status = (this->solver.reason_unknown() == "timeout" || this->solver.reason_unknown() == "canceled") ? TIMEOUT : UNKNOWN;
+                break;
+            }
+          }
+          catch (const z3::exception&) {
+            this->solver.pop();
+            throw;
+          }
+
+          this->solver.pop();
+          return status;
+        }
+      };
+
+
       Z3Solver::Z3Solver(triton::engines::symbolic::SymbolicEngine* symbolicEngine) {
         if (symbolicEngine == nullptr)
           throw triton::exceptions::SolverEngine("Z3Solver::Z3Solver(): The symbolicEngine API cannot be null.");
         this->symbolicEngine = symbolicEngine;
+        this->session = nullptr;
       }
 
 
       Z3Solver::Z3Solver(const Z3Solver& other) {
+        /* A session is not spread to the copy */
         this->symbolicEngine = other.symbolicEngine;
+        this->session = nullptr;
+        this->cache = other.cache;
+        this->modelCache = other.modelCache;
+        this->partitioner = other.partitioner;
+      }
+
+
+      Z3Solver::~Z3Solver() {
+        this->stopSession();
       }
 
 
       Z3Solver& Z3Solver::operator=(const Z3Solver& other) {
+        this->stopSession();
         this->symbolicEngine = other.symbolicEngine;
+        this->cache = other.cache;
+        this->modelCache = other.modelCache;
+        this->partitioner = other.partitioner;
         return *this;
       }
 
 
       std::list<std::map<triton::uint32, SolverModel>> Z3Solver::getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit) const {
         std::list<std::map<triton::uint32, SolverModel>> ret;
-        triton::ast::TritonToZ3Ast z3Ast{this->symbolicEngine, false};
-
-        try {
-          z3::expr      expr = z3Ast.convert(node);
-          z3::context&  ctx  = expr.ctx();
-          z3::solver    solver(ctx);
+        std::map<triton::uint32, SolverModel> concrete;
 
-          if (node == nullptr)
-            throw triton::exceptions::SolverEngine("Z3Solver::getModels(): node cannot be null.");
-
-          if (node->isLogical() == false)
-            throw triton::exceptions::SolverEngine("Z3Solver::getModels(): Must be a logical node.");
-
-          /* Create a solver and add the expression */
-          solver.add(expr);
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("Z3Solver::getModels(): node cannot be null.");
 
-          /* Check if it is sat */
-          while (solver.check() == z3::sat && limit >= 1) {
+        if (node->isLogical() == false)
+          throw triton::exceptions::SolverEngine("Z3Solver::getModels(): Must be a logical node.");
 
-            /* Get model */
-            z3::model m = solver.get_model();
+        if (limit != 1 || this->partitioner.isEnabled() == false)
+          return this->solveModels(node, limit);
 
-            /* Traversing the model */
-            std::map<triton::uint32, SolverModel> smodel;
-            z3::expr_vector args(ctx);
-            for (triton::uint32 i = 0; i < m.size(); i++) {
+        /* Only the constraints relevant to the query are solved, the other variables keep their concrete value */
+        triton::ast::SharedAbstractNode query = this->partitioner.partition(node, concrete);
+        if (query == nullptr) {
+          ret.push_back(concrete);
+          return ret;
+        }
 
-              /* Get the z3 variable */
-              z3::func_decl z3Variable = m[i];
+        ret = this->solveModels(query, limit);
+        for (auto& model : ret)
+          model.insert(concrete.begin(), concrete.end());
 
-              /* Get the name as std::string from a z3 variable */
-              std::string varName = z3Variable.name().str();
+        return ret;
+      }
 
-              /* Get z3 expr */
-              z3::expr exp = m.get_const_interp(z3Variable);
 
-              /* Get the size of a z3 expr */
-              triton::uint32 bvSize = exp.get_sort().bv_size();
+      std::list<std::map<triton::uint32, SolverModel>> Z3Solver::solveModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit) const {
+        std::list<std::map<triton::uint32, SolverModel>> ret;
+        triton::ast::TritonToZ3Ast z3Ast{this->symbolicEngine, false};
+        status_e status = UNKNOWN;
+        bool complete = false;
+        std::string form;
+
+        if (this->cache.isEnabled()) {
+          form = SolverCache::getCanonicalForm(node);
+          if (this->cache.lookup(form, limit, status, ret))
+            return ret;
+        }
 
-              /* Get the value of a z3 expr */
-              std::string svalue = Z3_get_numeral_string(ctx, exp);
+        /* A model already found may satisfy the constraint */
+        if (limit == 1 && this->modelCache.isEnabled()) {
+          std::map<triton::uint32, SolverModel> model;
+          if (this->modelCache.lookup(node, model)) {
+            ret.push_back(model);
+            if (this->cache.isEnabled())
+              this->cache.insert(form, SAT, ret, false);
+            return ret;
+          }
+        }
 
-              /* Convert a string value to a integer value */
-              triton::uint512 value = triton::uint512(svalue);
+        try {
+          z3::expr      expr = z3Ast.convert(node);
+          z3::context&  ctx  = expr.ctx();
+          z3::solver    solver(ctx);
 
-              /* Create a triton model */
-              SolverModel trionModel = SolverModel(varName, value);
+          /* Create a solver and add the expression */
+          solver.add(expr);
 
-              /* Map the result */
-              smodel[trionModel.getId()] = trionModel;
+          /* Check if it is sat */
+          z3::check_result res = solver.check();
+          status = (res == z3::sat) ? SAT : (res == z3::unsat) ? UNSAT : UNKNOWN;
 
-              /* Uniq result */
-              if (exp.get_sort().is_bv())
-                args.push_back(ctx.bv_const(varName.c_str(), bvSize) != ctx.bv_val(svalue.c_str(), bvSize));
+          while (res == z3::sat && limit >= 1) {
 
-            }
+            /* Get model */
+            z3::expr_vector args(ctx);
+            std::map<triton::uint32, SolverModel> smodel = getTritonModel(solver.get_model(), &args);
 
             /* Escape last models */
             solver.add(triton::engines::solver::mk_or(args));
@@ -193,20 +391,32 @@ namespace triton {
             if (smodel.size() > 0)
               ret.push_back(smodel);
 
+            /* Keep it for the next queries */
+            this->modelCache.insert(smodel);
+
             /* Decrement the limit */
             limit--;
+
+            /* Check if there is another model */
+            res = solver.check();
           }
+
+          /* All the models are found if the last check is unsat */
+          complete = (res == z3::unsat);
         }
         catch (const z3::exception& e) {
           throw triton::exceptions::SolverEngine(std::string("Z3Solver::getModels(): ") + e.msg());
         }
 
+        if (this->cache.isEnabled())
+          this->cache.insert(form, status, ret, complete);
+
         return ret;
       }
 
 
       bool Z3Solver::isSat(const triton::ast::SharedAbstractNode& node) const {
-        triton::ast::TritonToZ3Ast z3Ast{this->symbolicEngine, false};
+        std::map<triton::uint32, SolverModel> concrete;
 
         if (node == nullptr)
           throw triton::exceptions::SolverEngine("Z3Solver::isSat(): node cannot be null.");
@@ -214,6 +424,38 @@ namespace triton {
         if (node->isLogical() == false)
           throw triton::exceptions::SolverEngine("Z3Solver::isSat(): Must be a logical node.");
 
+        if (this->partitioner.isEnabled() == false)
+          return this->solveSat(node);
+
+        /* The concrete values satisfy the constraints which are not relevant to the query */
+        triton::ast::SharedAbstractNode query = this->partitioner.partition(node, concrete);
+        if (query == nullptr)
+          return true;
+
+        return this->solveSat(query);
+      }
+
+
+      bool Z3Solver::solveSat(const triton::ast::SharedAbstractNode& node) const {
+        std::list<std::map<triton::uint32, SolverModel>> models;
+        std::map<triton::uint32, SolverModel> model;
+        triton::ast::TritonToZ3Ast z3Ast{this->symbolicEngine, false};
+        status_e status = UNKNOWN;
+        std::string form;
+
+        if (this->cache.isEnabled()) {
+          form = SolverCache::getCanonicalForm(node);
+          if (this->cache.lookup(form, 0, status, models))
+            return status == SAT;
+        }
+
+        /* A model already found may satisfy the constraint */
+        if (this->modelCache.isEnabled() && this->modelCache.lookup(node, model)) {
+          if (this->cache.isEnabled())
+            this->cache.insert(form, SAT);
+          return true;
+        }
+
         try {
           z3::expr      expr = z3Ast.convert(node);
           z3::context&  ctx  = expr.ctx();
@@ -223,11 +465,21 @@ namespace triton {
           solver.add(expr);
 
           /* Check if it is sat */
-          return solver.check() == z3::sat;
+          z3::check_result res = solver.check();
+          status = (res == z3::sat) ? SAT : (res == z3::unsat) ? UNSAT : UNKNOWN;
+
+          /* Keep the model for the next queries */
+          if (res == z3::sat && this->modelCache.isEnabled())
+            this->modelCache.insert(getTritonModel(solver.get_model(), nullptr));
         }
         catch (const z3::exception& e) {
           throw triton::exceptions::SolverEngine(std::string("Z3Solver::isSat(): ") + e.msg());
         }
+
+        if (this->cache.isEnabled())
+          this->cache.insert(form, status);
+
+        return status == SAT;
       }
 
 
@@ -247,6 +499,186 @@ namespace triton {
         return "z3";
       }
 
+
+      SolverCache& Z3Solver::getCache(void) {
+        return this->cache;
+      }
+
+
+      const SolverCache& Z3Solver::getCache(void) const {
+        return this->cache;
+      }
+
+
+      ModelCache& Z3Solver::getModelCache(void) {
+        return this->modelCache;
+      }
+
+
+      const ModelCache& Z3Solver::getModelCache(void) const {
+        return this->modelCache;
+      }
+
+
+      ConstraintPartitioner& Z3Solver::getPartitioner(void) {
+        return this->partitioner;
+      }
+
+
+      const ConstraintPartitioner& Z3Solver::getPartitioner(void) const {
+        return this->partitioner;
+      }
+
+
+      Z3Solver::Session& Z3Solver::getSession(const char* caller) const {
+        if (this->session == nullptr)
+          throw triton::exceptions::SolverEngine(std::string(caller) + ": No session started.");
+        return *this->session;
+      }
+
+
+      void Z3Solver::startSession(void) {
+        this->stopSession();
+
+        try {
+          this->session = new(std::nothrow) Session(this->symbolicEngine);
+        }
+        catch (const z3::exception& e) {
+          throw triton::exceptions::SolverEngine(std::string("Z3Solver::startSession(): ") + e.msg());
+        }
+
+        if (this->session == nullptr)
+          throw triton::exceptions::SolverEngine("Z3Solver::startSession(): Not enough memory.");
+      }
+
+
+      void Z3Solver::stopSession(void) {
+        delete this->session;
+        this->session = nullptr;
+      }
+
+
+      bool Z3Solver::isSessionStarted(void) const {
+        return this->session != nullptr;
+      }
+
+
+      void Z3Solver::pushSessionConstraint(const triton::ast::SharedAbstractNode& node) {
+        Session& session = this->getSession("Z3Solver::pushSessionConstraint()");
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("Z3Solver::pushSessionConstraint(): node cannot be null.");
+
+        if (node->isLogical() == false)
+          throw triton::exceptions::SolverEngine("Z3Solver::pushSessionConstraint(): Must be a logical node.");
+
+        try {
+          z3::expr expr = session.converter.convert(node);
+          session.solver.push();
+          session.solver.add(expr);
+          session.constraints++;
+        }
+        catch (const z3::exception& e) {
+          throw triton::exceptions::SolverEngine(std::string("Z3Solver::pushSessionConstraint(): ") + e.msg());
+        }
+      }
+
+
+      void Z3Solver::popSessionConstraints(triton::usize count) {
+        Session& session = this->getSession("Z3Solver::popSessionConstraints()");
+
+        if (count > session.constraints)
+          throw triton::exceptions::SolverEngine("Z3Solver::popSessionConstraints(): Not enough constraints in the session.");
+
+        if (count) {
+          session.solver.pop(static_cast<triton::uint32>(count));
+          session.constraints -= count;
+        }
+      }
+
+
+      triton::usize Z3Solver::getNumberOfSessionConstraints(void) const {
+        return this->getSession("Z3Solver::getNumberOfSessionConstraints()").constraints;
+      }
+
+
+      std::map<triton::uint32, SolverModel> Z3Solver::getSessionModel(const triton::ast::SharedAbstractNode& node) {
+        std::map<triton::uint32, SolverModel> ret;
+        Session& session = this->getSession("Z3Solver::getSessionModel()");
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("Z3Solver::getSessionModel(): node cannot be null.");
+
+        if (node->isLogical() == false)
+          throw triton::exceptions::SolverEngine("Z3Solver::getSessionModel(): Must be a logical node.");
+
+        try {
+          session.check(node, &ret);
+        }
+        catch (const z3::exception& e) {
+          throw triton::exceptions::SolverEngine(std::string("Z3Solver::getSessionModel(): ") + e.msg());
+        }
+
+        return ret;
+      }
+
+
+      bool Z3Solver::isSessionSat(const triton::ast::SharedAbstractNode& node) {
+        Session& session = this->getSession("Z3Solver::isSessionSat()");
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("Z3Solver::isSessionSat(): node cannot be null.");
+
+        if (node->isLogical() == false)
+          throw triton::exceptions::SolverEngine("Z3Solver::isSessionSat(): Must be a logical node.");
+
+        try {
+          return session.check(node, nullptr) == SAT;
+        }
+        catch (const z3::exception& e) {
+          throw triton::exceptions::SolverEngine(std::string("Z3Solver::isSessionSat(): ") + e.msg());
+        }
+      }
+
+
+      std::vector<BranchSolution> Z3Solver::solveBranches(const std::vector<triton::engines::symbolic::PathConstraint>& pathConstraints, bool dedup, triton::uint32 timeout) const {
+        std::vector<BranchSolution> ret;
+        std::set<std::pair<triton::uint64, triton::uint64>> solved;
+
+        try {
+          Session session(this->symbolicEngine);
+          session.setTimeout(timeout);
+
+          for (triton::usize index = 0; index < pathConstraints.size(); index++) {
+            const triton::engines::symbolic::PathConstraint& pc = pathConstraints[index];
+
+            /* Solve the branches which have not been taken */
+            for (const auto& branch : pc.getBranchConstraints()) {
+              if (std::get<0>(branch))
+                continue;
+
+              if (dedup && solved.insert(std::make_pair(std::get<1>(branch), std::get<2>(branch))).second == false)
+                continue;
+
+              BranchSolution solution;
+              solution.index   = index;
+              solution.srcAddr = std::get<1>(branch);
+              solution.dstAddr = std::get<2>(branch);
+              solution.status  = session.check(std::get<3>(branch), &solution.model);
+              ret.push_back(std::move(solution));
+            }
+
+            /* Then, the taken branch belongs to the prefix of the next ones */
+            session.solver.add(session.converter.convert(pc.getTakenPathConstraintAst()));
+          }
+        }
+        catch (const z3::exception& e) {
+          throw triton::exceptions::SolverEngine(std::string("Z3Solver::solveBranches(): ") + e.msg());
+        }
+
+        return ret;
+      }
+
     };
   };
 };
@@ -5,11 +5,11 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <algorithm>
 #include <cstring>
 #include <new>
 
 #include <triton/exceptions.hpp>
-#include <triton/coreUtils.hpp>
 #include <triton/symbolicEngine.hpp>
 #include <triton/astContext.hpp>
 
@@ -91,8 +91,13 @@ namespace triton {
         this->enableFlag        = true;
         this->uniqueSymExprId   = 0;
         this->uniqueSymVarId    = 0;
+        this->journalFlag       = false;
 
         this->symbolicReg.resize(this->numberOfRegisters);
+
+        /* The variables of the AST context are named by this engine */
+        if (this->backupFlag == false)
+          this->astCtxt.setSymbolicEngine(this);
       }
 
 
@@ -106,13 +111,23 @@ namespace triton {
         this->backupFlag                  = true;
         this->callbacks                   = other.callbacks;
         this->enableFlag                  = other.enableFlag;
+        this->lazyFlags                   = other.lazyFlags;
         this->memoryReference             = other.memoryReference;
+        this->memorySlices                = other.memorySlices;
         this->numberOfRegisters           = other.numberOfRegisters;
         this->symbolicExpressions         = other.symbolicExpressions;
         this->symbolicReg                 = other.symbolicReg;
         this->symbolicVariables           = other.symbolicVariables;
+        this->symbolicVariableNames       = other.symbolicVariableNames;
         this->uniqueSymExprId             = other.uniqueSymExprId;
         this->uniqueSymVarId              = other.uniqueSymVarId;
+
+        /* A journal is not spread to the copy */
+        this->journalFlag = false;
+        this->journalRegisters.clear();
+        this->journalMemory.clear();
+        this->journalAlignedMemory.clear();
+        this->journalExpressions.clear();
       }
 
 
@@ -153,6 +168,8 @@ namespace triton {
           /* Delete all symbolic variables */
           for (auto sv : this->symbolicVariables)
             delete sv.second;
+
+          this->astCtxt.setSymbolicEngine(nullptr);
         }
       }
 
@@ -168,14 +185,19 @@ namespace triton {
         if (!this->architecture->isRegisterValid(parentId))
           return;
 
-        this->symbolicReg[parentId] = nullptr;
+        /* A deferred flag must synchronize its concrete value first */
+        this->materializeLazyFlag(reg);
+
+        this->setSymbolicRegister(parentId, nullptr);
       }
 
 
       /* Same as concretizeRegister but with all registers */
       void SymbolicEngine::concretizeAllRegister(void) {
+        this->materializeLazyFlags();
+
         for (triton::uint32 i = 0; i < this->numberOfRegisters; i++)
-          this->symbolicReg[i] = nullptr;
+          this->setSymbolicRegister(i, nullptr);
       }
 
 
@@ -199,7 +221,7 @@ namespace triton {
        * before symbolic processing.
        */
       void SymbolicEngine::concretizeMemory(triton::uint64 addr) {
-        this->memoryReference.erase(addr);
+        this->removeMemoryRange(addr, BYTE_SIZE);
         if (this->modes.isModeEnabled(triton::modes::ALIGNED_MEMORY))
           this->removeAlignedMemory(addr, BYTE_SIZE);
       }
@@ -207,7 +229,21 @@ namespace triton {
 
       /* Same as concretizeMemory but with all address memory */
       void SymbolicEngine::concretizeAllMemory(void) {
+        if (this->journalFlag) {
+          if (!this->memoryReference.empty()) {
+            MemoryJournalEntry entry;
+            entry.ranges = this->memoryReference.getRanges();
+            entry.addr   = entry.ranges.front().first;
+            entry.size   = entry.ranges.back().first + entry.ranges.back().second.size - entry.addr;
+            entry.slices.assign(this->memorySlices.begin(), this->memorySlices.end());
+            this->journalMemory.push_back(std::move(entry));
+          }
+          for (const auto& item : this->alignedMemoryReference)
+            this->journalAlignedMemory.push_back(item);
+        }
+
         this->memoryReference.clear();
+        this->memorySlices.clear();
         this->alignedMemoryReference.clear();
       }
 
@@ -231,8 +267,12 @@ namespace triton {
       /* Adds an aligned memory */
       void SymbolicEngine::addAlignedMemory(triton::uint64 address, triton::uint32 size, const SharedSymbolicExpression& expr) {
         this->removeAlignedMemory(address, size);
-        if (!(this->modes.isModeEnabled(triton::modes::ONLY_ON_SYMBOLIZED) && expr->getAst()->isSymbolized() == false))
+        if (!(this->modes.isModeEnabled(triton::modes::ONLY_ON_SYMBOLIZED) && expr->getAst()->isSymbolized() == false)) {
+          /* The previous entry (if any) has been journaled by removeAlignedMemory() */
+          if (this->journalFlag)
+            this->journalAlignedMemory.push_back(std::make_pair(std::make_pair(address, size), nullptr));
           this->alignedMemoryReference[std::make_pair(address, size)] = expr;
+        }
       }
 
 
@@ -240,39 +280,99 @@ namespace triton {
       void SymbolicEngine::removeAlignedMemory(triton::uint64 address, triton::uint32 size) {
         /* Remove overloaded positive ranges */
         for (triton::uint32 index = 0; index < size; index++) {
-          this->alignedMemoryReference.erase(std::make_pair(address+index, BYTE_SIZE));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, WORD_SIZE));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, DWORD_SIZE));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, QWORD_SIZE));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, DQWORD_SIZE));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, QQWORD_SIZE));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, DQQWORD_SIZE));
+          this->eraseAlignedMemory(address+index, BYTE_SIZE);
+          this->eraseAlignedMemory(address+index, WORD_SIZE);
+          this->eraseAlignedMemory(address+index, DWORD_SIZE);
+          this->eraseAlignedMemory(address+index, QWORD_SIZE);
+          this->eraseAlignedMemory(address+index, DQWORD_SIZE);
+          this->eraseAlignedMemory(address+index, QQWORD_SIZE);
+          this->eraseAlignedMemory(address+index, DQQWORD_SIZE);
         }
 
         /* Remove overloaded negative ranges */
         for (triton::uint32 index = 1; index < DQQWORD_SIZE; index++) {
           if (index < WORD_SIZE)
-            this->alignedMemoryReference.erase(std::make_pair(address-index, WORD_SIZE));
+            this->eraseAlignedMemory(address-index, WORD_SIZE);
           if (index < DWORD_SIZE)
-            this->alignedMemoryReference.erase(std::make_pair(address-index, DWORD_SIZE));
+            this->eraseAlignedMemory(address-index, DWORD_SIZE);
           if (index < QWORD_SIZE)
-            this->alignedMemoryReference.erase(std::make_pair(address-index, QWORD_SIZE));
+            this->eraseAlignedMemory(address-index, QWORD_SIZE);
           if (index < DQWORD_SIZE)
-            this->alignedMemoryReference.erase(std::make_pair(address-index, DQWORD_SIZE));
+            this->eraseAlignedMemory(address-index, DQWORD_SIZE);
           if (index < QQWORD_SIZE)
-            this->alignedMemoryReference.erase(std::make_pair(address-index, QQWORD_SIZE));
+            this->eraseAlignedMemory(address-index, QQWORD_SIZE);
           if (index < DQQWORD_SIZE)
-            this->alignedMemoryReference.erase(std::make_pair(address-index, DQQWORD_SIZE));
+            this->eraseAlignedMemory(address-index, DQQWORD_SIZE);
+        }
+      }
+
+
+      /* Removes an aligned entry */
+      void SymbolicEngine::eraseAlignedMemory(triton::uint64 address, triton::uint32 size) {
+        auto it = this->alignedMemoryReference.find(std::make_pair(address, size));
+
+        if (it != this->alignedMemoryReference.end()) {
+          if (this->journalFlag)
+            this->journalAlignedMemory.push_back(*it);
+          this->alignedMemoryReference.erase(it);
+        }
+      }
+
+
+      /* Assigns a part of an expression to the memory */
+      void SymbolicEngine::addMemoryRange(triton::uint64 addr, triton::uint32 size, const SharedSymbolicExpression& expr, triton::uint32 offset) {
+        this->removeMemoryRange(addr, size);
+        this->memoryReference.assign(addr, size, expr, offset);
+      }
+
+
+      /* Removes an area of symbolic memory, the ranges which overlap it are trimmed */
+      void SymbolicEngine::removeMemoryRange(triton::uint64 addr, triton::usize size) {
+        /* Journal the bytes which are going to be removed */
+        if (this->journalFlag) {
+          MemoryJournalEntry entry;
+          entry.addr   = addr;
+          entry.size   = size;
+          entry.ranges = this->memoryReference.getRanges(addr, size);
+          entry.slices.assign(this->memorySlices.lower_bound(addr), this->memorySlices.lower_bound(addr + size));
+          this->journalMemory.push_back(std::move(entry));
         }
+
+        this->memoryReference.remove(addr, size);
+        this->memorySlices.erase(this->memorySlices.lower_bound(addr), this->memorySlices.lower_bound(addr + size));
       }
 
 
       /* Returns the reference memory if it's referenced otherwise returns nullptr */
-      SharedSymbolicExpression SymbolicEngine::getSymbolicMemory(triton::uint64 addr) const {
-        auto it = this->memoryReference.find(addr);
-        if (it != this->memoryReference.end())
-          return it->second;
-        return nullptr;
+      SharedSymbolicExpression SymbolicEngine::getSymbolicMemory(triton::uint64 addr) {
+        triton::uint32 offset = 0;
+        const SharedSymbolicExpression& expr = this->memoryReference.get(addr, offset);
+        if (expr == nullptr)
+          return nullptr;
+
+        /* The byte has its own expression */
+        if (offset == 0 && expr->getAst()->getBitvectorSize() == BYTE_SIZE_BIT)
+          return expr;
+
+        /* Otherwise, the byte is sliced from its expression once until the address is written */
+        auto it = this->memorySlices.find(addr);
+        if (it == this->memorySlices.end()) {
+          auto node = this->astCtxt.extract((offset * BYTE_SIZE_BIT) + (BYTE_SIZE_BIT - 1), offset * BYTE_SIZE_BIT, this->astCtxt.reference(expr));
+          SharedSymbolicExpression se = this->newSymbolicExpression(node, triton::engines::symbolic::MEM, "Byte reference");
+          se->setOriginMemory(triton::arch::MemoryAccess(addr, BYTE_SIZE));
+          it = this->memorySlices.insert(std::make_pair(addr, se)).first;
+        }
+
+        /* A slice is tainted as its range */
+        it->second->isTainted = expr->isTainted;
+
+        return it->second;
+      }
+
+
+      /* Returns the ranges of the symbolic memory which overlap an area */
+      std::vector<std::pair<triton::uint64, MemoryRange>> SymbolicEngine::getSymbolicMemoryRanges(triton::uint64 addr, triton::usize size) const {
+        return this->memoryReference.getRanges(addr, size);
       }
 
 
@@ -287,16 +387,11 @@ namespace triton {
 
       /* Returns the symbolic variable otherwise returns nullptr */
       SymbolicVariable* SymbolicEngine::getSymbolicVariableFromName(const std::string& symVarName) const {
-        /*
-         * FIXME: When there is a ton of symvar, this loop takes a while to go through.
-         *        What about adding two maps {id:symvar} and {string:symvar}? See #648.
-         */
-        for (auto& sv: this->symbolicVariables) {
-          if (sv.second->getName() == symVarName)
-            return sv.second;
-        }
+        auto it = this->symbolicVariableNames.find(symVarName);
+        if (it == this->symbolicVariableNames.end())
+          return nullptr;
 
-        return nullptr;
+        return it->second;
       }
 
 
@@ -385,25 +480,36 @@ namespace triton {
 
       /* Removes the symbolic expression corresponding to the id */
       void SymbolicEngine::removeSymbolicExpression(triton::usize symExprId) {
-        if (this->symbolicExpressions.find(symExprId) != this->symbolicExpressions.end()) {
+        auto it = this->symbolicExpressions.find(symExprId);
+
+        if (it != this->symbolicExpressions.end()) {
+          /* The expressions created since the journal has been started are removed by the rollback */
+          if (this->journalFlag && symExprId < this->journalSymExprId)
+            this->journalExpressions.push_back(*it);
+
           /* Delete and remove the pointer */
-          this->symbolicExpressions.erase(symExprId);
+          this->symbolicExpressions.erase(it);
 
           /* Concretize the register if it exists */
           for (triton::uint32 i = 0; i < this->numberOfRegisters; i++) {
             if (this->symbolicReg[i] != nullptr && this->symbolicReg[i]->getId() == symExprId) {
-              this->symbolicReg[i] = nullptr;
+              this->setSymbolicRegister(i, nullptr);
               return;
             }
           }
 
-          /* Concretize the memory if it exists */
-          for (auto it = this->memoryReference.begin(); it != memoryReference.end(); it++) {
-            if (it->second && it->second->getId() == symExprId) {
-              this->concretizeMemory(it->first);
-              return;
-            }
+          /* Concretize the memory if it exists (the expression may be split in several ranges) */
+          std::list<std::pair<triton::uint64, triton::uint32>> ranges;
+          for (const auto& range : this->memoryReference.getRanges()) {
+            if (range.second.expr->getId() == symExprId)
+              ranges.push_back(std::make_pair(range.first, range.second.size));
           }
+
+          for (const auto& range : ranges)
+            this->concretizeMemory(triton::arch::MemoryAccess(range.first, range.second));
+
+          if (!ranges.empty())
+            return;
           // FIXME: Also try to remove it from alignedMemory
           // FIXME: Remove it from ast context too
         }
@@ -446,25 +552,73 @@ namespace triton {
 
 
       /* Returns the full symbolic expression backtracked. */
-      triton::ast::SharedAbstractNode SymbolicEngine::unrollAst(const triton::ast::SharedAbstractNode& node) {
-        std::vector<triton::ast::SharedAbstractNode>& children = node->getChildren();
+      triton::ast::SharedAbstractNode SymbolicEngine::unrollAst(const triton::ast::SharedAbstractNode& node, triton::usize maxDepth, triton::usize maxNodes) {
+        std::unordered_map<triton::ast::AbstractNode*, triton::ast::SharedAbstractNode> nodes;
+        std::unordered_map<triton::usize, triton::ast::SharedAbstractNode> exprs;
+        triton::usize count = 0;
+
+        return this->unrollAst(node, nodes, exprs, 0, maxDepth, count, maxNodes);
+      }
+
+
+      /* [private method] Unrolls a node without modifying it */
+      triton::ast::SharedAbstractNode SymbolicEngine::unrollAst(const triton::ast::SharedAbstractNode& node,
+                                                                std::unordered_map<triton::ast::AbstractNode*, triton::ast::SharedAbstractNode>& nodes,
+                                                                std::unordered_map<triton::usize, triton::ast::SharedAbstractNode>& exprs,
+                                                                triton::usize depth, triton::usize maxDepth,
+                                                                triton::usize& count, triton::usize maxNodes) {
+
+        /* The node is reached from another path */
+        auto it = nodes.find(node.get());
+        if (it != nodes.end())
+          return it->second;
+
+        triton::ast::SharedAbstractNode unrolled = node;
 
         if (node->getKind() == triton::ast::REFERENCE_NODE) {
           const SharedSymbolicExpression& expr = reinterpret_cast<triton::ast::ReferenceNode*>(node.get())->getSymbolicExpression();
-          const triton::ast::SharedAbstractNode& ref = expr->getAst();
-          return this->unrollAst(ref);
+          auto eit = exprs.find(expr->getId());
+
+          if (eit != exprs.end()) {
+            unrolled = eit->second;
+          }
+          else {
+            if (maxDepth && depth >= maxDepth)
+              throw triton::exceptions::SymbolicEngine("SymbolicEngine::unrollAst(): Too many nested references.");
+            unrolled = this->unrollAst(expr->getAst(), nodes, exprs, depth + 1, maxDepth, count, maxNodes);
+            exprs[expr->getId()] = unrolled;
+          }
         }
 
-        for (triton::uint32 index = 0; index < children.size(); index++)
-          children[index] = this->unrollAst(children[index]);
+        else {
+          const triton::ast::ChildVector& children = node->getChildren();
+          triton::ast::ChildVector newChildren;
+          bool changed = false;
+
+          newChildren.reserve(children.size());
+          for (const auto& child : children) {
+            newChildren.push_back(this->unrollAst(child, nodes, exprs, depth, maxDepth, count, maxNodes));
+            changed |= (newChildren.back() != child);
+          }
 
-        return node;
+          /* Only the nodes which lead to a reference are duplicated */
+          if (changed) {
+            if (maxNodes && ++count > maxNodes)
+              throw triton::exceptions::SymbolicEngine("SymbolicEngine::unrollAst(): Too many nodes to create.");
+            unrolled = triton::ast::newInstance(node.get());
+            unrolled->getChildren() = std::move(newChildren);
+            unrolled->init();
+          }
+        }
+
+        nodes[node.get()] = unrolled;
+        return unrolled;
       }
 
 
       /* [private method] Slices all expressions from a given node */
       void SymbolicEngine::sliceExpressions(const triton::ast::SharedAbstractNode& node, std::map<triton::usize, SharedSymbolicExpression>& exprs) {
-        std::vector<triton::ast::SharedAbstractNode>& children = node->getChildren();
+        triton::ast::ChildVector& children = node->getChildren();
 
         if (node->getKind() == triton::ast::REFERENCE_NODE) {
           const SharedSymbolicExpression& expr = reinterpret_cast<triton::ast::ReferenceNode*>(node.get())->getSymbolicExpression();
@@ -532,8 +686,15 @@ namespace triton {
 
 
       /* Returns the map of symbolic memory defined */
-      const std::map<triton::uint64, SharedSymbolicExpression>& SymbolicEngine::getSymbolicMemory(void) const {
-        return this->memoryReference;
+      std::map<triton::uint64, SharedSymbolicExpression> SymbolicEngine::getSymbolicMemory(void) {
+        std::map<triton::uint64, SharedSymbolicExpression> ret;
+
+        for (const auto& range : this->memoryReference.getRanges()) {
+          for (triton::uint32 index = 0; index < range.second.size; index++)
+            ret[range.first + index] = this->getSymbolicMemory(range.first + index);
+        }
+
+        return ret;
       }
 
 
@@ -573,33 +734,14 @@ namespace triton {
         /* Setup the concrete value to the symbolic variable */
         this->setConcreteVariableValue(*symVar, cv);
 
+        /* Assign the symbolic variable to the memory, the previous expressions are left untouched */
+        const SharedSymbolicExpression& se = this->newSymbolicExpression(symVarNode, triton::engines::symbolic::MEM, "Memory reference");
+        se->setOriginMemory(triton::arch::MemoryAccess(memAddr, symVarSize));
+        this->addMemoryRange(memAddr, symVarSize, se);
+
         /* Record the aligned symbolic variable for a symbolic optimization */
-        if (this->modes.isModeEnabled(triton::modes::ALIGNED_MEMORY)) {
-          const SharedSymbolicExpression& se = this->newSymbolicExpression(symVarNode, triton::engines::symbolic::MEM, "aligned Byte reference");
+        if (this->modes.isModeEnabled(triton::modes::ALIGNED_MEMORY))
           this->addAlignedMemory(memAddr, symVarSize, se);
-        }
-
-        /*  Split expression in bytes */
-        for (triton::sint32 index = symVarSize-1; index >= 0; index--) {
-          /* Isolate the good part of the symbolic variable */
-          const triton::ast::SharedAbstractNode& tmp = this->astCtxt.extract(((BYTE_SIZE_BIT * (index+1)) - 1), ((BYTE_SIZE_BIT * (index+1)) - BYTE_SIZE_BIT), symVarNode);
-
-          /* Check if the memory address is already defined */
-          SharedSymbolicExpression se = this->getSymbolicMemory(memAddr+index);
-          if (se == nullptr) {
-            se = this->newSymbolicExpression(tmp, triton::engines::symbolic::MEM, "Byte reference");
-            /* Add the new memory reference */
-            this->addMemoryReference(memAddr+index, se);
-          }
-          else {
-            // FIXME: Here we update the ast but the memory Reference may
-            // be use in another ast which then become invalid. Should we
-            // create a new SE everytime?
-            se->setAst(tmp);
-          }
-          /* Defines the origin of the expression */
-          se->setOriginMemory(triton::arch::MemoryAccess(memAddr+index, BYTE_SIZE));
-        }
 
         return symVar;
       }
@@ -608,11 +750,14 @@ namespace triton {
       SymbolicVariable* SymbolicEngine::convertRegisterToSymbolicVariable(const triton::arch::Register& reg, const std::string& symVarComment) {
         const triton::arch::Register& parent  = this->architecture->getRegister(reg.getParent());
         triton::uint32 symVarSize             = reg.getBitSize();
-        triton::uint512 cv                    = this->architecture->getConcreteRegisterValue(reg);
 
         if (!this->architecture->isRegisterValid(parent.getId()))
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::convertRegisterToSymbolicVariable(): Invalid register id");
 
+        /* A deferred flag must synchronize its concrete value first */
+        this->materializeLazyFlag(reg);
+        triton::uint512 cv = this->architecture->getConcreteRegisterValue(reg);
+
         /* Get the symbolic expression */
         const SharedSymbolicExpression& expression = this->getSymbolicRegister(reg);
 
@@ -629,7 +774,7 @@ namespace triton {
           /* Create the symbolic expression */
           const SharedSymbolicExpression& se = this->newSymbolicExpression(tmp, triton::engines::symbolic::REG);
           se->setOriginRegister(reg);
-          this->symbolicReg[parent.getId()] = se;
+          this->setSymbolicRegister(parent.getId(), se);
         } else {
           /* Set the AST node */
           expression->setAst(tmp);
@@ -648,6 +793,7 @@ namespace triton {
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::newSymbolicVariable(): Cannot allocate a new symbolic variable");
 
         this->symbolicVariables[uniqueId] = symVar;
+        this->symbolicVariableNames[symVar->getName()] = symVar;
         return symVar;
       }
 
@@ -695,13 +841,10 @@ namespace triton {
       triton::ast::SharedAbstractNode SymbolicEngine::getMemoryAst(const triton::arch::MemoryAccess& mem) {
         std::list<triton::ast::SharedAbstractNode> opVec;
 
-        triton::ast::SharedAbstractNode tmp       = nullptr;
-        triton::uint64 address                    = mem.getAddress();
-        triton::uint32 size                       = mem.getSize();
-        triton::uint8 concreteValue[DQQWORD_SIZE] = {0};
-        triton::uint512 value                     = this->architecture->getConcreteMemoryValue(mem);
-
-        triton::utils::fromUintToBuffer(value, concreteValue);
+        triton::ast::SharedAbstractNode tmp = nullptr;
+        triton::uint64 address              = mem.getAddress();
+        triton::uint32 size                 = mem.getSize();
+        triton::uint512 value               = this->architecture->getConcreteMemoryValue(mem);
 
         /*
          * Symbolic optimization
@@ -710,36 +853,69 @@ namespace triton {
         if (this->modes.isModeEnabled(triton::modes::ALIGNED_MEMORY) && this->isAlignedMemory(address, size))
           return this->getAlignedMemory(address, size)->getAst();
 
-        /* Iterate on every memory cells to use their symbolic or concrete values */
+        /* If the access matches a whole stored expression, use it directly */
+        triton::uint32 offset = 0;
+        const SharedSymbolicExpression& expr = this->memoryReference.get(address, offset);
+        if (expr != nullptr && offset == 0 && expr->getAst()->getBitvectorSize() == mem.getBitSize()) {
+          triton::uint32 index = 1;
+          for (; index < size; index++) {
+            triton::uint32 next = 0;
+            if (this->memoryReference.get(address + index, next) != expr || next != index)
+              break;
+          }
+          if (index == size)
+            return this->astCtxt.reference(expr);
+        }
+
+        /*
+         * Iterate on the memory cells (from the most significant one) to use their symbolic
+         * or concrete values. The consecutive cells of a same expression are extracted at once
+         * and the consecutive concrete cells are merged into a single constant. So, an access
+         * without any symbolic cell ends up as a single constant.
+         */
         while (size) {
-          const SharedSymbolicExpression& symMem = this->getSymbolicMemory(address + size - 1);
+          triton::uint64 last  = address + size - 1;
+          triton::uint64 first = last;
+          triton::uint32 high  = 0;
+          const SharedSymbolicExpression& cell = this->memoryReference.get(last, high);
+
           /* Check if the memory cell is already symbolic */
-          if (symMem != nullptr) {
-            tmp = this->astCtxt.reference(symMem);
-            opVec.push_back(this->astCtxt.extract((BYTE_SIZE_BIT - 1), 0, tmp));
+          if (cell != nullptr) {
+            triton::uint32 low = high;
+            while (first > address && low > 0) {
+              triton::uint32 prev = 0;
+              if (this->memoryReference.get(first - 1, prev) != cell || prev != low - 1)
+                break;
+              first--;
+              low--;
+            }
+            tmp = this->astCtxt.reference(cell);
+            opVec.push_back(this->astCtxt.extract((high * BYTE_SIZE_BIT) + (BYTE_SIZE_BIT - 1), low * BYTE_SIZE_BIT, tmp));
+            size -= (high - low + 1);
+            continue;
           }
-          /* Otherwise, use the concerte value */
-          else {
-            tmp = this->astCtxt.bv(concreteValue[size - 1], BYTE_SIZE_BIT);
-            opVec.push_back(this->astCtxt.extract((BYTE_SIZE_BIT - 1), 0, tmp));
+
+          /* Otherwise, use the concrete value of all cells up to the previous symbolic one */
+          while (first > address) {
+            triton::uint32 prev = 0;
+            if (this->memoryReference.get(first - 1, prev) != nullptr)
+              break;
+            first--;
           }
-          size--;
+
+          triton::uint32 bits      = static_cast<triton::uint32>(last - first + 1) * BYTE_SIZE_BIT;
+          triton::uint512 constant = value >> static_cast<triton::uint32>((first - address) * BYTE_SIZE_BIT);
+          if (bits < MAX_BITS_SUPPORTED)
+            constant &= ((triton::uint512(1) << bits) - 1);
+          opVec.push_back(this->astCtxt.bv(constant, bits));
+          size -= static_cast<triton::uint32>(last - first + 1);
         }
 
         /* Concatenate all memory cell to create a bit vector with the appropriate memory access */
-        switch (opVec.size()) {
-          case DQQWORD_SIZE:
-          case QQWORD_SIZE:
-          case DQWORD_SIZE:
-          case QWORD_SIZE:
-          case DWORD_SIZE:
-          case WORD_SIZE:
-            tmp = this->astCtxt.concat(opVec);
-            break;
-          case BYTE_SIZE:
-            tmp = opVec.front();
-            break;
-        }
+        if (opVec.size() == 1)
+          tmp = opVec.front();
+        else
+          tmp = this->astCtxt.concat(opVec);
 
         return tmp;
       }
@@ -771,6 +947,9 @@ namespace triton {
         triton::uint32 high                = reg.getHigh();
         triton::uint32 low                 = reg.getLow();
 
+        /* Build the flag if its expression has been deferred */
+        this->materializeLazyFlag(reg);
+
         /* Check if the register is already symbolic */
         if (const SharedSymbolicExpression& symReg = this->getSymbolicRegister(reg)) {
           op = this->astCtxt.extract(high, low, this->astCtxt.reference(symReg));
@@ -805,53 +984,13 @@ namespace triton {
 
       /* Returns the new symbolic memory expression */
       const SharedSymbolicExpression& SymbolicEngine::createSymbolicMemoryExpression(triton::arch::Instruction& inst, const triton::ast::SharedAbstractNode& node, const triton::arch::MemoryAccess& mem, const std::string& comment) {
-        std::list<triton::ast::SharedAbstractNode> ret;
-        triton::ast::SharedAbstractNode tmp = nullptr;
-        SharedSymbolicExpression se         = nullptr;
-        triton::uint64 address              = mem.getAddress();
-        triton::uint32 writeSize            = mem.getSize();
-
-        /* Record the aligned memory for a symbolic optimization */
-        if (this->modes.isModeEnabled(triton::modes::ALIGNED_MEMORY)) {
-          const SharedSymbolicExpression& aligned = this->newSymbolicExpression(node, triton::engines::symbolic::MEM, "Aligned Byte reference - " + comment);
-          this->addAlignedMemory(address, writeSize, aligned);
-        }
-
-        /*
-         * As the x86's memory can be accessed without alignment, each byte of the
-         * memory must be assigned to an unique reference.
-         */
-        while (writeSize) {
-          /* Extract each byte of the memory */
-          tmp = this->astCtxt.extract(((writeSize * BYTE_SIZE_BIT) - 1), ((writeSize * BYTE_SIZE_BIT) - BYTE_SIZE_BIT), node);
-          se = this->newSymbolicExpression(tmp, triton::engines::symbolic::MEM, "Byte reference - " + comment);
-          se->setOriginMemory(triton::arch::MemoryAccess(((address + writeSize) - 1), BYTE_SIZE));
-          ret.push_back(tmp);
-          inst.addSymbolicExpression(se);
-          /* Assign memory with little endian */
-          this->addMemoryReference((address + writeSize) - 1, se);
-          /* continue */
-          writeSize--;
-        }
-
-        /* If there is only one reference, we return the symbolic expression */
-        if (ret.size() == 1) {
-          /* Synchronize the concrete state */
-          this->architecture->setConcreteMemoryValue(mem, tmp->evaluate());
-          /* Define the memory store */
-          inst.setStoreAccess(mem, node);
-          /* It will return se */
-          return inst.symbolicExpressions.back();
-        }
+        const SharedSymbolicExpression& se = this->newSymbolicExpression(node, triton::engines::symbolic::MEM, comment);
 
-        /* Otherwise, we return the concatenation of all symbolic expressions */
-        tmp = this->astCtxt.concat(ret);
+        /* The expression is assigned as a whole, it will be sliced only by the accesses which do not match it */
+        this->assignSymbolicExpressionToMemory(se, mem);
 
         /* Synchronize the concrete state */
-        this->architecture->setConcreteMemoryValue(mem, tmp->evaluate());
-
-        se = this->newSymbolicExpression(tmp, triton::engines::symbolic::MEM, "Temporary concatenation reference - " + comment);
-        se->setOriginMemory(triton::arch::MemoryAccess(address, mem.getSize()));
+        this->architecture->setConcreteMemoryValue(mem, node->evaluate());
 
         /* Define the memory store */
         inst.setStoreAccess(mem, node);
@@ -925,7 +1064,7 @@ namespace triton {
 
       /* Adds and assign a new memory reference */
       void SymbolicEngine::addMemoryReference(triton::uint64 mem, const SharedSymbolicExpression& expr) {
-        this->memoryReference[mem] = expr;
+        this->addMemoryRange(mem, BYTE_SIZE, expr);
       }
 
 
@@ -943,15 +1082,88 @@ namespace triton {
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::assignSymbolicExpressionToRegister(): The size of the symbolic expression is not equal to the target register.");
         }
 
+        /* A new assignment overrides a deferred flag */
+        if (!this->lazyFlags.empty())
+          this->lazyFlags.erase(id);
+
         se->setKind(triton::engines::symbolic::REG);
         se->setOriginRegister(reg);
-        this->symbolicReg[id] = se;
+        this->setSymbolicRegister(id, se);
 
         /* Synchronize the concrete state */
         this->architecture->setConcreteRegisterValue(reg, node->evaluate());
       }
 
 
+      /* Sets the symbolic expression of a parent register */
+      void SymbolicEngine::setSymbolicRegister(triton::uint32 regId, const SharedSymbolicExpression& expr) {
+        if (this->journalFlag)
+          this->journalRegisters.push_back(std::make_pair(regId, this->symbolicReg[regId]));
+        this->symbolicReg[regId] = expr;
+      }
+
+
+      /* Defers the symbolic expression of a flag until it is read */
+      void SymbolicEngine::deferSymbolicFlagExpression(const LazyFlagBuilder& builder, const triton::arch::Register& flag, const std::string& comment, bool isTainted) {
+        if (flag.getId() != flag.getParent())
+          throw triton::exceptions::SymbolicEngine("SymbolicEngine::deferSymbolicFlagExpression(): We can defer an expression only on parent registers.");
+
+        this->lazyFlags[flag.getId()] = std::make_pair(builder, std::make_pair(comment, isTainted));
+      }
+
+
+      /*
+       * The flags are deferred only if the symbolic engine is enabled. Otherwise, the
+       * engine is restored after each instruction and the concrete values of the flags
+       * would be lost. The ONLY_ON_TAINTED mode filters the expressions according to the
+       * taint of the whole instruction, which is not known anymore when a flag is built.
+       */
+      bool SymbolicEngine::isLazyFlagsEnabled(void) const {
+        return this->enableFlag &&
+               this->modes.isModeEnabled(triton::modes::LAZY_FLAGS) &&
+               !this->modes.isModeEnabled(triton::modes::ONLY_ON_TAINTED);
+      }
+
+
+      /* Returns true if the symbolic expression of the register is deferred */
+      bool SymbolicEngine::isLazyFlag(const triton::arch::Register& reg) const {
+        return this->lazyFlags.find(reg.getParent()) != this->lazyFlags.end();
+      }
+
+
+      /* Builds the deferred symbolic expression of a flag */
+      void SymbolicEngine::materializeLazyFlag(const triton::arch::Register& reg) {
+        if (this->lazyFlags.empty())
+          return;
+
+        auto it = this->lazyFlags.find(reg.getParent());
+        if (it == this->lazyFlags.end())
+          return;
+
+        const triton::arch::Register& flag = this->architecture->getRegister(static_cast<triton::arch::registers_e>(it->first));
+        LazyFlagBuilder builder            = it->second.first;
+        std::string comment                = it->second.second.first;
+        bool isTainted                     = it->second.second.second;
+
+        this->lazyFlags.erase(it);
+
+        const SharedSymbolicExpression& se = this->newSymbolicExpression(builder(), triton::engines::symbolic::REG, comment);
+        se->isTainted = isTainted;
+        this->assignSymbolicExpressionToRegister(se, flag);
+
+        /* Same as the post IR processing of the ONLY_ON_SYMBOLIZED mode */
+        if (this->modes.isModeEnabled(triton::modes::ONLY_ON_SYMBOLIZED) && se->isSymbolized() == false)
+          this->removeSymbolicExpression(se->getId());
+      }
+
+
+      /* Builds all deferred symbolic expressions */
+      void SymbolicEngine::materializeLazyFlags(void) {
+        while (!this->lazyFlags.empty())
+          this->materializeLazyFlag(this->architecture->getRegister(static_cast<triton::arch::registers_e>(this->lazyFlags.begin()->first)));
+      }
+
+
       /* Assigns a symbolic expression to a memory */
       void SymbolicEngine::assignSymbolicExpressionToMemory(const SharedSymbolicExpression& se, const triton::arch::MemoryAccess& mem) {
         const triton::ast::SharedAbstractNode& node = se->getAst();
@@ -967,18 +1179,13 @@ namespace triton {
           this->addAlignedMemory(address, writeSize, se);
 
         /*
-         * As the x86's memory can be accessed without alignment, each byte of the
-         * memory must be assigned to an unique reference.
+         * As the x86's memory can be accessed without alignment, the whole expression
+         * is recorded as a range of bytes. The accesses which do not match this range
+         * extract their bytes from it.
          */
-        while (writeSize) {
-          /* Extract each byte of the memory */
-          const triton::ast::SharedAbstractNode& tmp = this->astCtxt.extract(((writeSize * BYTE_SIZE_BIT) - 1), ((writeSize * BYTE_SIZE_BIT) - BYTE_SIZE_BIT), node);
-          const SharedSymbolicExpression& byteRef = this->newSymbolicExpression(tmp, triton::engines::symbolic::MEM, "Byte reference");
-          byteRef->setOriginMemory(triton::arch::MemoryAccess(((address + writeSize) - 1), BYTE_SIZE));
-          /* Assign memory with little endian */
-          this->addMemoryReference((address + writeSize) - 1, byteRef);
-          writeSize--;
-        }
+        se->setKind(triton::engines::symbolic::MEM);
+        se->setOriginMemory(triton::arch::MemoryAccess(address, writeSize));
+        this->addMemoryRange(address, writeSize, se);
       }
 
 
@@ -1010,13 +1217,13 @@ namespace triton {
 
       /* Returns true if memory cell expressions contain symbolic variables. */
       bool SymbolicEngine::isMemorySymbolized(triton::uint64 addr, triton::uint32 size) const {
-        for (triton::uint32 i = 0; i < size; i++) {
-          const SharedSymbolicExpression& expr = this->getSymbolicMemory(addr + i);
-
-          if(expr == nullptr)
-            continue;
+        /* The pages without symbolic cell are skipped at once */
+        if (!this->memoryReference.contains(addr, size))
+          return false;
 
-          if (expr->isSymbolized())
+        /* Check every range which overlaps the area */
+        for (const auto& range : this->memoryReference.getRanges(addr, size)) {
+          if (range.second.expr->isSymbolized())
             return true;
         }
 
@@ -1037,10 +1244,91 @@ namespace triton {
 
       /* Enables or disables the symbolic engine */
       void SymbolicEngine::enable(bool flag) {
+        /* The engine is restored after each instruction once disabled, so deferred flags are built now */
+        if (flag == false)
+          this->materializeLazyFlags();
         this->enableFlag = flag;
       }
 
 
+      /* Starts to journal the modifications of the engine */
+      void SymbolicEngine::startJournal(void) {
+        this->journalRegisters.clear();
+        this->journalMemory.clear();
+        this->journalAlignedMemory.clear();
+        this->journalExpressions.clear();
+
+        this->journalSymExprId       = this->uniqueSymExprId;
+        this->journalSymVarId        = this->uniqueSymVarId;
+        this->journalPathConstraints = this->pathConstraints.size();
+        this->journalFlag            = true;
+      }
+
+
+      /* Rolls back the journaled modifications, in the reverse order */
+      void SymbolicEngine::rollbackJournal(void) {
+        if (this->journalFlag == false)
+          return;
+
+        this->journalFlag = false;
+
+        for (auto it = this->journalRegisters.rbegin(); it != this->journalRegisters.rend(); it++)
+          this->symbolicReg[it->first] = it->second;
+
+        /* An entry has only modified its area, the bytes of the area are put back */
+        for (auto it = this->journalMemory.rbegin(); it != this->journalMemory.rend(); it++) {
+          this->memoryReference.remove(it->addr, it->size);
+          for (const auto& range : it->ranges)
+            this->memoryReference.assign(range.first, range.second.size, range.second.expr, range.second.offset);
+          for (const auto& slice : it->slices)
+            this->memorySlices[slice.first] = slice.second;
+        }
+
+        /* The slices created since the journal has been started are removed with their ids */
+        for (auto it = this->memorySlices.begin(); it != this->memorySlices.end();) {
+          if (it->second->getId() >= this->journalSymExprId)
+            it = this->memorySlices.erase(it);
+          else
+            it++;
+        }
+
+        for (auto it = this->journalAlignedMemory.rbegin(); it != this->journalAlignedMemory.rend(); it++) {
+          if (it->second == nullptr)
+            this->alignedMemoryReference.erase(it->first);
+          else
+            this->alignedMemoryReference[it->first] = it->second;
+        }
+
+        /* Remove the expressions and the variables created since the journal has been started */
+        for (triton::usize id = this->journalSymExprId; id < this->uniqueSymExprId; id++)
+          this->symbolicExpressions.erase(id);
+
+        for (const auto& expr : this->journalExpressions)
+          this->symbolicExpressions[expr.first] = expr.second;
+
+        for (triton::usize id = this->journalSymVarId; id < this->uniqueSymVarId; id++) {
+          auto it = this->symbolicVariables.find(id);
+          if (it != this->symbolicVariables.end()) {
+            this->symbolicVariableNames.erase(it->second->getName());
+            this->astCtxt.removeVariable(id);
+            delete it->second;
+            this->symbolicVariables.erase(it);
+          }
+        }
+
+        if (this->pathConstraints.size() > this->journalPathConstraints)
+          this->pathConstraints.erase(this->pathConstraints.begin() + this->journalPathConstraints, this->pathConstraints.end());
+
+        this->uniqueSymExprId = this->journalSymExprId;
+        this->uniqueSymVarId  = this->journalSymVarId;
+
+        this->journalRegisters.clear();
+        this->journalMemory.clear();
+        this->journalAlignedMemory.clear();
+        this->journalExpressions.clear();
+      }
+
+
       /* Initializes the memory access AST (LOAD and STORE) */
       void SymbolicEngine::initLeaAst(triton::arch::MemoryAccess& mem, bool force) {
         if (mem.getBitSize() >= BYTE_SIZE_BIT) {
@@ -1094,12 +1382,12 @@ namespace triton {
 
 
       const triton::uint512& SymbolicEngine::getConcreteVariableValue(const SymbolicVariable& symVar) const {
-        return this->astCtxt.getVariableValue(symVar.getName());
+        return this->astCtxt.getVariableValue(symVar.getId());
       }
 
 
       void SymbolicEngine::setConcreteVariableValue(const SymbolicVariable& symVar, const triton::uint512& value) {
-        this->astCtxt.updateVariable(symVar.getName(), value);
+        this->astCtxt.updateVariable(symVar.getId(), value);
       }
 
     }; /* symbolic namespace */
@@ -0,0 +1,248 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <cstring>
+
+#include <triton/symbolicMemory.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace symbolic {
+
+      SymbolicMemory::Page::Page() {
+        std::memset(this->bytes, 0x00, sizeof(this->bytes));
+        this->freeSlot = 0;
+        this->count    = 0;
+      }
+
+
+      triton::uint16 SymbolicMemory::Page::allocate(const SharedSymbolicExpression& expr, triton::uint32 offset) {
+        triton::uint16 id = this->freeSlot;
+
+        if (id != 0) {
+          this->freeSlot = static_cast<triton::uint16>(this->slots[id - 1].offset);
+        }
+        else {
+          /* Room for a qword store per slot */
+          if (this->slots.empty())
+            this->slots.reserve(SYMBOLIC_MEMORY_PAGE_SIZE / 8);
+          this->slots.push_back(Slot());
+          id = static_cast<triton::uint16>(this->slots.size());
+        }
+
+        Slot& slot  = this->slots[id - 1];
+        slot.expr   = expr;
+        slot.offset = offset;
+        slot.count  = 0;
+
+        return id;
+      }
+
+
+      void SymbolicMemory::Page::release(triton::uint16 id) {
+        Slot& slot = this->slots[id - 1];
+
+        /* A free slot is linked to the next free one by its offset */
+        if (--slot.count == 0) {
+          slot.expr      = nullptr;
+          slot.offset    = this->freeSlot;
+          this->freeSlot = id;
+        }
+      }
+
+
+      SymbolicMemory::SymbolicMemory() {
+        this->numberOfBytes = 0;
+      }
+
+
+      void SymbolicMemory::clear(void) {
+        this->pages.clear();
+        this->numberOfBytes = 0;
+      }
+
+
+      bool SymbolicMemory::empty(void) const {
+        return this->numberOfBytes == 0;
+      }
+
+
+      triton::usize SymbolicMemory::size(void) const {
+        return this->numberOfBytes;
+      }
+
+
+      triton::usize SymbolicMemory::getNumberOfPages(void) const {
+        return this->pages.size();
+      }
+
+
+      const SharedSymbolicExpression& SymbolicMemory::get(triton::uint64 addr, triton::uint32& offset) const {
+        static const SharedSymbolicExpression none = nullptr;
+        const Page* page = this->pages.find(addr);
+
+        if (page == nullptr)
+          return none;
+
+        triton::usize index = this->pages.getOffset(addr);
+        triton::uint16 id   = page->bytes[index];
+
+        if (id == 0)
+          return none;
+
+        const Slot& slot = page->slots[id - 1];
+        offset = slot.offset + static_cast<triton::uint32>(index);
+
+        return slot.expr;
+      }
+
+
+      bool SymbolicMemory::contains(triton::uint64 addr, triton::usize size) const {
+        while (size && this->numberOfBytes) {
+          triton::usize index = this->pages.getOffset(addr);
+          triton::usize chunk = this->pages.getChunk(addr, size);
+          const Page* page    = this->pages.find(addr);
+
+          if (page != nullptr) {
+            /* A whole page is answered by its population count */
+            if (chunk == SYMBOLIC_MEMORY_PAGE_SIZE)
+              return true;
+            for (triton::usize i = index; i != index + chunk; i++) {
+              if (page->bytes[i] != 0)
+                return true;
+            }
+          }
+
+          addr += chunk;
+          size -= chunk;
+        }
+
+        return false;
+      }
+
+
+      void SymbolicMemory::assign(triton::uint64 addr, triton::uint32 size, const SharedSymbolicExpression& expr, triton::uint32 offset) {
+        while (size) {
+          triton::usize index  = this->pages.getOffset(addr);
+          triton::uint32 chunk = static_cast<triton::uint32>(this->pages.getChunk(addr, size));
+          Page& page           = this->pages.get(addr);
+
+          /* One slot (and one reference to the expression) per page touched */
+          triton::uint16 id = page.allocate(expr, offset - static_cast<triton::uint32>(index));
+
+          for (triton::usize i = index; i != index + chunk; i++) {
+            if (page.bytes[i] != 0) {
+              page.release(page.bytes[i]);
+            }
+            else {
+              page.count++;
+              this->numberOfBytes++;
+            }
+            page.bytes[i] = id;
+          }
+          page.slots[id - 1].count = chunk;
+
+          addr   += chunk;
+          offset += chunk;
+          size   -= chunk;
+        }
+      }
+
+
+      void SymbolicMemory::remove(triton::uint64 addr, triton::usize size) {
+        while (size && this->numberOfBytes) {
+          triton::usize index = this->pages.getOffset(addr);
+          triton::usize chunk = this->pages.getChunk(addr, size);
+          Page* page          = this->pages.find(addr);
+
+          if (page != nullptr) {
+            /* A whole page is released at once */
+            if (chunk == SYMBOLIC_MEMORY_PAGE_SIZE) {
+              this->numberOfBytes -= page->count;
+              page->count = 0;
+            }
+            else {
+              for (triton::usize i = index; i != index + chunk; i++) {
+                if (page->bytes[i] != 0) {
+                  page->release(page->bytes[i]);
+                  page->bytes[i] = 0;
+                  page->count--;
+                  this->numberOfBytes--;
+                }
+              }
+            }
+
+            /* Release the page if there is no more symbolic byte */
+            if (page->count == 0)
+              this->pages.erase(addr);
+          }
+
+          addr += chunk;
+          size -= chunk;
+        }
+      }
+
+
+      void SymbolicMemory::getPageRanges(triton::uint64 pageId, const Page& page, triton::usize begin, triton::usize end, std::vector<std::pair<triton::uint64, MemoryRange>>& ranges) const {
+        triton::uint64 base = (pageId << SYMBOLIC_MEMORY_PAGE_SHIFT);
+
+        for (triton::usize i = begin; i != end; i++) {
+          if (page.bytes[i] == 0)
+            continue;
+
+          const Slot& slot      = page.slots[page.bytes[i] - 1];
+          triton::uint32 offset = slot.offset + static_cast<triton::uint32>(i);
+
+          /* Extend the previous range if the byte follows it in the same expression */
+          if (!ranges.empty()) {
+            auto& last = ranges.back();
+            if (last.first + last.second.size == base + i && last.second.expr == slot.expr && last.second.offset + last.second.size == offset) {
+              last.second.size++;
+              continue;
+            }
+          }
+
+          ranges.push_back(std::make_pair(base + i, MemoryRange{1, offset, slot.expr}));
+        }
+      }
+
+
+      std::vector<std::pair<triton::uint64, MemoryRange>> SymbolicMemory::getRanges(triton::uint64 addr, triton::usize size) const {
+        std::vector<std::pair<triton::uint64, MemoryRange>> ranges;
+
+        while (size && this->numberOfBytes) {
+          triton::usize index = this->pages.getOffset(addr);
+          triton::usize chunk = this->pages.getChunk(addr, size);
+          const Page* page    = this->pages.find(addr);
+
+          if (page != nullptr)
+            this->getPageRanges(this->pages.getPageId(addr), *page, index, index + chunk, ranges);
+
+          addr += chunk;
+          size -= chunk;
+        }
+
+        return ranges;
+      }
+
+
+      std::vector<std::pair<triton::uint64, MemoryRange>> SymbolicMemory::getRanges(void) const {
+        std::vector<std::pair<triton::uint64, MemoryRange>> ranges;
+
+        /* The pages are not ordered in the table */
+        for (const auto& page : this->pages.getSortedPages())
+          this->getPageRanges(page.first, *page.second, 0, SYMBOLIC_MEMORY_PAGE_SIZE, ranges);
+
+        return ranges;
+      }
+
+    }; /* symbolic namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
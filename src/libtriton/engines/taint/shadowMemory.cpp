@@ -0,0 +1,269 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <bitset>
+#include <cstring>
+#include <memory>
+
+#include <triton/shadowMemory.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace taint {
+
+      /* Returns the mask of the bits of the word `index` covered by the range [begin:end[ */
+      static inline triton::uint64 wordMask(triton::usize index, triton::usize begin, triton::usize end) {
+        triton::usize low  = (begin > index * 64) ? begin - index * 64 : 0;
+        triton::usize high = (end < (index + 1) * 64) ? end - index * 64 : 64;
+        triton::uint64 mask = (high == 64) ? ~0ULL : ((1ULL << high) - 1);
+        return mask & ~((1ULL << low) - 1);
+      }
+
+
+      ShadowMemory::Page::Page() {
+        std::memset(this->bits, 0x00, sizeof(this->bits));
+        this->count = 0;
+      }
+
+
+      ShadowMemory::const_iterator::const_iterator(const std::shared_ptr<const SortedPages>& pages)
+        : pages(pages),
+          index(0),
+          offset(0) {
+        this->seek();
+      }
+
+
+      bool ShadowMemory::const_iterator::atEnd(void) const {
+        return this->pages == nullptr || this->index == this->pages->size();
+      }
+
+
+      void ShadowMemory::const_iterator::seek(void) {
+        while (!this->atEnd()) {
+          const Page* page = (*this->pages)[this->index].second;
+          for (triton::usize w = this->offset / 64; w < SHADOW_MEMORY_PAGE_SIZE / 64; w++) {
+            triton::uint64 word = page->bits[w] & wordMask(w, this->offset, SHADOW_MEMORY_PAGE_SIZE);
+            if (word) {
+              /* The number of trailing zeros */
+              this->offset = w * 64 + std::bitset<64>((word & (~word + 1)) - 1).count();
+              return;
+            }
+          }
+          this->index++;
+          this->offset = 0;
+        }
+      }
+
+
+      triton::uint64 ShadowMemory::const_iterator::operator*(void) const {
+        return ((*this->pages)[this->index].first << SHADOW_MEMORY_PAGE_SHIFT) + this->offset;
+      }
+
+
+      ShadowMemory::const_iterator& ShadowMemory::const_iterator::operator++(void) {
+        this->offset++;
+        if (this->offset == SHADOW_MEMORY_PAGE_SIZE) {
+          this->index++;
+          this->offset = 0;
+        }
+        this->seek();
+        return *this;
+      }
+
+
+      ShadowMemory::const_iterator ShadowMemory::const_iterator::operator++(int) {
+        const_iterator it = *this;
+        ++(*this);
+        return it;
+      }
+
+
+      bool ShadowMemory::const_iterator::operator==(const const_iterator& other) const {
+        if (this->atEnd() || other.atEnd())
+          return this->atEnd() && other.atEnd();
+        return this->pages == other.pages && this->index == other.index && this->offset == other.offset;
+      }
+
+
+      bool ShadowMemory::const_iterator::operator!=(const const_iterator& other) const {
+        return !(*this == other);
+      }
+
+
+      ShadowMemory::ShadowMemory() {
+        this->numberOfBytes = 0;
+      }
+
+
+      void ShadowMemory::clear(void) {
+        this->pages.clear();
+        this->numberOfBytes = 0;
+      }
+
+
+      bool ShadowMemory::empty(void) const {
+        return this->numberOfBytes == 0;
+      }
+
+
+      triton::usize ShadowMemory::size(void) const {
+        return this->numberOfBytes;
+      }
+
+
+      triton::usize ShadowMemory::getNumberOfPages(void) const {
+        return this->pages.size();
+      }
+
+
+      triton::usize ShadowMemory::count(triton::uint64 addr) const {
+        return this->isTainted(addr, 1) ? 1 : 0;
+      }
+
+
+      bool ShadowMemory::isTainted(triton::uint64 baseAddr, triton::usize size) const {
+        if (this->numberOfBytes == 0)
+          return false;
+
+        while (size) {
+          triton::usize offset = this->pages.getOffset(baseAddr);
+          triton::usize chunk  = this->pages.getChunk(baseAddr, size);
+          const Page* page     = this->pages.find(baseAddr);
+
+          if (page != nullptr) {
+            triton::usize end = offset + chunk;
+            for (triton::usize index = offset / 64; index <= (end - 1) / 64; index++) {
+              if (page->bits[index] & wordMask(index, offset, end))
+                return true;
+            }
+          }
+
+          baseAddr += chunk;
+          size     -= chunk;
+        }
+
+        return false;
+      }
+
+
+      void ShadowMemory::taint(triton::uint64 baseAddr, triton::usize size) {
+        while (size) {
+          triton::usize offset = this->pages.getOffset(baseAddr);
+          triton::usize chunk  = this->pages.getChunk(baseAddr, size);
+          triton::usize end    = offset + chunk;
+          Page& page           = this->pages.get(baseAddr);
+
+          for (triton::usize index = offset / 64; index <= (end - 1) / 64; index++) {
+            triton::uint64 mask = wordMask(index, offset, end);
+            triton::usize added = std::bitset<64>(mask & ~page.bits[index]).count();
+            page.count          += added;
+            this->numberOfBytes += added;
+            page.bits[index] |= mask;
+          }
+
+          baseAddr += chunk;
+          size     -= chunk;
+        }
+      }
+
+
+      void ShadowMemory::untaint(triton::uint64 baseAddr, triton::usize size) {
+        while (size && this->numberOfBytes) {
+          triton::usize offset  = this->pages.getOffset(baseAddr);
+          triton::usize chunk   = this->pages.getChunk(baseAddr, size);
+          triton::usize end     = offset + chunk;
+          Page* page            = this->pages.find(baseAddr);
+
+          if (page != nullptr) {
+            for (triton::usize index = offset / 64; index <= (end - 1) / 64; index++) {
+              triton::uint64 mask   = wordMask(index, offset, end);
+              triton::usize removed = std::bitset<64>(mask & page->bits[index]).count();
+              page->count         -= removed;
+              this->numberOfBytes -= removed;
+              page->bits[index] &= ~mask;
+            }
+
+            /* Clear the labels */
+            if (!page->labels.empty())
+              std::fill(page->labels.begin() + offset, page->labels.begin() + end, 0);
+
+            /* Release the page if there is no more tainted byte */
+            if (page->count == 0)
+              this->pages.erase(baseAddr);
+          }
+
+          baseAddr += chunk;
+          size     -= chunk;
+        }
+      }
+
+
+      triton::uint32 ShadowMemory::getLabel(triton::uint64 addr) const {
+        const Page* page = this->pages.find(addr);
+
+        if (page == nullptr || page->labels.empty())
+          return 0;
+
+        return page->labels[this->pages.getOffset(addr)];
+      }
+
+
+      void ShadowMemory::setLabel(triton::uint64 baseAddr, triton::usize size, triton::uint32 label) {
+        while (size) {
+          triton::usize offset = this->pages.getOffset(baseAddr);
+          triton::usize chunk  = this->pages.getChunk(baseAddr, size);
+          Page* page           = this->pages.find(baseAddr);
+
+          /* Only the tainted bytes carry labels */
+          if (page != nullptr && (label || !page->labels.empty())) {
+            if (page->labels.empty())
+              page->labels.resize(SHADOW_MEMORY_PAGE_SIZE, 0);
+
+            for (triton::usize i = offset; i != offset + chunk; i++) {
+              if ((page->bits[i / 64] >> (i % 64)) & 1)
+                page->labels[i] = label;
+            }
+          }
+
+          baseAddr += chunk;
+          size     -= chunk;
+        }
+      }
+
+
+      void ShadowMemory::markLabels(std::vector<bool>& used) const {
+        for (const auto& item : this->pages) {
+          for (triton::uint32 label : item.second.labels)
+            used[label] = true;
+        }
+      }
+
+
+      void ShadowMemory::remapLabels(const std::vector<triton::uint32>& ids) {
+        for (auto& item : this->pages) {
+          for (triton::uint32& label : item.second.labels)
+            label = ids[label];
+        }
+      }
+
+
+      ShadowMemory::const_iterator ShadowMemory::begin(void) const {
+        return const_iterator(std::make_shared<const const_iterator::SortedPages>(this->pages.getSortedPages()));
+      }
+
+
+      ShadowMemory::const_iterator ShadowMemory::end(void) const {
+        return const_iterator(nullptr);
+      }
+
+    }; /* taint namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
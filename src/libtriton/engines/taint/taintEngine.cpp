@@ -5,6 +5,10 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <algorithm>
+#include <cstring>
+
+#include <triton/cpuSize.hpp>
 #include <triton/exceptions.hpp>
 #include <triton/taintEngine.hpp>
 
@@ -79,10 +83,13 @@ mov al, byte ptr [user_input] ; RAX is tainted
 cmp ah, 0x99                  ; can we control this comparison?
 ~~~~~~~~~~~~~
 
-Under our current over-approximation, the taint engine will raise a false
-positive (that says the `ah` is tainted while it actually is not) for this
-particular example, while only the seven bits of `RAX` (`RAX[7..0]`) is tainted
-while the other bits (`RAX[63..8]`) are not.
+The taint of the registers is tracked at the byte granularity, so `ah` is not
+tainted here. However, an arithmetic operation taints all the bytes of its
+destination register, and the whole register is tainted when a value of a
+different size is moved into it (e.g. `movzx eax, al` taints `eax`). In the
+same way, a memory is tainted as a whole when a register of a different size
+is stored into it. So, the taint engine may still raise false positives: for
+example, after `add eax, 1` where only `al` is tainted, `ah` is tainted as well.
 
 This imprecision may raise excessively extraneous false positive on a big
 problem and make the tool totally useless in solving real problems. Let's
@@ -104,6 +111,36 @@ over-approximated tainting to know if we can ask a model to the SMT solver - by
 asking a model, we can query the solver and check if the symbolic variables are
 controllable by the user input.
 
+
+\section engine_Taint_labels Taint Labels
+<hr>
+
+A single taint flag tells if an item depends on *some* input, not on *which*
+one. When the `TAINT_LABELS` mode is enabled, the taint engine also tracks a
+set of up to 64 labels (one bit per source) for each tainted byte and register.
+The sources are tainted with a label (`taintMemory(mem, label)`,
+`taintRegister(reg, label)`), an assignment copies the labels of its source and
+an union merges the labels of both operands. The labels of an item are queried
+with `getTaintLabels()`.
+
+The bytes of the shadow memory only hold the id of their set of labels, each
+distinct set being interned once. The items tainted without source by the
+semantics (e.g. the flags) get the labels read or spread by their instruction.
+
+~~~~~~~~~~~~~{.py}
+>>> ctx.enableMode(MODE.TAINT_LABELS, True)
+>>> ctx.taintMemory(MemoryAccess(0x1000, CPUSIZE.DWORD), 0)
+True
+>>> ctx.taintRegister(ctx.registers.rbx, 1)
+True
+>>> ctx.processing(Instruction("\\x03\\x1c\\x25\\x00\\x10\\x00\\x00")) # add ebx, dword ptr [0x1000]
+True
+>>> hex(ctx.getTaintLabels(ctx.registers.rbx))
+'0x3L'
+>>> hex(ctx.getTaintLabels(ctx.registers.zf))
+'0x3L'
+~~~~~~~~~~~~~
+
 */
 
 
@@ -112,25 +149,62 @@ namespace triton {
   namespace engines {
     namespace taint {
 
-      TaintEngine::TaintEngine(triton::engines::symbolic::SymbolicEngine* symbolicEngine, const triton::arch::CpuInterface& cpu)
+      /* Returns the mask of the bytes of a register in its parent register */
+      static inline triton::uint64 registerMask(const triton::arch::Register& reg) {
+        triton::uint32 low  = reg.getLow() / BYTE_SIZE_BIT;
+        triton::uint32 high = reg.getHigh() / BYTE_SIZE_BIT;
+        triton::uint64 mask = (high >= 63) ? ~0ULL : ((1ULL << (high + 1)) - 1);
+        return mask & ~((1ULL << low) - 1);
+      }
+
+
+      /* Returns the mask of the bytes of the parent register overwritten by a write of the register (a 32-bit or larger write is zero extended) */
+      static inline triton::uint64 writeMask(const triton::arch::Register& reg) {
+        return (reg.getSize() >= DWORD_SIZE) ? ~0ULL : registerMask(reg);
+      }
+
+
+      /* Maps the tainted bytes of a source of `size` bytes on the bytes of a register. A source of a different size taints the whole register. */
+      static inline triton::uint64 mapBytes(triton::uint64 bytes, triton::uint32 size, const triton::arch::Register& reg) {
+        if (size == reg.getSize())
+          return (bytes << (reg.getLow() / BYTE_SIZE_BIT)) & registerMask(reg);
+        return bytes ? registerMask(reg) : 0;
+      }
+
+
+      TaintEngine::TaintEngine(triton::engines::symbolic::SymbolicEngine* symbolicEngine, const triton::arch::CpuInterface& cpu, const triton::modes::Modes& modes)
         : symbolicEngine(symbolicEngine),
           cpu(cpu),
-          enableFlag(true) {
+          modes(modes),
+          enableFlag(true),
+          labelSetsLimit(LABEL_SETS_COLLECTION_THRESHOLD),
+          spreadLabels(0) {
 
         if (this->symbolicEngine == nullptr)
           throw triton::exceptions::TaintEngine("TaintEngine::TaintEngine(): The symbolicEngine TaintEngine cannot be null.");
+
+        /* The id 0 is the empty set of labels */
+        this->labelSets.push_back(0);
+        this->labelSetIds[0] = 0;
+
+        std::memset(this->taintedRegisters, 0x00, sizeof(this->taintedRegisters));
       }
 
 
       void TaintEngine::copy(const TaintEngine& other) {
-        this->enableFlag       = other.enableFlag;
-        this->symbolicEngine   = other.symbolicEngine;
-        this->taintedMemory    = other.taintedMemory;
-        this->taintedRegisters = other.taintedRegisters;
+        this->enableFlag            = other.enableFlag;
+        this->symbolicEngine        = other.symbolicEngine;
+        this->taintedMemory         = other.taintedMemory;
+        std::memcpy(this->taintedRegisters, other.taintedRegisters, sizeof(this->taintedRegisters));
+        this->taintedRegisterLabels = other.taintedRegisterLabels;
+        this->labelSets             = other.labelSets;
+        this->labelSetIds           = other.labelSetIds;
+        this->labelSetsLimit        = other.labelSetsLimit;
+        this->spreadLabels          = other.spreadLabels;
       }
 
 
-      TaintEngine::TaintEngine(const TaintEngine& other) : cpu(other.cpu) {
+      TaintEngine::TaintEngine(const TaintEngine& other) : cpu(other.cpu), modes(other.modes) {
         this->copy(other);
       }
 
@@ -152,8 +226,181 @@ namespace triton {
       }
 
 
+      bool TaintEngine::isLabelEnabled(void) const {
+        return this->modes.isModeEnabled(triton::modes::TAINT_LABELS);
+      }
+
+
+      triton::uint32 TaintEngine::getLabelSetId(triton::uint64 labels) {
+        auto it = this->labelSetIds.find(labels);
+
+        if (it != this->labelSetIds.end())
+          return it->second;
+
+        /* Keep the table bounded by the sets still held by the memory */
+        if (this->labelSets.size() >= this->labelSetsLimit) {
+          this->collectLabelSets();
+          this->labelSetsLimit = std::max(LABEL_SETS_COLLECTION_THRESHOLD, this->labelSets.size() * 2);
+        }
+
+        triton::uint32 id = static_cast<triton::uint32>(this->labelSets.size());
+        this->labelSets.push_back(labels);
+        this->labelSetIds[labels] = id;
+
+        return id;
+      }
+
+
+      void TaintEngine::collectLabelSets(void) {
+        std::vector<bool> used(this->labelSets.size(), false);
+        std::vector<triton::uint32> ids(this->labelSets.size(), 0);
+        std::vector<triton::uint64> labelSets;
+
+        /* The id 0 is always the empty set */
+        used[0] = true;
+        this->taintedMemory.markLabels(used);
+
+        this->labelSetIds.clear();
+        for (triton::usize id = 0; id != this->labelSets.size(); id++) {
+          if (!used[id])
+            continue;
+          ids[id] = static_cast<triton::uint32>(labelSets.size());
+          this->labelSetIds[this->labelSets[id]] = ids[id];
+          labelSets.push_back(this->labelSets[id]);
+        }
+
+        this->labelSets = std::move(labelSets);
+        this->taintedMemory.remapLabels(ids);
+      }
+
+
+      triton::uint64 TaintEngine::getMemoryLabels(triton::uint64 addr, triton::usize size) const {
+        triton::uint64 labels = 0;
+
+        if (!this->taintedMemory.isTainted(addr, size))
+          return 0;
+
+        for (triton::usize i = 0; i != size; i++)
+          labels |= this->labelSets[this->taintedMemory.getLabel(addr + i)];
+
+        return labels;
+      }
+
+
+      void TaintEngine::setMemoryLabels(triton::uint64 addr, triton::usize size, triton::uint64 labels) {
+        this->taintedMemory.setLabel(addr, size, this->getLabelSetId(labels));
+        this->spreadLabels |= labels;
+      }
+
+
+      void TaintEngine::addMemoryLabels(triton::uint64 addr, triton::usize size, triton::uint64 labels) {
+        for (triton::usize i = 0; i != size; i++) {
+          triton::uint64 byteLabels = this->labelSets[this->taintedMemory.getLabel(addr + i)] | labels;
+          this->taintedMemory.setLabel(addr + i, 1, this->getLabelSetId(byteLabels));
+          this->spreadLabels |= byteLabels;
+        }
+      }
+
+
+      void TaintEngine::setRegisterLabels(const triton::arch::Register& reg, triton::uint64 labels) {
+        if (labels)
+          this->taintedRegisterLabels[reg.getParent()] = labels;
+        else
+          this->taintedRegisterLabels.erase(reg.getParent());
+        this->spreadLabels |= labels;
+      }
+
+
+      triton::uint64 TaintEngine::getTaintLabels(const triton::arch::MemoryAccess& mem) const {
+        return this->getMemoryLabels(mem.getAddress(), mem.getSize());
+      }
+
+
+      triton::uint64 TaintEngine::getTaintLabels(const triton::arch::Register& reg) const {
+        if (!this->isRegisterTainted(reg))
+          return 0;
+
+        auto it = this->taintedRegisterLabels.find(reg.getParent());
+
+        if (it == this->taintedRegisterLabels.end())
+          return 0;
+
+        return it->second;
+      }
+
+
+      triton::uint64 TaintEngine::getTaintLabels(const triton::arch::OperandWrapper& op) const {
+        switch (op.getType()) {
+          case triton::arch::OP_IMM: return 0;
+          case triton::arch::OP_MEM: return this->getTaintLabels(op.getConstMemory());
+          case triton::arch::OP_REG: return this->getTaintLabels(op.getConstRegister());
+          default:
+            throw triton::exceptions::TaintEngine("TaintEngine::getTaintLabels(): Invalid operand.");
+        }
+      }
+
+
+      void TaintEngine::clearSpreadLabels(void) {
+        this->spreadLabels = 0;
+      }
+
+
+      triton::uint64 TaintEngine::getRegisterBytes(const triton::arch::Register& reg) const {
+        return (this->taintedRegisters[reg.getParent()] & registerMask(reg)) >> (reg.getLow() / BYTE_SIZE_BIT);
+      }
+
+
+      triton::uint64 TaintEngine::getMemoryBytes(const triton::arch::MemoryAccess& mem) const {
+        triton::uint64 addr  = mem.getAddress();
+        triton::uint32 size  = std::min<triton::uint32>(mem.getSize(), 64);
+        triton::uint64 bytes = 0;
+
+        if (!this->taintedMemory.isTainted(addr, mem.getSize()))
+          return 0;
+
+        for (triton::uint32 i = 0; i != size; i++) {
+          if (this->taintedMemory.isTainted(addr + i))
+            bytes |= (1ULL << i);
+        }
+
+        return bytes;
+      }
+
+
+      void TaintEngine::writeRegister(const triton::arch::Register& reg, triton::uint64 bytes, triton::uint64 labels) {
+        triton::arch::registers_e parent = reg.getParent();
+        triton::uint64& tainted          = this->taintedRegisters[parent];
+
+        tainted = (tainted & ~writeMask(reg)) | bytes;
+
+        if (this->isLabelEnabled()) {
+          /* The labels of the bytes which are not written are kept */
+          triton::uint64 kept = 0;
+          if (tainted & ~registerMask(reg)) {
+            auto it = this->taintedRegisterLabels.find(parent);
+            kept = (it != this->taintedRegisterLabels.end()) ? it->second : 0;
+          }
+
+          labels = bytes ? labels : 0;
+          if (kept | labels)
+            this->taintedRegisterLabels[parent] = kept | labels;
+          else
+            this->taintedRegisterLabels.erase(parent);
+
+          this->spreadLabels |= labels;
+        }
+      }
+
+
+      void TaintEngine::taintMemoryExpressions(const triton::arch::MemoryAccess& mem) {
+        /* The stored expressions are tainted as a whole, no byte is sliced from them */
+        for (const auto& range : this->symbolicEngine->getSymbolicMemoryRanges(mem.getAddress(), mem.getSize()))
+          range.second.expr->isTainted = this->taintedMemory.isTainted(range.first, range.second.size);
+      }
+
+
       /* Returns the tainted addresses */
-      const std::set<triton::uint64>& TaintEngine::getTaintedMemory(void) const {
+      const triton::engines::taint::ShadowMemory& TaintEngine::getTaintedMemory(void) const {
         return this->taintedMemory;
       }
 
@@ -162,8 +409,10 @@ namespace triton {
       std::set<const triton::arch::Register*> TaintEngine::getTaintedRegisters(void) const {
         std::set<const triton::arch::Register*> res;
 
-        for (auto id : this->taintedRegisters)
-          res.insert(&this->cpu.getRegister(id));
+        for (triton::uint32 id = 0; id != triton::arch::ID_REG_LAST_ITEM; id++) {
+          if (this->taintedRegisters[id])
+            res.insert(&this->cpu.getRegister(static_cast<triton::arch::registers_e>(id)));
+        }
 
         return res;
       }
@@ -171,35 +420,19 @@ namespace triton {
 
       /* Returns true of false if the memory address is currently tainted */
       bool TaintEngine::isMemoryTainted(const triton::arch::MemoryAccess& mem) const {
-        triton::uint64 addr = mem.getAddress();
-        triton::uint32 size = mem.getSize();
-
-        for (triton::uint32 index = 0; index < size; index++) {
-          if (this->taintedMemory.find(addr+index) != this->taintedMemory.end())
-            return TAINTED;
-        }
-
-        return !TAINTED;
+        return this->taintedMemory.isTainted(mem.getAddress(), mem.getSize());
       }
 
 
       /* Returns true of false if the address is currently tainted */
       bool TaintEngine::isMemoryTainted(triton::uint64 addr, triton::uint32 size) const {
-        for (triton::uint32 index = 0; index < size; index++) {
-          if (this->taintedMemory.find(addr+index) != this->taintedMemory.end())
-            return TAINTED;
-        }
-
-        return !TAINTED;
+        return this->taintedMemory.isTainted(addr, size);
       }
 
 
       /* Returns true of false if the register is currently tainted */
       bool TaintEngine::isRegisterTainted(const triton::arch::Register& reg) const {
-        if (this->taintedRegisters.find(reg.getParent()) != this->taintedRegisters.end())
-          return TAINTED;
-
-        return !TAINTED;
+        return (this->taintedRegisters[reg.getParent()] & registerMask(reg)) != 0;
       }
 
 
@@ -215,11 +448,22 @@ namespace triton {
       }
 
 
+      /* Abstract taint verification of a source. The labels of a tainted source are spread by the current instruction. */
+      bool TaintEngine::readTaint(const triton::arch::OperandWrapper& op) {
+        bool flag = this->isTainted(op);
+
+        if (flag == TAINTED && this->isLabelEnabled())
+          this->spreadLabels |= this->getTaintLabels(op);
+
+        return flag;
+      }
+
+
       /* Taint the register */
       bool TaintEngine::taintRegister(const triton::arch::Register& reg) {
         if (!this->isEnabled())
           return this->isRegisterTainted(reg);
-        this->taintedRegisters.insert(reg.getParent());
+        this->taintedRegisters[reg.getParent()] |= registerMask(reg);
 
         return TAINTED;
       }
@@ -229,7 +473,9 @@ namespace triton {
       bool TaintEngine::untaintRegister(const triton::arch::Register& reg) {
         if (!this->isEnabled())
           return this->isRegisterTainted(reg);
-        this->taintedRegisters.erase(reg.getParent());
+        this->taintedRegisters[reg.getParent()] &= ~registerMask(reg);
+        if (this->taintedRegisters[reg.getParent()] == 0)
+          this->taintedRegisterLabels.erase(reg.getParent());
 
         return !TAINTED;
       }
@@ -237,23 +483,38 @@ namespace triton {
 
       /* Sets the flag (taint or untaint) to an abstract operand (Register or Memory). */
       bool TaintEngine::setTaint(const triton::arch::OperandWrapper& op, bool flag) {
+        return this->setTaint(op, flag, this->spreadLabels);
+      }
+
+
+      /* Sets the flag (taint or untaint) and the labels to an abstract operand (Register or Memory). */
+      bool TaintEngine::setTaint(const triton::arch::OperandWrapper& op, bool flag, triton::uint64 labels) {
         switch (op.getType()) {
           case triton::arch::OP_IMM: return triton::engines::taint::UNTAINTED;
-          case triton::arch::OP_MEM: return this->setTaintMemory(op.getConstMemory(), flag);
-          case triton::arch::OP_REG: return this->setTaintRegister(op.getConstRegister(), flag);
+          case triton::arch::OP_MEM: return this->setTaintMemory(op.getConstMemory(), flag, labels);
+          case triton::arch::OP_REG: return this->setTaintRegister(op.getConstRegister(), flag, labels);
           default:
             throw triton::exceptions::TaintEngine("TaintEngine::setTaint(): Invalid operand.");
         }
       }
 
 
-      /* Sets the flag (taint or untaint) to a memory. */
+      /* Sets the flag (taint or untaint) to a memory. A tainted memory gets the labels spread by the current instruction. */
       bool TaintEngine::setTaintMemory(const triton::arch::MemoryAccess& mem, bool flag) {
+        return this->setTaintMemory(mem, flag, this->spreadLabels);
+      }
+
+
+      /* Sets the flag (taint or untaint) and the labels to a memory. */
+      bool TaintEngine::setTaintMemory(const triton::arch::MemoryAccess& mem, bool flag, triton::uint64 labels) {
         if (!this->isEnabled())
           return this->isMemoryTainted(mem);
 
-        if (flag == TAINTED)
+        if (flag == TAINTED) {
           this->taintMemory(mem);
+          if (this->isLabelEnabled())
+            this->setMemoryLabels(mem.getAddress(), mem.getSize(), labels);
+        }
 
         else if (flag == !TAINTED)
           this->untaintMemory(mem);
@@ -262,13 +523,22 @@ namespace triton {
       }
 
 
-      /* Sets the flag (taint or untaint) to a register. */
+      /* Sets the flag (taint or untaint) to a register. A tainted register gets the labels spread by the current instruction. */
       bool TaintEngine::setTaintRegister(const triton::arch::Register& reg, bool flag) {
+        return this->setTaintRegister(reg, flag, this->spreadLabels);
+      }
+
+
+      /* Sets the flag (taint or untaint) and the labels to a register. */
+      bool TaintEngine::setTaintRegister(const triton::arch::Register& reg, bool flag, triton::uint64 labels) {
         if (!this->isEnabled())
           return this->isRegisterTainted(reg);
 
-        if (flag == TAINTED)
+        if (flag == TAINTED) {
           this->taintRegister(reg);
+          if (this->isLabelEnabled())
+            this->setRegisterLabels(reg, labels);
+        }
 
         else if (flag == !TAINTED)
           this->untaintRegister(reg);
@@ -285,8 +555,7 @@ namespace triton {
         if (!this->isEnabled())
           return this->isMemoryTainted(mem);
 
-        for (triton::uint32 index = 0; index < size; index++)
-          this->taintedMemory.insert(addr+index);
+        this->taintedMemory.taint(addr, size);
 
         return TAINTED;
       }
@@ -296,7 +565,45 @@ namespace triton {
       bool TaintEngine::taintMemory(triton::uint64 addr) {
         if (!this->isEnabled())
           return this->isMemoryTainted(addr);
-        this->taintedMemory.insert(addr);
+        this->taintedMemory.taint(addr);
+        return TAINTED;
+      }
+
+
+      /* Taint the memory with a label */
+      bool TaintEngine::taintMemory(const triton::arch::MemoryAccess& mem, triton::uint32 label) {
+        if (label >= MAX_TAINT_LABELS)
+          throw triton::exceptions::TaintEngine("TaintEngine::taintMemory(): Invalid label.");
+
+        if (!this->isEnabled())
+          return this->isMemoryTainted(mem);
+
+        this->taintedMemory.taint(mem.getAddress(), mem.getSize());
+
+        if (this->isLabelEnabled()) {
+          for (triton::uint32 i = 0; i != mem.getSize(); i++) {
+            triton::uint64 labels = this->labelSets[this->taintedMemory.getLabel(mem.getAddress() + i)] | (1ULL << label);
+            this->taintedMemory.setLabel(mem.getAddress() + i, 1, this->getLabelSetId(labels));
+          }
+        }
+
+        return TAINTED;
+      }
+
+
+      /* Taint the register with a label */
+      bool TaintEngine::taintRegister(const triton::arch::Register& reg, triton::uint32 label) {
+        if (label >= MAX_TAINT_LABELS)
+          throw triton::exceptions::TaintEngine("TaintEngine::taintRegister(): Invalid label.");
+
+        if (!this->isEnabled())
+          return this->isRegisterTainted(reg);
+
+        this->taintedRegisters[reg.getParent()] |= registerMask(reg);
+
+        if (this->isLabelEnabled())
+          this->taintedRegisterLabels[reg.getParent()] |= (1ULL << label);
+
         return TAINTED;
       }
 
@@ -309,8 +616,7 @@ namespace triton {
         if (!this->isEnabled())
           return this->isMemoryTainted(mem);
 
-        for (triton::uint32 index = 0; index < size; index++)
-          this->taintedMemory.erase(addr+index);
+        this->taintedMemory.untaint(addr, size);
 
         return !TAINTED;
       }
@@ -320,7 +626,7 @@ namespace triton {
       bool TaintEngine::untaintMemory(triton::uint64 addr) {
         if (!this->isEnabled())
           return this->isMemoryTainted(addr);
-        this->taintedMemory.erase(addr);
+        this->taintedMemory.untaint(addr);
         return !TAINTED;
       }
 
@@ -380,58 +686,30 @@ namespace triton {
 
 
       bool TaintEngine::taintUnionMemoryImmediate(const triton::arch::MemoryAccess& memDst) {
-        bool flag = triton::engines::taint::UNTAINTED;
-        triton::uint64 memAddrDst = memDst.getAddress();
-        triton::uint32 writeSize  = memDst.getSize();
-
-        flag = this->unionMemoryImmediate(memDst);
+        bool flag = this->unionMemoryImmediate(memDst);
 
-        /* Taint each byte of reference expression */
-        for (triton::uint32 i = 0; i != writeSize; i++) {
-          const triton::engines::symbolic::SharedSymbolicExpression& byte = this->symbolicEngine->getSymbolicMemory(memAddrDst + i);
-          if (byte == nullptr)
-            continue;
-          byte->isTainted = flag;
-        }
+        /* Taint the reference expressions */
+        this->taintMemoryExpressions(memDst);
 
         return flag;
       }
 
 
       bool TaintEngine::taintUnionMemoryMemory(const triton::arch::MemoryAccess& memDst, const triton::arch::MemoryAccess& memSrc) {
-        bool flag = triton::engines::taint::UNTAINTED;
-        triton::uint64 memAddrDst = memDst.getAddress();
-        triton::uint64 memAddrSrc = memSrc.getAddress();
-        triton::uint32 writeSize  = memDst.getSize();
+        bool flag = this->unionMemoryMemory(memDst, memSrc);
 
-        flag = this->unionMemoryMemory(memDst, memSrc);
-
-        /* Taint each byte of reference expression */
-        for (triton::uint32 i = 0; i != writeSize; i++) {
-          const triton::engines::symbolic::SharedSymbolicExpression& byte = this->symbolicEngine->getSymbolicMemory(memAddrDst + i);
-          if (byte == nullptr)
-            continue;
-          byte->isTainted = this->isMemoryTainted(memAddrDst + i) | this->isMemoryTainted(memAddrSrc + i);
-        }
+        /* Taint the reference expressions */
+        this->taintMemoryExpressions(memDst);
 
         return flag;
       }
 
 
       bool TaintEngine::taintUnionMemoryRegister(const triton::arch::MemoryAccess& memDst, const triton::arch::Register& regSrc) {
-        bool flag = triton::engines::taint::UNTAINTED;
-        triton::uint64 memAddrDst = memDst.getAddress();
-        triton::uint32 writeSize  = memDst.getSize();
-
-        flag = this->unionMemoryRegister(memDst, regSrc);
+        bool flag = this->unionMemoryRegister(memDst, regSrc);
 
-        /* Taint each byte of reference expression */
-        for (triton::uint32 i = 0; i != writeSize; i++) {
-          const triton::engines::symbolic::SharedSymbolicExpression& byte = this->symbolicEngine->getSymbolicMemory(memAddrDst + i);
-          if (byte == nullptr)
-            continue;
-          byte->isTainted = flag;
-        }
+        /* Taint the reference expressions */
+        this->taintMemoryExpressions(memDst);
 
         return flag;
       }
@@ -453,58 +731,30 @@ namespace triton {
 
 
       bool TaintEngine::taintAssignmentMemoryImmediate(const triton::arch::MemoryAccess& memDst) {
-        bool flag = triton::engines::taint::UNTAINTED;
-        triton::uint64 memAddrDst = memDst.getAddress();
-        triton::uint32 writeSize  = memDst.getSize();
+        bool flag = this->assignmentMemoryImmediate(memDst);
 
-        flag = this->assignmentMemoryImmediate(memDst);
-
-        /* Taint each byte of reference expression */
-        for (triton::uint32 i = 0; i != writeSize; i++) {
-          const triton::engines::symbolic::SharedSymbolicExpression& byte = this->symbolicEngine->getSymbolicMemory(memAddrDst + i);
-          if (byte == nullptr)
-            continue;
-          byte->isTainted = flag;
-        }
+        /* Taint the reference expressions */
+        this->taintMemoryExpressions(memDst);
 
         return flag;
       }
 
 
       bool TaintEngine::taintAssignmentMemoryMemory(const triton::arch::MemoryAccess& memDst, const triton::arch::MemoryAccess& memSrc) {
-        bool flag = triton::engines::taint::UNTAINTED;
-        triton::uint64 memAddrDst = memDst.getAddress();
-        triton::uint64 memAddrSrc = memSrc.getAddress();
-        triton::uint32 writeSize  = memDst.getSize();
+        bool flag = this->assignmentMemoryMemory(memDst, memSrc);
 
-        flag = this->assignmentMemoryMemory(memDst, memSrc);
-
-        /* Taint each byte of reference expression */
-        for (triton::uint32 i = 0; i != writeSize; i++) {
-          const triton::engines::symbolic::SharedSymbolicExpression& byte = this->symbolicEngine->getSymbolicMemory(memAddrDst + i);
-          if (byte == nullptr)
-            continue;
-          byte->isTainted = this->isMemoryTainted(memAddrSrc + i);
-        }
+        /* Taint the reference expressions */
+        this->taintMemoryExpressions(memDst);
 
         return flag;
       }
 
 
       bool TaintEngine::taintAssignmentMemoryRegister(const triton::arch::MemoryAccess& memDst, const triton::arch::Register& regSrc) {
-        bool flag = triton::engines::taint::UNTAINTED;
-        triton::uint64 memAddrDst = memDst.getAddress();
-        triton::uint32 writeSize  = memDst.getSize();
+        bool flag = this->assignmentMemoryRegister(memDst, regSrc);
 
-        flag = this->assignmentMemoryRegister(memDst, regSrc);
-
-        /* Taint each byte of reference expression */
-        for (triton::uint32 i = 0; i != writeSize; i++) {
-          const triton::engines::symbolic::SharedSymbolicExpression& byte = this->symbolicEngine->getSymbolicMemory(memAddrDst + i);
-          if (byte == nullptr)
-            continue;
-          byte->isTainted = flag;
-        }
+        /* Taint the reference expressions */
+        this->taintMemoryExpressions(memDst);
 
         return flag;
       }
@@ -530,13 +780,9 @@ namespace triton {
         if (!this->isEnabled())
           return this->isRegisterTainted(regDst);
 
-        if (this->isRegisterTainted(regSrc)) {
-          this->taintRegister(regDst);
-          return TAINTED;
-        }
+        this->writeRegister(regDst, mapBytes(this->getRegisterBytes(regSrc), regSrc.getSize(), regDst), this->getTaintLabels(regSrc));
 
-        this->untaintRegister(regDst);
-        return !TAINTED;
+        return this->isRegisterTainted(regDst);
       }
 
 
@@ -544,7 +790,7 @@ namespace triton {
       bool TaintEngine::assignmentRegisterImmediate(const triton::arch::Register& regDst) {
         if (!this->isEnabled())
           return this->isRegisterTainted(regDst);
-        this->untaintRegister(regDst);
+        this->writeRegister(regDst, 0, 0);
         return !TAINTED;
       }
 
@@ -554,13 +800,9 @@ namespace triton {
         if (!this->isEnabled())
           return this->isRegisterTainted(regDst);
 
-        if (this->isMemoryTainted(memSrc)) {
-          this->taintRegister(regDst);
-          return TAINTED;
-        }
+        this->writeRegister(regDst, mapBytes(this->getMemoryBytes(memSrc), memSrc.getSize(), regDst), this->getTaintLabels(memSrc));
 
-        this->untaintRegister(regDst);
-        return !TAINTED;
+        return this->isRegisterTainted(regDst);
       }
 
 
@@ -577,6 +819,8 @@ namespace triton {
         for (triton::uint32 offset = 0; offset < readSize; offset++) {
           if (this->isMemoryTainted(addrSrc+offset)) {
             this->taintMemory(addrDst+offset);
+            if (this->isLabelEnabled())
+              this->setMemoryLabels(addrDst+offset, 1, this->getMemoryLabels(addrSrc+offset, 1));
             isTainted = TAINTED;
           }
           else
@@ -598,18 +842,35 @@ namespace triton {
 
       /* mem <- reg  */
       bool TaintEngine::assignmentMemoryRegister(const triton::arch::MemoryAccess& memDst, const triton::arch::Register& regSrc) {
+        triton::uint64 addrDst = memDst.getAddress();
+        triton::uint32 size    = memDst.getSize();
+
         if (!this->isEnabled())
           return this->isMemoryTainted(memDst);
 
         /* Check source */
-        if (this->isRegisterTainted(regSrc)) {
-          this->taintMemory(memDst);
-          return TAINTED;
+        if (!this->isRegisterTainted(regSrc)) {
+          this->untaintMemory(memDst);
+          return !TAINTED;
         }
 
-        /* Spread destination */
-        this->untaintMemory(memDst);
-        return !TAINTED;
+        /* Spread destination (byte per byte if both have the same size) */
+        if (size == regSrc.getSize()) {
+          triton::uint64 bytes = this->getRegisterBytes(regSrc);
+          for (triton::uint32 offset = 0; offset < size; offset++) {
+            if ((bytes >> offset) & 1)
+              this->taintMemory(addrDst+offset);
+            else
+              this->untaintMemory(addrDst+offset);
+          }
+        }
+        else
+          this->taintMemory(memDst);
+
+        if (this->isLabelEnabled())
+          this->setMemoryLabels(addrDst, size, this->getTaintLabels(regSrc));
+
+        return TAINTED;
       }
 
 
@@ -617,7 +878,11 @@ namespace triton {
       bool TaintEngine::unionRegisterImmediate(const triton::arch::Register& regDst) {
         if (!this->isEnabled())
           return this->isRegisterTainted(regDst);
-        return this->isRegisterTainted(regDst);
+
+        bool tainted = this->isRegisterTainted(regDst);
+        this->writeRegister(regDst, tainted ? registerMask(regDst) : 0, this->getTaintLabels(regDst));
+
+        return tainted;
       }
 
 
@@ -626,12 +891,10 @@ namespace triton {
         if (!this->isEnabled())
           return this->isRegisterTainted(regDst);
 
-        if (this->isRegisterTainted(regSrc)) {
-          this->taintRegister(regDst);
-          return TAINTED;
-        }
+        bool tainted = this->isRegisterTainted(regDst) | this->isRegisterTainted(regSrc);
+        this->writeRegister(regDst, tainted ? registerMask(regDst) : 0, this->getTaintLabels(regDst) | this->getTaintLabels(regSrc));
 
-        return this->isRegisterTainted(regDst);
+        return tainted;
       }
 
 
@@ -651,6 +914,8 @@ namespace triton {
             this->taintMemory(addrDst+offset);
             tainted = TAINTED;
           }
+          if (this->isLabelEnabled())
+            this->addMemoryLabels(addrDst+offset, 1, this->getMemoryLabels(addrSrc+offset, 1));
         }
 
         /* Check destination */
@@ -667,12 +932,10 @@ namespace triton {
         if (!this->isEnabled())
           return this->isRegisterTainted(regDst);
 
-        if (this->isMemoryTainted(memSrc)) {
-          this->taintRegister(regDst);
-          return TAINTED;
-        }
+        bool tainted = this->isRegisterTainted(regDst) | this->isMemoryTainted(memSrc);
+        this->writeRegister(regDst, tainted ? registerMask(regDst) : 0, this->getTaintLabels(regDst) | this->getTaintLabels(memSrc));
 
-        return this->isRegisterTainted(regDst);
+        return tainted;
       }
 
 
@@ -681,6 +944,9 @@ namespace triton {
         if (!this->isEnabled())
           return this->isMemoryTainted(memDst);
 
+        if (this->isLabelEnabled())
+          this->spreadLabels |= this->getTaintLabels(memDst);
+
         if (this->isMemoryTainted(memDst)) {
           return TAINTED;
         }
@@ -696,9 +962,14 @@ namespace triton {
 
         if (this->isRegisterTainted(regSrc)) {
           this->taintMemory(memDst);
+          if (this->isLabelEnabled())
+            this->addMemoryLabels(memDst.getAddress(), memDst.getSize(), this->getTaintLabels(regSrc));
           return TAINTED;
         }
 
+        if (this->isLabelEnabled())
+          this->spreadLabels |= this->getTaintLabels(memDst);
+
         if (this->isMemoryTainted(memDst))
           return TAINTED;
 
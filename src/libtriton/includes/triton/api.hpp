@@ -200,6 +200,15 @@ namespace triton {
         //! [**architecture api**] - Disassembles the instruction and setup operands. You must define an architecture before. \sa processing().
         TRITON_EXPORT void disassembly(triton::arch::Instruction& inst) const;
 
+        //! [**architecture api**] - Enables or disables the cache of decoded instructions. Disabling the cache clears it. \sa triton::arch::DecodeCache.
+        TRITON_EXPORT void enableDecodeCache(bool flag);
+
+        //! [**architecture api**] - Returns true if the cache of decoded instructions is enabled.
+        TRITON_EXPORT bool isDecodeCacheEnabled(void) const;
+
+        //! [**architecture api**] - Returns the cache of decoded instructions.
+        TRITON_EXPORT triton::arch::DecodeCache& getDecodeCache(void);
+
 
 
         /* Processing API ================================================================================ */
@@ -453,8 +462,8 @@ namespace triton {
         //! [**symbolic api**] - Concretizes a specific symbolic register reference.
         TRITON_EXPORT void concretizeRegister(const triton::arch::Register& reg);
 
-        //! [**symbolic api**] - Unrolls the SSA form of a given AST.
-        TRITON_EXPORT triton::ast::SharedAbstractNode unrollAst(const triton::ast::SharedAbstractNode& node);
+        //! [**symbolic api**] - Unrolls the SSA form of a given AST without modifying it. A budget of nested references (`maxDepth`) and of created nodes (`maxNodes`) may be given, 0 means no limit.
+        TRITON_EXPORT triton::ast::SharedAbstractNode unrollAst(const triton::ast::SharedAbstractNode& node, triton::usize maxDepth=0, triton::usize maxNodes=0);
 
         //! [**symbolic api**] - Slices all expressions from a given one.
         TRITON_EXPORT std::map<triton::usize, triton::engines::symbolic::SharedSymbolicExpression> sliceExpressions(const triton::engines::symbolic::SharedSymbolicExpression& expr);
@@ -502,6 +511,71 @@ namespace triton {
         //! Returns true if an expression is satisfiable.
         TRITON_EXPORT bool isSat(const triton::ast::SharedAbstractNode& node) const;
 
+        //! [**solver api**] - Enables or disables the cache of the solver queries. Disabling the cache clears it. \sa triton::engines::solver::SolverCache.
+        TRITON_EXPORT void enableSolverCache(bool flag);
+
+        //! [**solver api**] - Returns true if the cache of the solver queries is enabled.
+        TRITON_EXPORT bool isSolverCacheEnabled(void) const;
+
+        //! [**solver api**] - Returns the cache of the solver queries.
+        TRITON_EXPORT triton::engines::solver::SolverCache& getSolverCache(void);
+
+        //! [**solver api**] - Enables or disables the reuse of the models already found. Disabling the cache clears it. \sa triton::engines::solver::ModelCache.
+        TRITON_EXPORT void enableModelCache(bool flag);
+
+        //! [**solver api**] - Returns true if the models already found are reused.
+        TRITON_EXPORT bool isModelCacheEnabled(void) const;
+
+        //! [**solver api**] - Returns the cache of the models already found.
+        TRITON_EXPORT triton::engines::solver::ModelCache& getModelCache(void);
+
+        //! [**solver api**] - Enables or disables the partitioning of the constraints sent to the solver. Disabling the partitioning clears its statistics. \sa triton::engines::solver::ConstraintPartitioner.
+        TRITON_EXPORT void enableConstraintPartitioning(bool flag);
+
+        //! [**solver api**] - Returns true if the constraints sent to the solver are partitioned.
+        TRITON_EXPORT bool isConstraintPartitioningEnabled(void) const;
+
+        //! [**solver api**] - Returns the partitioner of the constraints sent to the solver.
+        TRITON_EXPORT triton::engines::solver::ConstraintPartitioner& getConstraintPartitioner(void);
+
+        //! [**solver api**] - Starts an incremental solving session. A session already started is restarted.
+        TRITON_EXPORT void startSolverSession(void);
+
+        //! [**solver api**] - Stops the incremental solving session.
+        TRITON_EXPORT void stopSolverSession(void);
+
+        //! [**solver api**] - Returns true if an incremental solving session is started.
+        TRITON_EXPORT bool isSolverSessionStarted(void) const;
+
+        //! [**solver api**] - Asserts a constraint in the solving session until it is popped.
+        TRITON_EXPORT void pushSolverSessionConstraint(const triton::ast::SharedAbstractNode& node);
+
+        //! [**solver api**] - Removes the `count` last constraints pushed in the solving session.
+        TRITON_EXPORT void popSolverSessionConstraints(triton::usize count=1);
+
+        //! [**solver api**] - Returns the number of constraints pushed in the solving session.
+        TRITON_EXPORT triton::usize getNumberOfSolverSessionConstraints(void) const;
+
+        /*!
+         * \brief [**solver api**] - Computes and returns a model of the constraints of the solving session and `node` (which is not kept).
+         *
+         * \details
+         * **item1**: symbolic variable id<br>
+         * **item2**: model
+         */
+        TRITON_EXPORT std::map<triton::uint32, triton::engines::solver::SolverModel> getSolverSessionModel(const triton::ast::SharedAbstractNode& node);
+
+        //! [**solver api**] - Returns true if the constraints of the solving session and `node` (which is not kept) are satisfiable.
+        TRITON_EXPORT bool isSolverSessionSat(const triton::ast::SharedAbstractNode& node);
+
+        /*!
+         * \brief [**solver api**] - Walks the path constraints once with an incremental solver and solves each branch which has not been taken.
+         *
+         * \details If `dedup` is true, a branch is solved only once per (srcAddr, dstAddr). The `timeout` is the time budget
+         * (in milliseconds) of each query, 0 for no limit.
+         */
+        TRITON_EXPORT std::vector<triton::engines::solver::BranchSolution> solveAllBranches(bool dedup=true, triton::uint32 timeout=0) const;
+
 
 
         /* Z3 interface API ============================================================================== */
@@ -526,7 +600,7 @@ namespace triton {
         TRITON_EXPORT triton::engines::taint::TaintEngine* getTaintEngine(void);
 
         //! [**taint api**] - Returns the tainted addresses.
-        TRITON_EXPORT const std::set<triton::uint64>& getTaintedMemory(void) const;
+        TRITON_EXPORT const triton::engines::taint::ShadowMemory& getTaintedMemory(void) const;
 
         //! [**taint api**] - Returns the tainted registers.
         TRITON_EXPORT std::set<const triton::arch::Register*> getTaintedRegisters(void) const;
@@ -567,6 +641,18 @@ namespace triton {
         //! [**taint api**] - Taints a register. Returns TAINTED if the register has been tainted correctly. Otherwise it returns the last defined state.
         TRITON_EXPORT bool taintRegister(const triton::arch::Register& reg);
 
+        //! [**taint api**] - Taints a memory with a label (`TAINT_LABELS` mode). Returns TAINTED if the memory has been tainted correctly. Otherwise it returns the last defined state.
+        TRITON_EXPORT bool taintMemory(const triton::arch::MemoryAccess& mem, triton::uint32 label);
+
+        //! [**taint api**] - Taints a register with a label (`TAINT_LABELS` mode). Returns TAINTED if the register has been tainted correctly. Otherwise it returns the last defined state.
+        TRITON_EXPORT bool taintRegister(const triton::arch::Register& reg, triton::uint32 label);
+
+        //! [**taint api**] - Returns the set of labels of a memory, one bit per label (`TAINT_LABELS` mode).
+        TRITON_EXPORT triton::uint64 getTaintLabels(const triton::arch::MemoryAccess& mem) const;
+
+        //! [**taint api**] - Returns the set of labels of a register, one bit per label (`TAINT_LABELS` mode).
+        TRITON_EXPORT triton::uint64 getTaintLabels(const triton::arch::Register& reg) const;
+
         //! [**taint api**] - Untaints an address. Returns !TAINTED if the address has been untainted correctly. Otherwise it returns the last defined state.
         TRITON_EXPORT bool untaintMemory(triton::uint64 addr);
 
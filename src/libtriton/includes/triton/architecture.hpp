@@ -14,6 +14,7 @@
 
 #include <triton/callbacks.hpp>
 #include <triton/cpuInterface.hpp>
+#include <triton/decodeCache.hpp>
 #include <triton/dllexport.hpp>
 #include <triton/instruction.hpp>
 #include <triton/memoryAccess.hpp>
@@ -59,6 +60,9 @@ namespace triton {
         //! Instance to the real CPU class.
         std::unique_ptr<triton::arch::CpuInterface> cpu;
 
+        //! The cache of decoded instructions.
+        mutable triton::arch::DecodeCache decodeCache;
+
       public:
         //! Constructor.
         TRITON_EXPORT Architecture(triton::callbacks::Callbacks* callbacks=nullptr);
@@ -105,6 +109,12 @@ namespace triton {
         //! Clears the architecture states (registers and memory).
         TRITON_EXPORT void clearArchitecture(void);
 
+        //! Returns the cache of decoded instructions.
+        TRITON_EXPORT triton::arch::DecodeCache& getDecodeCache(void);
+
+        //! Returns the cache of decoded instructions.
+        TRITON_EXPORT const triton::arch::DecodeCache& getDecodeCache(void) const;
+
         //! Returns all registers.
         TRITON_EXPORT const std::unordered_map<registers_e, const triton::arch::Register>& getAllRegisters(void) const;
 
@@ -120,7 +130,7 @@ namespace triton {
         //! Returns parent register from register
         TRITON_EXPORT const triton::arch::Register& getParentRegister(const triton::arch::Register& reg) const;
 
-        //! Disassembles the instruction according to the architecture.
+        //! Disassembles the instruction according to the architecture. The decode cache is used if it is enabled.
         TRITON_EXPORT void disassembly(triton::arch::Instruction& inst) const;
 
         //! Builds the instruction semantics according to the architecture. Returns true if the instruction is supported.
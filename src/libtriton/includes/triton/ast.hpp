@@ -17,6 +17,7 @@
 #include <string>
 #include <vector>
 
+#include <triton/astAllocator.hpp>
 #include <triton/astEnums.hpp>
 #include <triton/dllexport.hpp>
 #include <triton/symbolicVariable.hpp>
@@ -56,6 +57,15 @@ namespace triton {
     //! Weak Abstract Node
     using WeakAbstractNode = std::weak_ptr<triton::ast::AbstractNode>;
 
+    //! The number of children kept inline in a node.
+    const triton::usize AST_INLINE_CHILDREN = 3;
+
+    //! The children of a node.
+    using ChildVector = SmallVector<SharedAbstractNode, AST_INLINE_CHILDREN>;
+
+    //! The size under which the parents of a node are kept without duplicate.
+    const triton::usize AST_PARENTS_LINEAR_SIZE = 8;
+
     //! Abstract node
     class AbstractNode : public std::enable_shared_from_this<AbstractNode> {
       protected:
@@ -63,17 +73,39 @@ namespace triton {
         enum kind_e kind;
 
         //! The children of the node.
-        std::vector<SharedAbstractNode> children;
+        ChildVector children;
+
+        /*! \brief The parents of the node. Empty if there is still no parent.
+         *
+         * \details Big lists may contain expired or duplicated parents until they are
+         * compacted (see compactParents()).
+         */
+        std::vector<std::pair<AbstractNode*, WeakAbstractNode>> parents;
 
-        //! The parents of the node. Empty if there is still no parent.
-        //std::vector<AbstractNode*> parents;
-        std::map<AbstractNode*, std::weak_ptr<AbstractNode>> parents;
+        //! The size of the parents list which triggers the next compaction.
+        triton::usize parentsSweep;
+
+        //! Removes the expired and duplicated parents.
+        void compactParents(void);
 
         //! The size of the node.
         triton::uint32 size;
 
-        //! The value of the tree from this root node.
-        triton::uint512 eval;
+        /*!
+         * \brief The value of the tree from this root node when the node is wider than 64 bits. \sa isNative().
+         *
+         * \details It is only allocated for such nodes (see wideEval()), native nodes keep their value in `eval64`.
+         */
+        std::unique_ptr<triton::uint512> eval;
+
+        //! The value of the tree from this root node when the node is 64 bits or less. \sa isNative().
+        triton::uint64 eval64;
+
+        //! The structural hash of the tree from this root node. \sa initHash().
+        triton::uint64 hashValue;
+
+        //! The height of the tree from this root node (1 for a leaf).
+        triton::uint32 level;
 
         //! True if the tree contains a symbolic variable.
         bool symbolized;
@@ -84,10 +116,16 @@ namespace triton {
         //! Contect use to create this node
         AstContext& ctxt;
 
+        //! Returns the value of a node wider than 64 bits, allocated on first use.
+        triton::uint512& wideEval(void);
+
       public:
         //! Constructor.
         TRITON_EXPORT AbstractNode(enum kind_e kind, AstContext& ctxt);
 
+        //! Constructor by copy. The copy shares the children of the other node but has no parent.
+        TRITON_EXPORT AbstractNode(const AbstractNode& other);
+
         //! Constructor by copy.
         TRITON_EXPORT AbstractNode(const AbstractNode& other, AstContext& ctxt);
 
@@ -115,17 +153,32 @@ namespace triton {
         //! Returns true if it's a logical node.
         TRITON_EXPORT bool isLogical(void) const;
 
+        //! Returns true if the node is 64 bits or less. Its value is then computed with native integers.
+        TRITON_EXPORT bool isNative(void) const;
+
         //! Returns true if the current tree is equal to the second one.
         TRITON_EXPORT bool equalTo(const SharedAbstractNode&) const;
 
         //! Evaluates the tree.
         TRITON_EXPORT virtual triton::uint512 evaluate(void) const;
 
+        //! Evaluates the tree and returns the 64 lower bits. Cheaper than evaluate() on a native node.
+        TRITON_EXPORT triton::uint64 evaluate64(void) const;
+
+        //! Returns the structural hash of the tree. The hash is computed once by init().
+        TRITON_EXPORT triton::uint64 getHash(void) const;
+
+        //! Returns the structural hash of the tree. \deprecated The hash no longer depends on the depth, use getHash().
+        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
+
+        //! Returns the height of the tree.
+        TRITON_EXPORT triton::uint32 getLevel(void) const;
+
         //! Initializes parents.
         void initParents(void);
 
         //! Returns the children of the node.
-        TRITON_EXPORT std::vector<SharedAbstractNode>& getChildren(void);
+        TRITON_EXPORT ChildVector& getChildren(void);
 
         //! Returns the parents of node or an empty set if there is still no parent defined.
         TRITON_EXPORT std::vector<SharedAbstractNode> getParents(void);
@@ -154,8 +207,8 @@ namespace triton {
         //! Init stuffs like size and eval.
         TRITON_EXPORT virtual void init(void) = 0;
 
-        //! Returns the has of the tree. The hash is computed recursively on the whole tree.
-        TRITON_EXPORT virtual triton::uint512 hash(triton::uint32 deep) const = 0;
+        //! Init the hash and the level of the node from `payload` (the value of a leaf) and the ones of its children.
+        TRITON_EXPORT void initHash(triton::uint64 payload=0);
     };
 
 
@@ -164,7 +217,6 @@ namespace triton {
       public:
         TRITON_EXPORT BvaddNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
         TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
     };
 
 
@@ -173,7 +225,6 @@ namespace triton {
       public:
         TRITON_EXPORT BvandNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
         TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
     };
 
 
@@ -182,7 +233,6 @@ namespace triton {
       public:
         TRITON_EXPORT BvashrNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
         TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
     };
 
 
@@ -191,7 +241,6 @@ namespace triton {
       public:
         TRITON_EXPORT BvlshrNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
         TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
     };
 
 
@@ -200,7 +249,6 @@ namespace triton {
       public:
         TRITON_EXPORT BvmulNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
         TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
     };
 
 
@@ -209,7 +257,6 @@ namespace triton {
       public:
         TRITON_EXPORT BvnandNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
         TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
     };
 
 
@@ -218,7 +265,6 @@ namespace triton {
       public:
         TRITON_EXPORT BvnegNode(const SharedAbstractNode& expr);
         TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
     };
 
 
@@ -227,7 +273,6 @@ namespace triton {
       public:
         TRITON_EXPORT BvnorNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
         TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
     };
 
 
@@ -236,7 +281,6 @@ namespace triton {
       public:
         TRITON_EXPORT BvnotNode(const SharedAbstractNode& expr1);
         TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
     };
 
 
@@ -245,7 +289,6 @@ namespace triton {
       public:
         TRITON_EXPORT BvorNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
         TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
     };
 
 
@@ -255,7 +298,6 @@ namespace triton {
         TRITON_EXPORT BvrolNode(triton::uint32 rot, const SharedAbstractNode& expr);
         TRITON_EXPORT BvrolNode(const SharedAbstractNode& rot, const SharedAbstractNode& expr);
         TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
     };
 
 
@@ -265,7 +307,6 @@ namespace triton {
         TRITON_EXPORT BvrorNode(triton::uint32 rot, const SharedAbstractNode& expr);
         TRITON_EXPORT BvrorNode(const SharedAbstractNode& rot, const SharedAbstractNode& expr);
         TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
     };
 
 
@@ -274,7 +315,6 @@ namespace triton {
       public:
         TRITON_EXPORT BvsdivNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
         TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
     };
 
 
@@ -283,7 +323,6 @@ namespace triton {
       public:
         TRITON_EXPORT BvsgeNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
         TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
     };
 
 
@@ -292,7 +331,6 @@ namespace triton {
       public:
         TRITON_EXPORT BvsgtNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
         TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
     };
 
 
@@ -301,7 +339,6 @@ namespace triton {
       public:
         TRITON_EXPORT BvshlNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
         TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
     };
 
 
@@ -310,7 +347,6 @@ namespace triton {
       public:
         TRITON_EXPORT BvsleNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
         TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
     };
 
 
@@ -319,7 +355,6 @@ namespace triton {
       public:
         TRITON_EXPORT BvsltNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
         TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
     };
 
 
@@ -328,7 +363,6 @@ namespace triton {
       public:
         TRITON_EXPORT BvsmodNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
         TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
     };
 
 
@@ -337,7 +371,6 @@ namespace triton {
       public:
         TRITON_EXPORT BvsremNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
         TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
     };
 
 
@@ -346,7 +379,6 @@ namespace triton {
       public:
         TRITON_EXPORT BvsubNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
         TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
     };
 
 
@@ -355,7 +387,6 @@ namespace triton {
       public:
         TRITON_EXPORT BvudivNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
         TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
     };
 
 
@@ -364,7 +395,6 @@ namespace triton {
       public:
         TRITON_EXPORT BvugeNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
         TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
     };
 
 
@@ -373,7 +403,6 @@ namespace triton {
       public:
         TRITON_EXPORT BvugtNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
         TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
     };
 
 
@@ -382,7 +411,6 @@ namespace triton {
       public:
         TRITON_EXPORT BvuleNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
         TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
     };
 
 
@@ -391,7 +419,6 @@ namespace triton {
       public:
         TRITON_EXPORT BvultNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
         TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
     };
 
 
@@ -400,7 +427,6 @@ namespace triton {
       public:
         TRITON_EXPORT BvuremNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
         TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
     };
 
 
@@ -409,7 +435,6 @@ namespace triton {
       public:
         TRITON_EXPORT BvxnorNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
         TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
     };
 
 
@@ -418,7 +443,6 @@ namespace triton {
       public:
         TRITON_EXPORT BvxorNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
         TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
     };
 
 
@@ -427,7 +451,6 @@ namespace triton {
       public:
         TRITON_EXPORT BvNode(triton::uint512 value, triton::uint32 size, AstContext& ctxt);
         TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
     };
 
 
@@ -437,7 +460,6 @@ namespace triton {
         TRITON_EXPORT ConcatNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
         template <typename T> ConcatNode(const T& exprs, AstContext& ctxt);
         TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
     };
 
 
@@ -449,7 +471,6 @@ namespace triton {
       public:
         TRITON_EXPORT DecimalNode(triton::uint512 value, AstContext& ctxt);
         TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
         TRITON_EXPORT triton::uint512 getValue(void);
     };
 
@@ -459,7 +480,6 @@ namespace triton {
       public:
         TRITON_EXPORT DistinctNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
         TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
     };
 
 
@@ -468,7 +488,6 @@ namespace triton {
       public:
         TRITON_EXPORT EqualNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
         TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
     };
 
 
@@ -477,7 +496,6 @@ namespace triton {
       public:
         TRITON_EXPORT ExtractNode(triton::uint32 high, triton::uint32 low, const SharedAbstractNode& expr);
         TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
     };
 
 
@@ -486,7 +504,6 @@ namespace triton {
       public:
         TRITON_EXPORT IteNode(const SharedAbstractNode& ifExpr, const SharedAbstractNode& thenExpr, const SharedAbstractNode& elseExpr);
         TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
     };
 
 
@@ -496,7 +513,6 @@ namespace triton {
         TRITON_EXPORT LandNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
         template <typename T> LandNode(const T& exprs, AstContext& ctxt);
         TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
     };
 
 
@@ -505,7 +521,6 @@ namespace triton {
       public:
         TRITON_EXPORT LetNode(std::string alias, const SharedAbstractNode& expr2, const SharedAbstractNode& expr3);
         TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
     };
 
 
@@ -514,7 +529,6 @@ namespace triton {
       public:
         TRITON_EXPORT LnotNode(const SharedAbstractNode& expr);
         TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
     };
 
 
@@ -524,7 +538,6 @@ namespace triton {
         TRITON_EXPORT LorNode(const SharedAbstractNode& expr1, const SharedAbstractNode& expr2);
         template <typename T> LorNode(const T& exprs, AstContext& ctxt);
         TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
     };
 
 
@@ -536,7 +549,6 @@ namespace triton {
       public:
         TRITON_EXPORT ReferenceNode(const triton::engines::symbolic::SharedSymbolicExpression& expr);
         TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
         TRITON_EXPORT const triton::engines::symbolic::SharedSymbolicExpression& getSymbolicExpression(void) const;
     };
 
@@ -549,7 +561,6 @@ namespace triton {
       public:
         TRITON_EXPORT StringNode(std::string value, AstContext& ctxt);
         TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
         TRITON_EXPORT std::string getValue(void);
     };
 
@@ -559,7 +570,6 @@ namespace triton {
       public:
         TRITON_EXPORT SxNode(triton::uint32 sizeExt, const SharedAbstractNode& expr);
         TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
     };
 
 
@@ -571,7 +581,6 @@ namespace triton {
       public:
         TRITON_EXPORT VariableNode(triton::engines::symbolic::SymbolicVariable& symVar, AstContext& ctxt);
         TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
         TRITON_EXPORT triton::engines::symbolic::SymbolicVariable& getVar(void);
     };
 
@@ -582,7 +591,6 @@ namespace triton {
         //! Create a zero extend of expr to sizeExt bits
         TRITON_EXPORT ZxNode(triton::uint32 sizeExt, const SharedAbstractNode& expr);
         TRITON_EXPORT void init(void);
-        TRITON_EXPORT triton::uint512 hash(triton::uint32 deep) const;
     };
 
     //! Displays the node in ast representation.
@@ -600,6 +608,12 @@ namespace triton {
     //! Custom modular sign extend for bitwise operation.
     triton::sint512 modularSignExtend(AbstractNode* node);
 
+    //! Returns the vector mask of a native node of `size` bits.
+    triton::uint64 nativeMask(triton::uint32 size);
+
+    //! Custom sign extend of a native node.
+    triton::sint64 nativeSignExtend(AbstractNode* node);
+
   /*! @} End of ast namespace */
   };
 /*! @} End of triton namespace */
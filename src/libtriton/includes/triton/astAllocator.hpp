@@ -0,0 +1,398 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_AST_ALLOCATOR_H
+#define TRITON_AST_ALLOCATOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    //! The alignment (and granularity) of the blocks returned by a NodePool.
+    const triton::usize NODE_POOL_ALIGNMENT = 16;
+
+    //! The biggest block served by a NodePool. Bigger blocks are allocated with `operator new`.
+    const triton::usize NODE_POOL_MAX_BLOCK_SIZE = 512;
+
+    //! The size of a slab allocated by a NodePool.
+    const triton::usize NODE_POOL_SLAB_SIZE = 0x10000;
+
+    /*! \class NodePool
+     *  \brief A slab allocator for the AST nodes.
+     *
+     *  \details Blocks are carved from big slabs and rounded up to a size class of
+     *  `NODE_POOL_ALIGNMENT` bytes. As each kind of node (and its shared_ptr control
+     *  block) has its own size, each kind ends up in its own size class. Freed blocks
+     *  are kept in a free list per size class and slabs are only released when the
+     *  pool is destroyed. A pool is not thread-safe.
+     *
+     *  \details The AstContext which owns the pool releases it with release(). If some nodes
+     *  outlive their context (e.g. from Python), the pool is destroyed with its last block.
+     */
+    class NodePool {
+      private:
+        //! The free lists (one per size class).
+        void* freeLists[NODE_POOL_MAX_BLOCK_SIZE / NODE_POOL_ALIGNMENT];
+
+        //! The slabs.
+        std::vector<triton::uint8*> slabs;
+
+        //! The first free byte of the current slab.
+        triton::uint8* cursor;
+
+        //! The end of the current slab.
+        triton::uint8* end;
+
+        //! The number of live blocks.
+        triton::usize blocks;
+
+        //! True if the owner of the pool released it while some blocks were still alive.
+        bool orphaned;
+
+        //! Destructor. Releases all slabs. \sa release().
+        ~NodePool();
+
+      public:
+        //! Constructor.
+        TRITON_EXPORT NodePool();
+
+        //! Releases the pool. It is destroyed now if no block is alive, or else with its last block.
+        TRITON_EXPORT void release(void);
+
+        //! Allocates a block of `size` bytes.
+        TRITON_EXPORT void* allocate(triton::usize size);
+
+        //! Releases a block of `size` bytes.
+        TRITON_EXPORT void deallocate(void* block, triton::usize size);
+
+        //! Returns the number of live blocks.
+        TRITON_EXPORT triton::usize getNumberOfBlocks(void) const;
+
+        //! Returns the number of slabs.
+        TRITON_EXPORT triton::usize getNumberOfSlabs(void) const;
+
+      private:
+        //! A pool cannot be copied.
+        NodePool(const NodePool& other);
+
+        //! A pool cannot be copied.
+        NodePool& operator=(const NodePool& other);
+    };
+
+
+    /*! \class NodeAllocator
+     *  \brief The allocator given to `std::allocate_shared` to build the AST nodes.
+     *
+     *  \details The allocator only refers to the pool of its AstContext, so building or
+     *  destroying a node does not touch any reference counter of the pool.
+     */
+    template <typename T>
+    class NodeAllocator {
+      template <typename U> friend class NodeAllocator;
+
+      private:
+        //! The pool.
+        NodePool* pool;
+
+      public:
+        //! The allocated type.
+        typedef T value_type;
+
+        //! Constructor.
+        explicit NodeAllocator(NodePool* pool) : pool(pool) {}
+
+        //! Constructor by copy of another type.
+        template <typename U>
+        NodeAllocator(const NodeAllocator<U>& other) : pool(other.pool) {}
+
+        //! Allocates `n` objects.
+        T* allocate(std::size_t n) {
+          return static_cast<T*>(this->pool->allocate(n * sizeof(T)));
+        }
+
+        //! Releases `n` objects.
+        void deallocate(T* p, std::size_t n) {
+          this->pool->deallocate(p, n * sizeof(T));
+        }
+
+        //! Returns the pool.
+        NodePool* getPool(void) const {
+          return this->pool;
+        }
+
+        //! Returns true if both allocators share the same pool.
+        template <typename U>
+        bool operator==(const NodeAllocator<U>& other) const {
+          return this->pool == other.pool;
+        }
+
+        //! Returns true if the allocators do not share the same pool.
+        template <typename U>
+        bool operator!=(const NodeAllocator<U>& other) const {
+          return this->pool != other.pool;
+        }
+    };
+
+
+    /*! \class SmallVector
+     *  \brief A vector which keeps up to `N` items inline before moving them to the heap.
+     *
+     *  \details Used for the children of the AST nodes, most of them having three children
+     *  or less. Only the subset of the `std::vector` interface used by the AST is provided.
+     */
+    template <typename T, triton::usize N>
+    class SmallVector {
+      private:
+        //! The items, inline while the capacity is `N`.
+        union {
+          typename std::aligned_storage<sizeof(T), alignof(T)>::type inlined[N];
+          T* heap;
+        };
+
+        //! The number of items.
+        triton::uint32 count;
+
+        //! The capacity (`N` while the items are inline).
+        triton::uint32 room;
+
+        //! Takes the items of another vector. This vector must be empty and inline.
+        void take(SmallVector&& other) {
+          if (other.room != N) {
+            this->heap = other.heap;
+            this->room = other.room;
+            this->count = other.count;
+            other.room = N;
+            other.count = 0;
+            return;
+          }
+          for (triton::uint32 index = 0; index < other.count; index++)
+            new (this->data() + index) T(std::move(other.data()[index]));
+          this->count = other.count;
+          other.clear();
+        }
+
+        //! Releases the heap storage, the vector must be empty.
+        void release(void) {
+          if (this->room != N) {
+            ::operator delete(this->heap);
+            this->room = N;
+          }
+        }
+
+      public:
+        typedef T value_type;
+        typedef triton::usize size_type;
+        typedef T& reference;
+        typedef const T& const_reference;
+        typedef T* iterator;
+        typedef const T* const_iterator;
+        typedef std::reverse_iterator<iterator> reverse_iterator;
+        typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+        //! Constructor.
+        SmallVector() : count(0), room(N) {}
+
+        //! Constructor by copy.
+        SmallVector(const SmallVector& other) : count(0), room(N) {
+          this->assign(other.begin(), other.end());
+        }
+
+        //! Constructor by move.
+        SmallVector(SmallVector&& other) : count(0), room(N) {
+          this->take(std::move(other));
+        }
+
+        //! Destructor.
+        ~SmallVector() {
+          this->clear();
+          this->release();
+        }
+
+        //! Copies another vector.
+        SmallVector& operator=(const SmallVector& other) {
+          if (this != &other)
+            this->assign(other.begin(), other.end());
+          return *this;
+        }
+
+        //! Moves another vector.
+        SmallVector& operator=(SmallVector&& other) {
+          if (this != &other) {
+            this->clear();
+            this->release();
+            this->take(std::move(other));
+          }
+          return *this;
+        }
+
+        //! Copies a std::vector.
+        SmallVector& operator=(const std::vector<T>& other) {
+          this->assign(other.begin(), other.end());
+          return *this;
+        }
+
+        //! Moves the items of a std::vector.
+        SmallVector& operator=(std::vector<T>&& other) {
+          this->assign(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+          other.clear();
+          return *this;
+        }
+
+        //! Replaces the items by the ones of a range.
+        template <typename It>
+        void assign(It first, It last) {
+          this->clear();
+          this->reserve(static_cast<triton::usize>(std::distance(first, last)));
+          for (; first != last; ++first)
+            new (this->data() + this->count++) T(*first);
+        }
+
+        //! Returns the items.
+        T* data(void) {
+          return (this->room == N) ? reinterpret_cast<T*>(this->inlined) : this->heap;
+        }
+
+        //! Returns the items.
+        const T* data(void) const {
+          return (this->room == N) ? reinterpret_cast<const T*>(this->inlined) : this->heap;
+        }
+
+        //! Returns the number of items.
+        triton::usize size(void) const {
+          return this->count;
+        }
+
+        //! Returns true if there is no item.
+        bool empty(void) const {
+          return this->count == 0;
+        }
+
+        //! Returns the number of items which fit without reallocation.
+        triton::usize capacity(void) const {
+          return this->room;
+        }
+
+        //! Makes room for `n` items.
+        void reserve(triton::usize n) {
+          if (n <= this->room)
+            return;
+
+          triton::usize size = std::max<triton::usize>(n, this->room * 2);
+          T* items = static_cast<T*>(::operator new(size * sizeof(T)));
+
+          for (triton::uint32 index = 0; index < this->count; index++) {
+            new (items + index) T(std::move(this->data()[index]));
+            this->data()[index].~T();
+          }
+
+          this->release();
+          this->heap = items;
+          this->room = static_cast<triton::uint32>(size);
+        }
+
+        //! Adds an item at the end.
+        void push_back(const T& item) {
+          if (this->count == this->room) {
+            T copy(item);
+            this->reserve(this->count + 1);
+            new (this->data() + this->count++) T(std::move(copy));
+            return;
+          }
+          new (this->data() + this->count++) T(item);
+        }
+
+        //! Adds an item at the end.
+        void push_back(T&& item) {
+          if (this->count == this->room) {
+            T copy(std::move(item));
+            this->reserve(this->count + 1);
+            new (this->data() + this->count++) T(std::move(copy));
+            return;
+          }
+          new (this->data() + this->count++) T(std::move(item));
+        }
+
+        //! Removes all the items. The capacity is kept.
+        void clear(void) {
+          for (triton::uint32 index = 0; index < this->count; index++)
+            this->data()[index].~T();
+          this->count = 0;
+        }
+
+        //! Returns the item at an index.
+        T& operator[](triton::usize index) { return this->data()[index]; }
+
+        //! Returns the item at an index.
+        const T& operator[](triton::usize index) const { return this->data()[index]; }
+
+        //! Returns the first item.
+        T& front(void) { return this->data()[0]; }
+
+        //! Returns the first item.
+        const T& front(void) const { return this->data()[0]; }
+
+        //! Returns the last item.
+        T& back(void) { return this->data()[this->count - 1]; }
+
+        //! Returns the last item.
+        const T& back(void) const { return this->data()[this->count - 1]; }
+
+        //! Returns an iterator to the first item.
+        iterator begin(void) { return this->data(); }
+
+        //! Returns an iterator to the first item.
+        const_iterator begin(void) const { return this->data(); }
+
+        //! Returns an iterator past the last item.
+        iterator end(void) { return this->data() + this->count; }
+
+        //! Returns an iterator past the last item.
+        const_iterator end(void) const { return this->data() + this->count; }
+
+        //! Returns a reverse iterator to the last item.
+        reverse_iterator rbegin(void) { return reverse_iterator(this->end()); }
+
+        //! Returns a reverse iterator to the last item.
+        const_reverse_iterator rbegin(void) const { return const_reverse_iterator(this->end()); }
+
+        //! Returns a reverse iterator before the first item.
+        reverse_iterator rend(void) { return reverse_iterator(this->begin()); }
+
+        //! Returns a reverse iterator before the first item.
+        const_reverse_iterator rend(void) const { return const_reverse_iterator(this->begin()); }
+    };
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_AST_ALLOCATOR_H */
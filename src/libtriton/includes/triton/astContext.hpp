@@ -9,10 +9,11 @@
 #define TRITON_AST_CONTEXT_H
 
 #include <triton/ast.hpp>
+#include <triton/astAllocator.hpp>
 #include <triton/astRepresentation.hpp>   // for AstRepresentation, astRepre...
 #include <triton/dllexport.hpp>
 
-#include <map>
+#include <unordered_map>
 #include <vector>
 
 
@@ -26,6 +27,7 @@ namespace triton {
 
   namespace engines {
     namespace symbolic {
+      class SymbolicEngine;
       class SymbolicExpression;
     };
   };
@@ -45,8 +47,37 @@ namespace triton {
         //! String formater for ast
         triton::ast::representations::AstRepresentation astRepresentation;
 
-        //! Map a concrete value and ast node for a variable name.
-        std::map<std::string, std::pair<triton::ast::SharedAbstractNode, triton::uint512>> valueMapping;
+        /*! \brief The table of the variables (ast node and concrete value), indexed by variable id.
+         *
+         * \details The node of an entry which is not initialized is nullptr.
+         */
+        std::vector<std::pair<triton::ast::SharedAbstractNode, triton::uint512>> valueMapping;
+
+        //! The symbolic engine which names the variables, used by the lookups by name. \sa setSymbolicEngine().
+        const triton::engines::symbolic::SymbolicEngine* symbolicEngine;
+
+        //! Returns the id of a variable from its name, or throws an exception if it is not a variable of this context.
+        triton::usize getVariableId(const std::string& name, const char* where) const;
+
+        //! The allocator of the nodes built by this context.
+        triton::ast::NodeAllocator<AbstractNode> allocator;
+
+        //! True if identical nodes are shared. \sa enableHashConsing().
+        bool hashConsing;
+
+        /*! \brief The table of interned nodes.
+         *
+         * \details
+         * **item1**: hash of the node<br>
+         * **item2**: weak reference to the node
+         */
+        std::unordered_multimap<triton::uint64, WeakAbstractNode> internedNodes;
+
+        //! The size of the table which triggers the next removal of expired nodes.
+        triton::usize internedSweep;
+
+        //! Returns an already interned node identical to `node`, or interns `node` and returns it.
+        SharedAbstractNode intern(const SharedAbstractNode& node);
 
       public:
         //! Constructor
@@ -220,14 +251,48 @@ namespace triton {
         //! AST C++ API - zx node builder
         TRITON_EXPORT SharedAbstractNode zx(triton::uint32 sizeExt, const SharedAbstractNode& expr);
 
+        /*!
+         * \brief Enables or disables the hash-consing of nodes.
+         *
+         * \details When enabled, builders return an already existing node if it has the same kind,
+         * the same children (by identity) and the same payload. Identical subtrees are then shared
+         * by all their users, so a shared node must not be modified in place (e.g. with `setChild()`).
+         * Disabling the hash-consing forgets the interned nodes.
+         */
+        TRITON_EXPORT void enableHashConsing(bool flag);
+
+        //! Returns true if the hash-consing of nodes is enabled.
+        TRITON_EXPORT bool isHashConsingEnabled(void) const;
+
+        //! Returns the number of entries in the table of interned nodes (expired entries included).
+        TRITON_EXPORT triton::usize getNumberOfInternedNodes(void) const;
+
+        //! Returns the allocator of the nodes built by this context.
+        TRITON_EXPORT const triton::ast::NodeAllocator<AbstractNode>& getNodeAllocator(void) const;
+
+        //! Sets the symbolic engine which names the variables of this context.
+        TRITON_EXPORT void setSymbolicEngine(const triton::engines::symbolic::SymbolicEngine* engine);
+
         //! Initializes a variable in the context
+        TRITON_EXPORT void initVariable(triton::usize id, const triton::uint512& value, const SharedAbstractNode& node);
+
+        //! Initializes a variable in the context from its name.
         TRITON_EXPORT void initVariable(const std::string& name, const triton::uint512& value, const SharedAbstractNode& node);
 
         //! Updates a variable value in this context
+        TRITON_EXPORT void updateVariable(triton::usize id, const triton::uint512& value);
+
+        //! Updates a variable value in this context from its name.
         TRITON_EXPORT void updateVariable(const std::string& name, const triton::uint512& value);
 
-        //! Gets a variable node from its name.
-        SharedAbstractNode getVariableNode(const std::string& name);
+        //! Removes a variable from this context.
+        TRITON_EXPORT void removeVariable(triton::usize id);
+
+        //! Gets a variable node from its id.
+        SharedAbstractNode getVariableNode(triton::usize id);
+
+        //! Gets a variable value from its id.
+        TRITON_EXPORT const triton::uint512& getVariableValue(triton::usize id) const;
 
         //! Gets a variable value from its name.
         TRITON_EXPORT const triton::uint512& getVariableValue(const std::string& varName) const;
@@ -0,0 +1,116 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_CONSTRAINTPARTITIONER_H
+#define TRITON_CONSTRAINTPARTITIONER_H
+
+#include <map>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      /*! \class ConstraintPartitioner
+       *  \brief This class is used to send to the solver only the constraints relevant to a query.
+       *
+       *  \details A query is split into its conjuncts (the children of its `land` nodes) and the conjuncts which
+       *  share variables are put in the same partition. The conjuncts which are not satisfied by the concrete values
+       *  (e.g. the branch to flip) are relevant and so are all the conjuncts of their partitions. The other partitions
+       *  are satisfied by the concrete values of their variables (e.g. the prefix of the path which has been executed)
+       *  and are not sent to the solver: the concrete values of their variables complete the model.
+       */
+      class ConstraintPartitioner {
+        protected:
+          //! True if the partitioning is enabled.
+          bool enabled;
+
+          //! The number of queries partitioned.
+          triton::usize queries;
+
+          //! The number of conjuncts of the queries.
+          triton::usize constraints;
+
+          //! The number of conjuncts sent to the solver.
+          triton::usize sentConstraints;
+
+          //! The number of variables of the queries.
+          triton::usize variables;
+
+          //! The number of variables sent to the solver.
+          triton::usize sentVariables;
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT ConstraintPartitioner();
+
+          //! Returns true if the partitioning is enabled.
+          TRITON_EXPORT bool isEnabled(void) const;
+
+          //! Enables or disables the partitioning. Disabling the partitioning clears its statistics.
+          TRITON_EXPORT void enable(bool flag);
+
+          //! Returns the number of queries partitioned.
+          TRITON_EXPORT triton::usize getNumberOfQueries(void) const;
+
+          //! Returns the number of conjuncts of the queries.
+          TRITON_EXPORT triton::usize getNumberOfConstraints(void) const;
+
+          //! Returns the number of conjuncts sent to the solver.
+          TRITON_EXPORT triton::usize getNumberOfSentConstraints(void) const;
+
+          //! Returns the number of variables of the queries.
+          TRITON_EXPORT triton::usize getNumberOfVariables(void) const;
+
+          //! Returns the number of variables sent to the solver.
+          TRITON_EXPORT triton::usize getNumberOfSentVariables(void) const;
+
+          /*!
+           * \brief Returns the conjunction of the conjuncts of a logical node which are relevant to the query.
+           *
+           * \details `concrete` is set with the concrete values of the variables of the other conjuncts. Returns
+           * nullptr if all the conjuncts are satisfied by the concrete values.
+           */
+          TRITON_EXPORT triton::ast::SharedAbstractNode partition(const triton::ast::SharedAbstractNode& node, std::map<triton::uint32, SolverModel>& concrete);
+
+          //! Clears the statistics.
+          TRITON_EXPORT void clear(void);
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_CONSTRAINTPARTITIONER_H */
@@ -0,0 +1,144 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_DECODECACHE_H
+#define TRITON_DECODECACHE_H
+
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <triton/dllexport.hpp>
+#include <triton/instruction.hpp>
+#include <triton/operandWrapper.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Architecture namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    //! The maximum size of an instruction stored in the decode cache (in bytes).
+    const triton::uint32 DECODE_CACHE_MAX_INST_SIZE = 16;
+
+    //! The default maximum number of instructions stored in the decode cache.
+    const triton::usize DECODE_CACHE_DEFAULT_SIZE = 0x10000;
+
+    /*! \class DecodeCache
+     *  \brief This class is used to keep the disassembly of already decoded instructions.
+     *
+     *  \details Entries are keyed by the instruction address and are only used if the opcode
+     *  bytes of the instruction to decode start with the bytes of the cached instruction. The cache
+     *  is owned by the Architecture and flushed whenever the architecture is set or cleared, so the
+     *  mode (x86 or x86-64) is implicitly part of the key. When the cache is full, it is flushed.
+     *  Entries overlapping a memory area are dropped when a concrete value is written into this area
+     *  (see invalidate()).
+     */
+    class DecodeCache {
+      protected:
+        //! A decoded instruction.
+        struct Entry {
+          //! The opcode of the instruction.
+          triton::uint8 opcode[DECODE_CACHE_MAX_INST_SIZE];
+
+          //! The size of the instruction.
+          triton::uint32 size;
+
+          //! The type of the instruction.
+          triton::uint32 type;
+
+          //! The prefix of the instruction.
+          triton::uint32 prefix;
+
+          //! True if the instruction is a branch.
+          bool branch;
+
+          //! True if the instruction changes the control flow.
+          bool controlFlow;
+
+          //! The disassembly of the instruction.
+          std::string disassembly;
+
+          //! The operands of the instruction.
+          std::vector<triton::arch::OperandWrapper> operands;
+        };
+
+        //! True if the cache is enabled.
+        bool enabled;
+
+        //! The maximum number of entries.
+        triton::usize maxSize;
+
+        //! The number of hits.
+        triton::usize hits;
+
+        //! The number of misses.
+        triton::usize misses;
+
+        //! The decoded instructions (address -> entry).
+        std::unordered_map<triton::uint64, Entry> entries;
+
+        //! The ordered addresses of the decoded instructions, used for the invalidation.
+        std::set<triton::uint64> addresses;
+
+      public:
+        //! Constructor.
+        TRITON_EXPORT DecodeCache();
+
+        //! Returns true if the cache is enabled.
+        TRITON_EXPORT bool isEnabled(void) const;
+
+        //! Enables or disables the cache. Disabling the cache clears it.
+        TRITON_EXPORT void enable(bool flag);
+
+        //! Returns the maximum number of entries.
+        TRITON_EXPORT triton::usize getMaxSize(void) const;
+
+        //! Sets the maximum number of entries. Clears the cache.
+        TRITON_EXPORT void setMaxSize(triton::usize size);
+
+        //! Returns the number of entries.
+        TRITON_EXPORT triton::usize getSize(void) const;
+
+        //! Returns the number of hits.
+        TRITON_EXPORT triton::usize getHits(void) const;
+
+        //! Returns the number of misses.
+        TRITON_EXPORT triton::usize getMisses(void) const;
+
+        //! Fills the disassembly fields of `inst` from the cache. Returns false on a miss.
+        TRITON_EXPORT bool lookup(triton::arch::Instruction& inst);
+
+        //! Records the disassembly fields of a freshly decoded instruction.
+        TRITON_EXPORT void insert(const triton::arch::Instruction& inst);
+
+        //! Drops all instructions overlapping the range `[baseAddr:size]`.
+        TRITON_EXPORT void invalidate(triton::uint64 baseAddr, triton::usize size);
+
+        //! Clears the cache and its statistics.
+        TRITON_EXPORT void clear(void);
+    };
+
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_DECODECACHE_H */
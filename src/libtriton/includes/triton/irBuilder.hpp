@@ -15,6 +15,7 @@
 #include <triton/semanticsInterface.hpp>
 #include <triton/symbolicEngine.hpp>
 #include <triton/taintEngine.hpp>
+#include <triton/x86ConcreteSemantics.hpp>
 
 
 
@@ -46,12 +47,12 @@ namespace triton {
         //! Symbolic engine API
         triton::engines::symbolic::SymbolicEngine* symbolicEngine;
 
-        //! Backup symbolic engine
-        triton::engines::symbolic::SymbolicEngine* backupSymbolicEngine;
-
         //! Taint engine API
         triton::engines::taint::TaintEngine* taintEngine;
 
+        //! Clears the semantics of an instruction before building it.
+        void clearSemantics(triton::arch::Instruction& inst);
+
         //! Removes all symbolic expressions of an instruction.
         void removeSymbolicExpressions(triton::arch::Instruction& inst);
 
@@ -71,6 +72,9 @@ namespace triton {
         //! x86 ISA builder.
         triton::arch::SemanticsInterface* x86Isa;
 
+        //! x86 ISA interpreter used when the symbolic engine is disabled.
+        triton::arch::x86::x86ConcreteSemantics* x86ConcreteIsa;
+
       public:
         //! Constructor.
         TRITON_EXPORT IrBuilder(triton::arch::Architecture* architecture,
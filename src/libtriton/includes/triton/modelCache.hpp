@@ -0,0 +1,119 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_MODELCACHE_H
+#define TRITON_MODELCACHE_H
+
+#include <list>
+#include <map>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      //! The default maximum number of models stored in the model cache.
+      const triton::usize MODEL_CACHE_DEFAULT_SIZE = 32;
+
+      /*! \class ModelCache
+       *  \brief This class is used to reuse the models already found by the solver.
+       *
+       *  \details A new constraint is evaluated under each recorded model, from the most recently used one, and the
+       *  first model which satisfies it is returned instead of calling the solver. The variables of the constraint which
+       *  are not in a model take their concrete value. The constraint is evaluated aside under the values of the model,
+       *  once per shared subtree: no node is built, and neither the AST nor the concrete values of the variables are
+       *  modified.
+       */
+      class ModelCache {
+        protected:
+          //! True if the cache is enabled.
+          bool enabled;
+
+          //! The maximum number of models.
+          triton::usize maxSize;
+
+          //! The number of queries answered by a recorded model.
+          triton::usize hits;
+
+          //! The number of queries which are not satisfied by any recorded model.
+          triton::usize misses;
+
+          //! The models, from the most recently used to the least recently used.
+          std::list<std::map<triton::uint32, SolverModel>> models;
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT ModelCache();
+
+          //! Returns true if the cache is enabled.
+          TRITON_EXPORT bool isEnabled(void) const;
+
+          //! Enables or disables the cache. Disabling the cache clears it.
+          TRITON_EXPORT void enable(bool flag);
+
+          //! Returns the maximum number of models.
+          TRITON_EXPORT triton::usize getMaxSize(void) const;
+
+          //! Sets the maximum number of models. The least recently used models above this size are dropped.
+          TRITON_EXPORT void setMaxSize(triton::usize size);
+
+          //! Returns the number of models.
+          TRITON_EXPORT triton::usize getSize(void) const;
+
+          //! Returns the number of queries answered by a recorded model.
+          TRITON_EXPORT triton::usize getHits(void) const;
+
+          //! Returns the number of queries which are not satisfied by any recorded model.
+          TRITON_EXPORT triton::usize getMisses(void) const;
+
+          /*!
+           * \brief Looks for a recorded model which satisfies a logical node. Returns false on a miss.
+           *
+           * \details On a hit, `model` is set with the values of all the variables of the node.
+           */
+          TRITON_EXPORT bool lookup(const triton::ast::SharedAbstractNode& node, std::map<triton::uint32, SolverModel>& model);
+
+          //! Records a model found by the solver as the most recently used one.
+          TRITON_EXPORT void insert(const std::map<triton::uint32, SolverModel>& model);
+
+          //! Clears the cache and its statistics.
+          TRITON_EXPORT void clear(void);
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_MODELCACHE_H */
@@ -31,9 +31,11 @@ namespace triton {
     //! Enumerates all kinds of mode.
     enum mode_e {
       ALIGNED_MEMORY,        //!< [symbolic mode] Keep a map of aligned memory.
+      LAZY_FLAGS,            //!< [symbolic mode] Build the symbolic expressions of the flags only when they are read.
       ONLY_ON_SYMBOLIZED,    //!< [symbolic mode] Perform symbolic execution only on symbolized expressions.
       ONLY_ON_TAINTED,       //!< [symbolic mode] Perform symbolic execution only on tainted instructions.
       PC_TRACKING_SYMBOLIC,  //!< [symbolic mode] Track path constraints only if they are symbolized.
+      TAINT_LABELS,          //!< [taint mode] Track which labels (sources) each tainted byte and register comes from.
     };
 
 
@@ -0,0 +1,188 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_PAGETABLE_H
+#define TRITON_PAGETABLE_H
+
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Utils namespace
+  namespace utils {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup utils
+   *  @{
+   */
+
+    /*! \class PageTable
+     *  \brief The sparse table of pages of a paged memory (concrete, taint or symbolic memory).
+     *
+     *  \details The addresses are split in pages of `2^Shift` bytes. Only the pages which are used are
+     *  allocated, in a hash table indexed by page id. The last page looked up is cached, its pointer
+     *  staying valid until the page is erased.
+     */
+    template <typename Page, triton::uint32 Shift>
+    class PageTable {
+      public:
+        //! The type of the table (page id -> page).
+        typedef std::unordered_map<triton::uint64, Page> Table;
+
+      protected:
+        //! The pages (page id -> page).
+        Table pages;
+
+        //! The id of the last page looked up.
+        mutable triton::uint64 lastPageId;
+
+        //! The last page looked up (nullptr if unknown).
+        mutable Page* lastPage;
+
+      public:
+        //! The size of a page (in bytes).
+        static triton::usize getPageSize(void) {
+          return static_cast<triton::usize>(1) << Shift;
+        }
+
+        //! Returns the id of the page of an address.
+        static triton::uint64 getPageId(triton::uint64 addr) {
+          return addr >> Shift;
+        }
+
+        //! Returns the offset of an address into its page.
+        static triton::usize getOffset(triton::uint64 addr) {
+          return static_cast<triton::usize>(addr & (getPageSize() - 1));
+        }
+
+        //! Returns the number of bytes of the range `[addr:size]` which are in the page of `addr`.
+        static triton::usize getChunk(triton::uint64 addr, triton::usize size) {
+          return std::min(size, getPageSize() - getOffset(addr));
+        }
+
+        //! Constructor.
+        PageTable() : lastPageId(0), lastPage(nullptr) {
+        }
+
+        //! Constructor by copy.
+        PageTable(const PageTable& other) : pages(other.pages), lastPageId(0), lastPage(nullptr) {
+        }
+
+        //! Copies a PageTable.
+        PageTable& operator=(const PageTable& other) {
+          this->pages      = other.pages;
+          this->lastPageId = 0;
+          this->lastPage   = nullptr;
+          return *this;
+        }
+
+        //! Removes all pages.
+        void clear(void) {
+          this->pages.clear();
+          this->lastPageId = 0;
+          this->lastPage   = nullptr;
+        }
+
+        //! Returns the number of allocated pages.
+        triton::usize size(void) const {
+          return this->pages.size();
+        }
+
+        //! Returns the page of an address or nullptr if it does not exist.
+        Page* find(triton::uint64 addr) const {
+          triton::uint64 pageId = getPageId(addr);
+
+          if (this->lastPage && this->lastPageId == pageId)
+            return this->lastPage;
+
+          auto it = this->pages.find(pageId);
+          if (it == this->pages.end())
+            return nullptr;
+
+          /* Nodes of an unordered_map are never moved, the pointer stays valid until the page is erased */
+          this->lastPageId = pageId;
+          this->lastPage   = const_cast<Page*>(&it->second);
+
+          return this->lastPage;
+        }
+
+        //! Returns the page of an address, creates it if it does not exist.
+        Page& get(triton::uint64 addr) {
+          Page* page = this->find(addr);
+
+          if (page == nullptr) {
+            triton::uint64 pageId = getPageId(addr);
+            page = &this->pages[pageId];
+            this->lastPageId = pageId;
+            this->lastPage   = page;
+          }
+
+          return *page;
+        }
+
+        //! Releases the page of an address.
+        void erase(triton::uint64 addr) {
+          this->pages.erase(getPageId(addr));
+          this->lastPage = nullptr;
+        }
+
+        //! Returns the pages (page id, page) in ascending order of address.
+        std::vector<std::pair<triton::uint64, const Page*>> getSortedPages(void) const {
+          std::vector<std::pair<triton::uint64, const Page*>> sorted;
+
+          sorted.reserve(this->pages.size());
+          for (const auto& item : this->pages)
+            sorted.push_back(std::make_pair(item.first, &item.second));
+
+          std::sort(sorted.begin(), sorted.end(),
+            [](const std::pair<triton::uint64, const Page*>& a, const std::pair<triton::uint64, const Page*>& b) {
+              return a.first < b.first;
+            }
+          );
+
+          return sorted;
+        }
+
+        //! Returns an iterator to the first page (in no particular order).
+        typename Table::iterator begin(void) {
+          return this->pages.begin();
+        }
+
+        //! Returns the past-the-end iterator of the pages.
+        typename Table::iterator end(void) {
+          return this->pages.end();
+        }
+
+        //! Returns an iterator to the first page (in no particular order).
+        typename Table::const_iterator begin(void) const {
+          return this->pages.begin();
+        }
+
+        //! Returns the past-the-end iterator of the pages.
+        typename Table::const_iterator end(void) const {
+          return this->pages.end();
+        }
+    };
+
+  /*! @} End of utils namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_PAGETABLE_H */
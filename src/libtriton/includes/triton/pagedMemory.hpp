@@ -0,0 +1,105 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_PAGEDMEMORY_H
+#define TRITON_PAGEDMEMORY_H
+
+#include <triton/dllexport.hpp>
+#include <triton/pageTable.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Architecture namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    //! The size of a concrete memory page (in bytes).
+    const triton::usize PAGED_MEMORY_PAGE_SIZE = 0x1000;
+
+    //! The number of bits used to index a byte inside a concrete memory page.
+    const triton::uint32 PAGED_MEMORY_PAGE_SHIFT = 12;
+
+    /*! \class PagedMemory
+     *  \brief This class is used to store the concrete memory of a CPU.
+     *
+     *  \details The memory is split in pages of `PAGED_MEMORY_PAGE_SIZE` bytes. Each page holds the concrete
+     *  values of its bytes and a bitmap of the mapped bytes, so the `isMemoryMapped()` / `unmapMemory()`
+     *  semantics stay byte precise while areas are read and written with `memcpy`.
+     */
+    class PagedMemory {
+      protected:
+        //! A concrete memory page.
+        struct Page {
+          //! The concrete values.
+          triton::uint8 values[PAGED_MEMORY_PAGE_SIZE];
+
+          //! The bitmap of mapped bytes.
+          triton::uint64 mapped[PAGED_MEMORY_PAGE_SIZE / 64];
+
+          //! The number of mapped bytes.
+          triton::usize count;
+
+          //! Constructor.
+          Page();
+        };
+
+        //! The table of pages (page id -> page).
+        triton::utils::PageTable<Page, PAGED_MEMORY_PAGE_SHIFT> pages;
+
+        //! Marks the range `[offset:size]` of a page as mapped.
+        void mapBytes(Page& page, triton::usize offset, triton::usize size);
+
+        //! Marks the range `[offset:size]` of a page as unmapped.
+        void unmapBytes(Page& page, triton::usize offset, triton::usize size);
+
+        //! Returns true if the range `[offset:size]` of a page is fully mapped.
+        bool isMapped(const Page& page, triton::usize offset, triton::usize size) const;
+
+      public:
+        //! Removes all pages.
+        TRITON_EXPORT void clear(void);
+
+        //! Returns the number of mapped pages.
+        TRITON_EXPORT triton::usize getNumberOfPages(void) const;
+
+        //! Returns the concrete value of a byte (0 if the byte is not mapped).
+        TRITON_EXPORT triton::uint8 read(triton::uint64 addr) const;
+
+        //! Reads the range `[baseAddr:size]` into `area`. Unmapped bytes are read as 0.
+        TRITON_EXPORT void read(triton::uint64 baseAddr, triton::uint8* area, triton::usize size) const;
+
+        //! Sets the concrete value of a byte and maps it.
+        TRITON_EXPORT void write(triton::uint64 addr, triton::uint8 value);
+
+        //! Writes `area` into the range `[baseAddr:size]` and maps it.
+        TRITON_EXPORT void write(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size);
+
+        //! Returns true if the range `[baseAddr:size]` is mapped.
+        TRITON_EXPORT bool isMapped(triton::uint64 baseAddr, triton::usize size=1) const;
+
+        //! Unmaps the range `[baseAddr:size]`. Pages without mapped bytes are released.
+        TRITON_EXPORT void unmap(triton::uint64 baseAddr, triton::usize size=1);
+    };
+
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_PAGEDMEMORY_H */
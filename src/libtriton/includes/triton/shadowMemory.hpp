@@ -0,0 +1,191 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SHADOWMEMORY_H
+#define TRITON_SHADOWMEMORY_H
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <triton/dllexport.hpp>
+#include <triton/pageTable.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Taint namespace
+    namespace taint {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup taint
+     *  @{
+     */
+
+      //! The size of a shadow memory page (in bytes of memory).
+      const triton::usize SHADOW_MEMORY_PAGE_SIZE = 0x1000;
+
+      //! The number of bits used to index a byte inside a shadow memory page.
+      const triton::uint32 SHADOW_MEMORY_PAGE_SHIFT = 12;
+
+      /*! \class ShadowMemory
+       *  \brief This class is used to store the tainted bytes of the memory.
+       *
+       *  \details The memory is split in pages of `SHADOW_MEMORY_PAGE_SIZE` bytes. Each page holds a bitmap
+       *  of its tainted bytes, so an access is checked and spread a 64-bit word at a time. Only the pages
+       *  which contain tainted bytes are allocated. The tainted addresses are iterated in ascending order.
+       *  A tainted byte may also carry the id of a set of labels (see `TaintEngine`), 0 means no label.
+       */
+      class ShadowMemory {
+        protected:
+          //! A shadow memory page.
+          struct Page {
+            //! The bitmap of tainted bytes.
+            triton::uint64 bits[SHADOW_MEMORY_PAGE_SIZE / 64];
+
+            //! The number of tainted bytes.
+            triton::usize count;
+
+            //! The label set ids of the bytes (allocated when a byte gets a label).
+            std::vector<triton::uint32> labels;
+
+            //! Constructor.
+            Page();
+          };
+
+          //! The pages (page id -> page).
+          triton::utils::PageTable<Page, SHADOW_MEMORY_PAGE_SHIFT> pages;
+
+          //! The number of tainted bytes.
+          triton::usize numberOfBytes;
+
+        public:
+          /*!
+           * \brief A forward iterator over the tainted addresses.
+           *
+           * \details The pages are listed when the iteration begins and the iterator points to them. It is
+           * invalidated by `untaint()` and `clear()`, which may release a page it points to: collect the
+           * addresses first if the memory is untainted while iterating. A byte tainted after `begin()` is
+           * only seen if its page already existed.
+           */
+          class const_iterator {
+            public:
+              typedef std::forward_iterator_tag iterator_category;
+              typedef triton::uint64 value_type;
+              typedef std::ptrdiff_t difference_type;
+              typedef const triton::uint64* pointer;
+              typedef triton::uint64 reference;
+
+              //! The pages (page id, page) in ascending order of address.
+              typedef std::vector<std::pair<triton::uint64, const Page*>> SortedPages;
+
+              //! Constructor. A null `pages` gives the past-the-end iterator.
+              TRITON_EXPORT const_iterator(const std::shared_ptr<const SortedPages>& pages);
+
+              //! Returns the tainted address.
+              TRITON_EXPORT triton::uint64 operator*(void) const;
+
+              //! Moves to the next tainted address.
+              TRITON_EXPORT const_iterator& operator++(void);
+
+              //! Moves to the next tainted address.
+              TRITON_EXPORT const_iterator operator++(int);
+
+              //! Returns true if both iterators point to the same address.
+              TRITON_EXPORT bool operator==(const const_iterator& other) const;
+
+              //! Returns true if the iterators point to different addresses.
+              TRITON_EXPORT bool operator!=(const const_iterator& other) const;
+
+            private:
+              //! The pages iterated, sorted when the iteration began.
+              std::shared_ptr<const SortedPages> pages;
+
+              //! The index of the current page.
+              triton::usize index;
+
+              //! The offset of the current byte in the page.
+              triton::usize offset;
+
+              //! Returns true if the iterator is past the last tainted address.
+              bool atEnd(void) const;
+
+              //! Moves to the first tainted byte from the current position (included).
+              void seek(void);
+          };
+
+          //! Constructor.
+          TRITON_EXPORT ShadowMemory();
+
+          //! Untaints all bytes and removes all pages.
+          TRITON_EXPORT void clear(void);
+
+          //! Returns true if there is no tainted byte.
+          TRITON_EXPORT bool empty(void) const;
+
+          //! Returns the number of tainted bytes.
+          TRITON_EXPORT triton::usize size(void) const;
+
+          //! Returns the number of allocated pages.
+          TRITON_EXPORT triton::usize getNumberOfPages(void) const;
+
+          //! Returns 1 if the byte is tainted, otherwise 0 (same as `std::set::count()`).
+          TRITON_EXPORT triton::usize count(triton::uint64 addr) const;
+
+          //! Returns true if at least one byte of the range `[baseAddr:size]` is tainted.
+          TRITON_EXPORT bool isTainted(triton::uint64 baseAddr, triton::usize size=1) const;
+
+          //! Taints the range `[baseAddr:size]`.
+          TRITON_EXPORT void taint(triton::uint64 baseAddr, triton::usize size=1);
+
+          //! Untaints the range `[baseAddr:size]` and clears its labels. Pages without tainted bytes are released.
+          TRITON_EXPORT void untaint(triton::uint64 baseAddr, triton::usize size=1);
+
+          //! Returns the label set id of a byte (0 if the byte has no label).
+          TRITON_EXPORT triton::uint32 getLabel(triton::uint64 addr) const;
+
+          //! Sets the label set id of the tainted bytes of the range `[baseAddr:size]`.
+          TRITON_EXPORT void setLabel(triton::uint64 baseAddr, triton::usize size, triton::uint32 label);
+
+          //! Marks the label set ids held by the bytes (`used[id]` is set to true).
+          TRITON_EXPORT void markLabels(std::vector<bool>& used) const;
+
+          //! Replaces the label set id of each byte (`id` becomes `ids[id]`).
+          TRITON_EXPORT void remapLabels(const std::vector<triton::uint32>& ids);
+
+          //! Returns an iterator to the lowest tainted address. \sa const_iterator for its invalidation rule.
+          TRITON_EXPORT const_iterator begin(void) const;
+
+          //! Returns the past-the-end iterator.
+          TRITON_EXPORT const_iterator end(void) const;
+      };
+
+    /*! @} End of taint namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SHADOWMEMORY_H */
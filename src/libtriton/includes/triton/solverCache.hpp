@@ -0,0 +1,179 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SOLVERCACHE_H
+#define TRITON_SOLVERCACHE_H
+
+#include <list>
+#include <map>
+#include <string>
+#include <unordered_map>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/solverEnums.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      //! The default maximum number of queries stored in the solver cache.
+      const triton::usize SOLVER_CACHE_DEFAULT_SIZE = 0x1000;
+
+      /*! \class SolverCache
+       *  \brief This class is used to keep the answers of the solver to already seen constraints.
+       *
+       *  \details Entries are keyed by a 256-bit digest of the canonical form of a constraint (see getCanonicalForm()
+       *  and getDigest()). Only the digest is kept, so an entry has a fixed size whatever the size of the constraint,
+       *  and two different forms would have to collide on the whole 256 bits to share an answer. An entry keeps the
+       *  state of the constraint (SAT or UNSAT) and the models found. When the cache is full, the least recently used
+       *  entry is dropped. The cache may be saved into a file and loaded by another run (see save() and load()).
+       */
+      class SolverCache {
+        protected:
+          //! A constraint already solved.
+          struct Entry {
+            //! The digest of the canonical form of the constraint.
+            triton::uint256 digest;
+
+            //! The state of the constraint (SAT or UNSAT).
+            status_e status;
+
+            //! The models found.
+            std::list<std::map<triton::uint32, SolverModel>> models;
+
+            //! True if `models` are all the models of the constraint.
+            bool complete;
+          };
+
+          //! True if the cache is enabled.
+          bool enabled;
+
+          //! The maximum number of entries.
+          triton::usize maxSize;
+
+          //! The number of hits.
+          triton::usize hits;
+
+          //! The number of misses.
+          triton::usize misses;
+
+          //! The entries, from the most recently used to the least recently used.
+          std::list<Entry> entries;
+
+          //! The entries indexed by the lower 64 bits of their digest.
+          std::unordered_multimap<triton::uint64, std::list<Entry>::iterator> index;
+
+          //! Returns the entry of a digest, or entries.end() if it is not cached.
+          std::list<Entry>::iterator find(const triton::uint256& digest);
+
+          //! Removes an entry.
+          void erase(std::list<Entry>::iterator entry);
+
+          //! Records an entry as the most recently used one and drops the least recently used ones if the cache is full.
+          void store(Entry&& entry);
+
+          //! Copies a SolverCache.
+          void copy(const SolverCache& other);
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT SolverCache();
+
+          //! Constructor by copy.
+          TRITON_EXPORT SolverCache(const SolverCache& other);
+
+          //! Operator.
+          TRITON_EXPORT SolverCache& operator=(const SolverCache& other);
+
+          //! Returns true if the cache is enabled.
+          TRITON_EXPORT bool isEnabled(void) const;
+
+          //! Enables or disables the cache. Disabling the cache clears it.
+          TRITON_EXPORT void enable(bool flag);
+
+          //! Returns the maximum number of entries.
+          TRITON_EXPORT triton::usize getMaxSize(void) const;
+
+          //! Sets the maximum number of entries. The least recently used entries above this size are dropped.
+          TRITON_EXPORT void setMaxSize(triton::usize size);
+
+          //! Returns the number of entries.
+          TRITON_EXPORT triton::usize getSize(void) const;
+
+          //! Returns the number of hits.
+          TRITON_EXPORT triton::usize getHits(void) const;
+
+          //! Returns the number of misses.
+          TRITON_EXPORT triton::usize getMisses(void) const;
+
+          /*!
+           * \brief Returns the canonical form of a constraint.
+           *
+           * \details The references are unrolled and the identical subtrees are written once, so two constraints
+           * have the same form if and only if they are structurally identical once unrolled.
+           */
+          TRITON_EXPORT static std::string getCanonicalForm(const triton::ast::SharedAbstractNode& node);
+
+          //! Returns the 256-bit digest of a canonical form, which identifies the entry of the constraint.
+          TRITON_EXPORT static triton::uint256 getDigest(const std::string& form);
+
+          /*!
+           * \brief Looks for the answer to a query on a canonical form. Returns false on a miss.
+           *
+           * \details `limit` is the number of models wanted, 0 if only the state is wanted. On a hit,
+           * `status` and `models` (at most `limit` models) are set.
+           */
+          TRITON_EXPORT bool lookup(const std::string& form, triton::uint32 limit, status_e& status, std::list<std::map<triton::uint32, SolverModel>>& models);
+
+          //! Records the state (SAT or UNSAT) of a canonical form. The models already recorded are kept.
+          TRITON_EXPORT void insert(const std::string& form, status_e status);
+
+          //! Records the state (SAT or UNSAT) and the models of a canonical form. `complete` is true if they are all its models.
+          TRITON_EXPORT void insert(const std::string& form, status_e status, const std::list<std::map<triton::uint32, SolverModel>>& models, bool complete);
+
+          //! Saves the entries into a file.
+          TRITON_EXPORT void save(const std::string& filename) const;
+
+          //! Loads the entries of a file saved by save(). They are added to the current ones.
+          TRITON_EXPORT void load(const std::string& filename);
+
+          //! Clears the cache and its statistics.
+          TRITON_EXPORT void clear(void);
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SOLVERCACHE_H */
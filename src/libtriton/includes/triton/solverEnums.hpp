@@ -0,0 +1,53 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SOLVERENUMS_H
+#define TRITON_SOLVERENUMS_H
+
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      //! Enumerates all states of a solver query.
+      enum status_e {
+        UNSAT = 0, //!< The constraint is not satisfiable.
+        SAT,       //!< The constraint is satisfiable.
+        TIMEOUT,   //!< The solver ran out of time.
+        UNKNOWN    //!< The solver could not decide.
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SOLVERENUMS_H */
@@ -10,9 +10,15 @@
 
 #include <list>
 #include <map>
+#include <vector>
 
 #include <triton/ast.hpp>
+#include <triton/constraintPartitioner.hpp>
 #include <triton/dllexport.hpp>
+#include <triton/modelCache.hpp>
+#include <triton/pathConstraint.hpp>
+#include <triton/solverCache.hpp>
+#include <triton/solverEnums.hpp>
 #include <triton/solverModel.hpp>
 #include <triton/tritonTypes.hpp>
 
@@ -39,6 +45,24 @@ namespace triton {
      *  @{
      */
 
+      //! The solution of a branch which has not been taken along a path (see SolverInterface::solveBranches()).
+      struct BranchSolution {
+        //! The index of the path constraint of the branch.
+        triton::usize index;
+
+        //! The source address of the branch.
+        triton::uint64 srcAddr;
+
+        //! The destination address of the branch.
+        triton::uint64 dstAddr;
+
+        //! The state of the query.
+        status_e status;
+
+        //! The model (map of symbolic variable id -> model) if the branch is satisfiable.
+        std::map<triton::uint32, SolverModel> model;
+      };
+
       /*! \interface SolverInterface
           \brief This interface is used to interface with solvers */
       class SolverInterface {
@@ -67,6 +91,63 @@ namespace triton {
           //! Returns true if an expression is satisfiable.
           TRITON_EXPORT virtual bool isSat(const triton::ast::SharedAbstractNode& node) const = 0;
 
+          //! Starts an incremental solving session. A session already started is restarted.
+          TRITON_EXPORT virtual void startSession(void) = 0;
+
+          //! Stops the incremental solving session.
+          TRITON_EXPORT virtual void stopSession(void) = 0;
+
+          //! Returns true if an incremental solving session is started.
+          TRITON_EXPORT virtual bool isSessionStarted(void) const = 0;
+
+          //! Asserts a constraint in the session until it is popped.
+          TRITON_EXPORT virtual void pushSessionConstraint(const triton::ast::SharedAbstractNode& node) = 0;
+
+          //! Removes the `count` last constraints pushed in the session.
+          TRITON_EXPORT virtual void popSessionConstraints(triton::usize count=1) = 0;
+
+          //! Returns the number of constraints pushed in the session.
+          TRITON_EXPORT virtual triton::usize getNumberOfSessionConstraints(void) const = 0;
+
+          //! Computes and returns a model of the constraints of the session and `node` (which is not kept).
+          /*! \brief map of symbolic variable id -> model
+           *
+           * \details
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           */
+          TRITON_EXPORT virtual std::map<triton::uint32, SolverModel> getSessionModel(const triton::ast::SharedAbstractNode& node) = 0;
+
+          //! Returns true if the constraints of the session and `node` (which is not kept) are satisfiable.
+          TRITON_EXPORT virtual bool isSessionSat(const triton::ast::SharedAbstractNode& node) = 0;
+
+          /*!
+           * \brief Solves each branch which has not been taken along a path: the conjunction of the taken
+           * branches before it and of its constraint.
+           *
+           * \details If `dedup` is true, a branch is solved only once per (srcAddr, dstAddr). The `timeout`
+           * is the time budget (in milliseconds) of each query, 0 for no limit.
+           */
+          TRITON_EXPORT virtual std::vector<BranchSolution> solveBranches(const std::vector<triton::engines::symbolic::PathConstraint>& pathConstraints, bool dedup, triton::uint32 timeout) const = 0;
+
+          //! Returns the cache of the queries answered by getModel(), getModels() and isSat().
+          TRITON_EXPORT virtual SolverCache& getCache(void) = 0;
+
+          //! Returns the cache of the queries answered by getModel(), getModels() and isSat().
+          TRITON_EXPORT virtual const SolverCache& getCache(void) const = 0;
+
+          //! Returns the cache of the models reused by getModel() and isSat().
+          TRITON_EXPORT virtual ModelCache& getModelCache(void) = 0;
+
+          //! Returns the cache of the models reused by getModel() and isSat().
+          TRITON_EXPORT virtual const ModelCache& getModelCache(void) const = 0;
+
+          //! Returns the partitioner of the constraints sent to the solver by getModel() and isSat().
+          TRITON_EXPORT virtual ConstraintPartitioner& getPartitioner(void) = 0;
+
+          //! Returns the partitioner of the constraints sent to the solver by getModel() and isSat().
+          TRITON_EXPORT virtual const ConstraintPartitioner& getPartitioner(void) const = 0;
+
           //! Returns the name of the solver.
           TRITON_EXPORT virtual std::string getName(void) const = 0;
       };
@@ -8,11 +8,13 @@
 #ifndef TRITON_SYMBOLICENGINE_H
 #define TRITON_SYMBOLICENGINE_H
 
+#include <functional>
 #include <list>
 #include <map>
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <triton/architecture.hpp>
 #include <triton/ast.hpp>
@@ -24,6 +26,7 @@
 #include <triton/register.hpp>
 #include <triton/symbolicEnums.hpp>
 #include <triton/symbolicExpression.hpp>
+#include <triton/symbolicMemory.hpp>
 #include <triton/symbolicSimplification.hpp>
 #include <triton/symbolicVariable.hpp>
 #include <triton/tritonTypes.hpp>
@@ -53,6 +56,28 @@ namespace triton {
      *  @{
      */
 
+      //! Builds the AST of a flag whose expression has been deferred (see the `LAZY_FLAGS` mode).
+      using LazyFlagBuilder = std::function<triton::ast::SharedAbstractNode(void)>;
+
+      /*! \brief An entry of the symbolic memory journal.
+       *
+       * \details The ranges of the symbolic memory which were in the area `[addr, addr + size)`
+       * (clipped to it) before it was modified.
+       */
+      struct MemoryJournalEntry {
+        //! The first address of the area.
+        triton::uint64 addr;
+
+        //! The size of the area in bytes.
+        triton::usize size;
+
+        //! The previous ranges (address:range).
+        std::vector<std::pair<triton::uint64, MemoryRange>> ranges;
+
+        //! The previous byte slices of the area (address:slice).
+        std::vector<std::pair<triton::uint64, SharedSymbolicExpression>> slices;
+      };
+
       //! \class SymbolicEngine
       /*! \brief The symbolic engine class. */
       class SymbolicEngine
@@ -83,6 +108,14 @@ namespace triton {
            */
           std::unordered_map<triton::usize, SymbolicVariable*> symbolicVariables;
 
+          /*! \brief The index of the symbolic variables by name
+           *
+           * \details
+           * **item1**: variable name<br>
+           * **item2**: symbolic variable
+           */
+          std::unordered_map<std::string, SymbolicVariable*> symbolicVariableNames;
+
           /*! \brief The map of symbolic expressions
            *
            * \details
@@ -91,13 +124,11 @@ namespace triton {
            */
           mutable std::unordered_map<triton::usize, WeakSymbolicExpression> symbolicExpressions;
 
-          /*! \brief map of address -> symbolic expression
-           *
-           * \details
-           * **item1**: memory address<br>
-           * **item2**: shared symbolic expression
-           */
-          std::map<triton::uint64, SharedSymbolicExpression> memoryReference;
+          //! The paged table of the symbolic memory (address -> expression slot).
+          SymbolicMemory memoryReference;
+
+          //! The bytes sliced from the ranges of the symbolic memory (address -> slice), dropped when the address is written.
+          std::map<triton::uint64, SharedSymbolicExpression> memorySlices;
 
           /*! \brief map of <address:size> -> symbolic expression.
            *
@@ -110,6 +141,14 @@ namespace triton {
           //! Symbolic register state.
           std::vector<SharedSymbolicExpression> symbolicReg;
 
+          /*! \brief map of flag id -> deferred flag expression (`LAZY_FLAGS` mode).
+           *
+           * \details
+           * **item1**: flag id<br>
+           * **item2**: <builder:<comment:taint>>
+           */
+          std::map<triton::uint32, std::pair<LazyFlagBuilder, std::pair<std::string, bool>>> lazyFlags;
+
         private:
           //! Architecture API
           triton::arch::Architecture* architecture;
@@ -123,6 +162,49 @@ namespace triton {
           //! Defines if this instance is used as a backup.
           bool backupFlag;
 
+          //! Defines if the modifications of the engine are journaled (see startJournal()).
+          bool journalFlag;
+
+          //! The first symbolic expression id created since the journal has been started.
+          triton::usize journalSymExprId;
+
+          //! The first symbolic variable id created since the journal has been started.
+          triton::usize journalSymVarId;
+
+          //! The number of path constraints when the journal has been started.
+          triton::usize journalPathConstraints;
+
+          //! Journal of the symbolic registers (register id:previous expression).
+          std::vector<std::pair<triton::uint32, SharedSymbolicExpression>> journalRegisters;
+
+          //! Journal of the symbolic memory.
+          std::vector<MemoryJournalEntry> journalMemory;
+
+          //! Journal of the aligned memory (<addr:size>:previous expression). A null expression means that the entry did not exist.
+          std::vector<std::pair<std::pair<triton::uint64, triton::uint32>, SharedSymbolicExpression>> journalAlignedMemory;
+
+          //! Journal of the symbolic expressions removed which were created before the journal has been started.
+          std::vector<std::pair<triton::usize, WeakSymbolicExpression>> journalExpressions;
+
+          //! Unrolls a node. `nodes` and `exprs` keep the nodes and the expressions already unrolled, `count` is the number of created nodes.
+          triton::ast::SharedAbstractNode unrollAst(const triton::ast::SharedAbstractNode& node,
+                                                    std::unordered_map<triton::ast::AbstractNode*, triton::ast::SharedAbstractNode>& nodes,
+                                                    std::unordered_map<triton::usize, triton::ast::SharedAbstractNode>& exprs,
+                                                    triton::usize depth, triton::usize maxDepth,
+                                                    triton::usize& count, triton::usize maxNodes);
+
+          //! Assigns `size` bytes of an expression (starting at the byte `offset`) to the memory.
+          void addMemoryRange(triton::uint64 addr, triton::uint32 size, const SharedSymbolicExpression& expr, triton::uint32 offset=0);
+
+          //! Removes `size` bytes of symbolic memory. The ranges which overlap the area are trimmed.
+          void removeMemoryRange(triton::uint64 addr, triton::usize size);
+
+          //! Removes an aligned entry (only this one).
+          void eraseAlignedMemory(triton::uint64 address, triton::uint32 size);
+
+          //! Sets the symbolic expression of a parent register.
+          void setSymbolicRegister(triton::uint32 regId, const SharedSymbolicExpression& expr);
+
           //! Slices all expressions from a given node.
           void sliceExpressions(const triton::ast::SharedAbstractNode& node, std::map<triton::usize, SharedSymbolicExpression>& exprs);
 
@@ -185,11 +267,14 @@ namespace triton {
           //! Returns the symbolic expression corresponding to an id.
           TRITON_EXPORT SharedSymbolicExpression getSymbolicExpressionFromId(triton::usize symExprId) const;
 
-          //! Returns the shared symbolic expression corresponding to the memory address.
-          TRITON_EXPORT SharedSymbolicExpression getSymbolicMemory(triton::uint64 addr) const;
+          //! Returns the shared symbolic expression corresponding to the memory address. The byte is sliced from its range if needed, the slice is a registered expression kept until the byte is written.
+          TRITON_EXPORT SharedSymbolicExpression getSymbolicMemory(triton::uint64 addr);
 
-          //! Returns the map (addr:expr) of all symbolic memory defined.
-          TRITON_EXPORT const std::map<triton::uint64, SharedSymbolicExpression>& getSymbolicMemory(void) const;
+          //! Returns the map (addr:expr) of all symbolic memory defined. All ranges are sliced into bytes.
+          TRITON_EXPORT std::map<triton::uint64, SharedSymbolicExpression> getSymbolicMemory(void);
+
+          //! Returns the ranges of the symbolic memory which overlap `[addr:size]` (clipped to it) in ascending order of address. No expression is created.
+          TRITON_EXPORT std::vector<std::pair<triton::uint64, MemoryRange>> getSymbolicMemoryRanges(triton::uint64 addr, triton::usize size) const;
 
           //! Returns the shared symbolic expression corresponding to the parent register.
           TRITON_EXPORT const SharedSymbolicExpression& getSymbolicRegister(const triton::arch::Register& reg) const;
@@ -248,6 +333,27 @@ namespace triton {
           //! Returns the new shared symbolic volatile expression expression and links this expression to the instruction.
           TRITON_EXPORT const SharedSymbolicExpression& createSymbolicVolatileExpression(triton::arch::Instruction& inst, const triton::ast::SharedAbstractNode& node, const std::string& comment="");
 
+          /*!
+           * \brief Defers the symbolic expression of a flag (`LAZY_FLAGS` mode).
+           *
+           * \details The AST is built by `builder`, then assigned to the flag and its concrete
+           * value is synchronized, only when the flag is read. Note that the deferred expression
+           * is not linked to the instruction.
+           */
+          TRITON_EXPORT void deferSymbolicFlagExpression(const LazyFlagBuilder& builder, const triton::arch::Register& flag, const std::string& comment, bool isTainted);
+
+          //! Returns true if the symbolic expressions of the flags must be deferred.
+          TRITON_EXPORT bool isLazyFlagsEnabled(void) const;
+
+          //! Returns true if the symbolic expression of the register is deferred.
+          TRITON_EXPORT bool isLazyFlag(const triton::arch::Register& reg) const;
+
+          //! Builds the deferred symbolic expression of the register if there is one.
+          TRITON_EXPORT void materializeLazyFlag(const triton::arch::Register& reg);
+
+          //! Builds all deferred symbolic expressions.
+          TRITON_EXPORT void materializeLazyFlags(void);
+
           //! Returns an unique symbolic expression id.
           TRITON_EXPORT triton::usize getUniqueSymExprId(void);
 
@@ -260,8 +366,15 @@ namespace triton {
           //! Assigns a symbolic expression to a memory.
           TRITON_EXPORT void assignSymbolicExpressionToMemory(const SharedSymbolicExpression& se, const triton::arch::MemoryAccess& mem);
 
-          //! Unrolls the SSA form of a given AST.
-          TRITON_EXPORT triton::ast::SharedAbstractNode unrollAst(const triton::ast::SharedAbstractNode& node);
+          /*!
+           * \brief Unrolls the SSA form of a given AST.
+           *
+           * \details The given AST is left untouched: the nodes which lead to a reference are
+           * duplicated and the other ones are shared. Each referenced expression is unrolled
+           * once. An exception is thrown if more than `maxDepth` nested references have to be
+           * followed or if more than `maxNodes` nodes have to be created (0 means no limit).
+           */
+          TRITON_EXPORT triton::ast::SharedAbstractNode unrollAst(const triton::ast::SharedAbstractNode& node, triton::usize maxDepth=0, triton::usize maxNodes=0);
 
           //! Slices all expressions from a given one.
           TRITON_EXPORT std::map<triton::usize, SharedSymbolicExpression> sliceExpressions(const SharedSymbolicExpression& expr);
@@ -275,7 +388,7 @@ namespace triton {
           //! Returns all symbolic variables.
           TRITON_EXPORT const std::unordered_map<triton::usize, SymbolicVariable*>& getSymbolicVariables(void) const;
 
-          //! Adds a symbolic memory reference.
+          //! Adds a symbolic memory reference (the low byte of the expression).
           TRITON_EXPORT void addMemoryReference(triton::uint64 mem, const SharedSymbolicExpression& expr);
 
           //! Concretizes all symbolic memory references.
@@ -296,6 +409,17 @@ namespace triton {
           //! Enables or disables the symbolic execution engine.
           TRITON_EXPORT void enable(bool flag);
 
+          /*!
+           * \brief Starts to journal the modifications of the engine.
+           *
+           * \details The IR builder uses the journal to leave the symbolic state untouched
+           * when the symbolic engine is disabled. A journal already started is dropped.
+           */
+          TRITON_EXPORT void startJournal(void);
+
+          //! Rolls back the modifications journaled since startJournal() and stops journaling.
+          TRITON_EXPORT void rollbackJournal(void);
+
           //! Returns true if the symbolic execution engine is enabled.
           TRITON_EXPORT bool isEnabled(void) const;
 
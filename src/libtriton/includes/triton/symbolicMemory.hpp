@@ -0,0 +1,164 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SYMBOLICMEMORY_H
+#define TRITON_SYMBOLICMEMORY_H
+
+#include <utility>
+#include <vector>
+
+#include <triton/dllexport.hpp>
+#include <triton/pageTable.hpp>
+#include <triton/symbolicExpression.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Symbolic Execution namespace
+    namespace symbolic {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup symbolic
+     *  @{
+     */
+
+      //! The size of a symbolic memory page (in bytes of memory).
+      const triton::usize SYMBOLIC_MEMORY_PAGE_SIZE = 0x100;
+
+      //! The number of bits used to index a byte inside a symbolic memory page.
+      const triton::uint32 SYMBOLIC_MEMORY_PAGE_SHIFT = 8;
+
+      /*! \brief A range of the symbolic memory.
+       *
+       * \details The `size` bytes of the range are the bytes `offset` to `offset + size - 1`
+       * (little endian) of the symbolic expression.
+       */
+      struct MemoryRange {
+        //! The size of the range in bytes.
+        triton::uint32 size;
+
+        //! The offset (in bytes) of the range into the expression.
+        triton::uint32 offset;
+
+        //! The symbolic expression.
+        SharedSymbolicExpression expr;
+      };
+
+      /*! \class SymbolicMemory
+       *  \brief This class is used to store the symbolic expressions of the memory.
+       *
+       *  \details The memory is split in pages of `SYMBOLIC_MEMORY_PAGE_SIZE` bytes. A store puts the
+       *  expression once in a slot of each page it touches and each byte only holds the id of its slot,
+       *  so a stored expression is kept as a whole and is only sliced when an access does not match it.
+       *  The consecutive bytes of a same expression (with consecutive offsets) form a range. Only the
+       *  pages which contain symbolic bytes are allocated.
+       */
+      class SymbolicMemory {
+        protected:
+          //! An expression stored in a page.
+          struct Slot {
+            //! The expression (nullptr if the slot is free).
+            SharedSymbolicExpression expr;
+
+            //! The offset (in bytes) into the expression of the byte 0 of the page (modulo 2^32), the id of the next free slot if the slot is free.
+            triton::uint32 offset;
+
+            //! The number of bytes of the page which hold this slot.
+            triton::uint32 count;
+          };
+
+          //! A symbolic memory page.
+          struct Page {
+            //! The slot ids of the bytes (the index of the slot plus one, 0 if the byte is concrete).
+            triton::uint16 bytes[SYMBOLIC_MEMORY_PAGE_SIZE];
+
+            //! The slots of the page.
+            std::vector<Slot> slots;
+
+            //! The id of the first free slot (0 if there is none).
+            triton::uint16 freeSlot;
+
+            //! The number of symbolic bytes.
+            triton::usize count;
+
+            //! Constructor.
+            Page();
+
+            //! Returns a slot holding `expr` where the byte 0 of the page is at `offset` into it and returns its id.
+            triton::uint16 allocate(const SharedSymbolicExpression& expr, triton::uint32 offset);
+
+            //! Releases a byte of a slot, the slot is freed with its last byte.
+            void release(triton::uint16 id);
+          };
+
+          //! The pages (page id -> page).
+          triton::utils::PageTable<Page, SYMBOLIC_MEMORY_PAGE_SHIFT> pages;
+
+          //! The number of symbolic bytes.
+          triton::usize numberOfBytes;
+
+          //! Appends the ranges of the bytes `[begin:end[` of a page to `ranges`.
+          void getPageRanges(triton::uint64 pageId, const Page& page, triton::usize begin, triton::usize end, std::vector<std::pair<triton::uint64, MemoryRange>>& ranges) const;
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT SymbolicMemory();
+
+          //! Removes all symbolic bytes.
+          TRITON_EXPORT void clear(void);
+
+          //! Returns true if there is no symbolic byte.
+          TRITON_EXPORT bool empty(void) const;
+
+          //! Returns the number of symbolic bytes.
+          TRITON_EXPORT triton::usize size(void) const;
+
+          //! Returns the number of allocated pages.
+          TRITON_EXPORT triton::usize getNumberOfPages(void) const;
+
+          //! Returns the expression of a byte (nullptr if the byte is concrete) and sets `offset` to the offset of the byte into it.
+          TRITON_EXPORT const SharedSymbolicExpression& get(triton::uint64 addr, triton::uint32& offset) const;
+
+          //! Returns true if at least one byte of the range `[addr:size]` is symbolic. Empty pages are skipped at once.
+          TRITON_EXPORT bool contains(triton::uint64 addr, triton::usize size) const;
+
+          //! Assigns `size` bytes of an expression (starting at its byte `offset`) to the range `[addr:size]`.
+          TRITON_EXPORT void assign(triton::uint64 addr, triton::uint32 size, const SharedSymbolicExpression& expr, triton::uint32 offset=0);
+
+          //! Removes the symbolic bytes of the range `[addr:size]`. Pages without symbolic bytes are released.
+          TRITON_EXPORT void remove(triton::uint64 addr, triton::usize size);
+
+          //! Returns the ranges of the symbolic bytes of `[addr:size]` (clipped to it) in ascending order of address.
+          TRITON_EXPORT std::vector<std::pair<triton::uint64, MemoryRange>> getRanges(triton::uint64 addr, triton::usize size) const;
+
+          //! Returns all ranges of symbolic bytes in ascending order of address.
+          TRITON_EXPORT std::vector<std::pair<triton::uint64, MemoryRange>> getRanges(void) const;
+      };
+
+    /*! @} End of symbolic namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SYMBOLICMEMORY_H */
@@ -8,11 +8,16 @@
 #ifndef TRITON_TAINTENGINE_H
 #define TRITON_TAINTENGINE_H
 
+#include <map>
 #include <set>
+#include <unordered_map>
+#include <vector>
 
 #include <triton/dllexport.hpp>
 #include <triton/memoryAccess.hpp>
+#include <triton/modes.hpp>
 #include <triton/register.hpp>
+#include <triton/shadowMemory.hpp>
 #include <triton/symbolicEngine.hpp>
 #include <triton/tritonTypes.hpp>
 
@@ -47,6 +52,12 @@ namespace triton {
       //! Defines an untainted item.
       const bool UNTAINTED = !TAINTED;
 
+      //! The maximum number of taint labels (a set of labels is a 64-bit mask).
+      const triton::uint32 MAX_TAINT_LABELS = 64;
+
+      //! The number of interned sets of labels from which the sets no longer held by the memory are released.
+      const triton::usize LABEL_SETS_COLLECTION_THRESHOLD = 4096;
+
       /*! \class TaintEngine
           \brief The taint engine class. */
       class TaintEngine {
@@ -56,25 +67,54 @@ namespace triton {
 
           //! Cpu use for this taint
           //
-          // note: Not really use for now but will be usefull to have a bits
-          // precision on registers tainting
-          //
           // FIXME: We should make sure it is the same as the one in symbolicEngine
           const triton::arch::CpuInterface& cpu;
 
+          //! Modes API
+          const triton::modes::Modes& modes;
+
         protected:
           //! Defines if the taint engine is enabled or disabled.
           bool enableFlag;
 
-          //! The set of tainted addresses.
-          std::set<triton::uint64> taintedMemory;
-
-          //! The set of tainted registers. Currently it is an over approximation of the taint.
-          std::set<triton::arch::registers_e> taintedRegisters;
+          //! The shadow memory of the tainted bytes.
+          triton::engines::taint::ShadowMemory taintedMemory;
+
+          /*! \brief The tainted bytes of the registers, indexed by parent register.
+           *
+           * \details The bit `i` of a mask is set if the byte `i` of the parent register is tainted.
+           * The bytes of a register are given by its high and low bits.
+           */
+          triton::uint64 taintedRegisters[triton::arch::ID_REG_LAST_ITEM];
+
+          /*! \brief map of parent register -> set of labels (TAINT_LABELS mode)
+           *
+           * \details A tainted register without entry has no label.
+           */
+          std::map<triton::arch::registers_e, triton::uint64> taintedRegisterLabels;
+
+          /*! \brief The interned sets of labels (id -> set of labels)
+           *
+           * \details The tainted bytes of the shadow memory only hold the id of their set of labels.
+           * The id 0 is the empty set.
+           */
+          std::vector<triton::uint64> labelSets;
+
+          //! map of set of labels -> id
+          std::unordered_map<triton::uint64, triton::uint32> labelSetIds;
+
+          //! The number of interned sets of labels from which the unused sets are released.
+          triton::usize labelSetsLimit;
+
+          /*! \brief The labels read or spread by the current instruction.
+           *
+           * \details They are given to the items tainted without explicit labels (e.g. the flags).
+           */
+          triton::uint64 spreadLabels;
 
         public:
           //! Constructor.
-          TRITON_EXPORT TaintEngine(triton::engines::symbolic::SymbolicEngine* symbolicEngine, const triton::arch::CpuInterface& cpu);
+          TRITON_EXPORT TaintEngine(triton::engines::symbolic::SymbolicEngine* symbolicEngine, const triton::arch::CpuInterface& cpu, const triton::modes::Modes& modes);
 
           //! Constructor by copy.
           TRITON_EXPORT TaintEngine(const TaintEngine& other);
@@ -86,7 +126,7 @@ namespace triton {
           TRITON_EXPORT void enable(bool flag);
 
           //! Returns the tainted addresses.
-          TRITON_EXPORT const std::set<triton::uint64>& getTaintedMemory(void) const;
+          TRITON_EXPORT const triton::engines::taint::ShadowMemory& getTaintedMemory(void) const;
 
           //! Returns the tainted registers.
           TRITON_EXPORT std::set<const triton::arch::Register*> getTaintedRegisters(void) const;
@@ -106,15 +146,27 @@ namespace triton {
           //! Abstract taint verification. Returns true if the operand is tainted.
           TRITON_EXPORT bool isTainted(const triton::arch::OperandWrapper& op) const;
 
-          //! Sets the flag (taint or untaint) to an abstract operand (Register or Memory).
+          //! Abstract taint verification of a source of the current instruction. Returns true if the operand is tainted, its labels are then spread by the instruction.
+          TRITON_EXPORT bool readTaint(const triton::arch::OperandWrapper& op);
+
+          //! Sets the flag (taint or untaint) to an abstract operand (Register or Memory). A tainted operand gets the labels spread by the current instruction.
           TRITON_EXPORT bool setTaint(const triton::arch::OperandWrapper& op, bool flag);
 
-          //! Sets the flag (taint or untaint) to a memory.
+          //! Sets the flag (taint or untaint) and the labels to an abstract operand (Register or Memory).
+          TRITON_EXPORT bool setTaint(const triton::arch::OperandWrapper& op, bool flag, triton::uint64 labels);
+
+          //! Sets the flag (taint or untaint) to a memory. A tainted memory gets the labels spread by the current instruction.
           TRITON_EXPORT bool setTaintMemory(const triton::arch::MemoryAccess& mem, bool flag);
 
-          //! Sets the flag (taint or untaint) to a register.
+          //! Sets the flag (taint or untaint) and the labels to a memory.
+          TRITON_EXPORT bool setTaintMemory(const triton::arch::MemoryAccess& mem, bool flag, triton::uint64 labels);
+
+          //! Sets the flag (taint or untaint) to a register. A tainted register gets the labels spread by the current instruction.
           TRITON_EXPORT bool setTaintRegister(const triton::arch::Register& reg, bool flag);
 
+          //! Sets the flag (taint or untaint) and the labels to a register.
+          TRITON_EXPORT bool setTaintRegister(const triton::arch::Register& reg, bool flag, triton::uint64 labels);
+
           //! Taints an address. Returns TAINTED if the address has been tainted correctly. Otherwise it returns the last defined state.
           TRITON_EXPORT bool taintMemory(triton::uint64 addr);
 
@@ -124,6 +176,24 @@ namespace triton {
           //! Taints a register. Returns TAINTED if the register has been tainted correctly. Otherwise it returns the last defined state.
           TRITON_EXPORT bool taintRegister(const triton::arch::Register& reg);
 
+          //! Taints a memory with a label (only recorded if the TAINT_LABELS mode is enabled). Returns TAINTED if the memory has been tainted correctly. Otherwise it returns the last defined state.
+          TRITON_EXPORT bool taintMemory(const triton::arch::MemoryAccess& mem, triton::uint32 label);
+
+          //! Taints a register with a label (only recorded if the TAINT_LABELS mode is enabled). Returns TAINTED if the register has been tainted correctly. Otherwise it returns the last defined state.
+          TRITON_EXPORT bool taintRegister(const triton::arch::Register& reg, triton::uint32 label);
+
+          //! Returns the set of labels of a memory (the union of the labels of its bytes), one bit per label.
+          TRITON_EXPORT triton::uint64 getTaintLabels(const triton::arch::MemoryAccess& mem) const;
+
+          //! Returns the set of labels of a register, one bit per label.
+          TRITON_EXPORT triton::uint64 getTaintLabels(const triton::arch::Register& reg) const;
+
+          //! Returns the set of labels of an abstract operand (Register or Memory), one bit per label.
+          TRITON_EXPORT triton::uint64 getTaintLabels(const triton::arch::OperandWrapper& op) const;
+
+          //! Forgets the labels spread by the previous instruction. Called before the semantics of each instruction.
+          TRITON_EXPORT void clearSpreadLabels(void);
+
           //! Untaints an address. Returns !TAINTED if the address has been untainted correctly. Otherwise it returns the last defined state.
           TRITON_EXPORT bool untaintMemory(triton::uint64 addr);
 
@@ -179,6 +249,39 @@ namespace triton {
           //! Copies a TaintEngine.
           void copy(const TaintEngine& other);
 
+          //! Returns true if the labels are tracked.
+          bool isLabelEnabled(void) const;
+
+          //! Returns the id of a set of labels, interns it if needed.
+          triton::uint32 getLabelSetId(triton::uint64 labels);
+
+          //! Releases the sets of labels which are no longer held by the memory and renumbers the others.
+          void collectLabelSets(void);
+
+          //! Returns the set of labels of the range `[addr:size]`.
+          triton::uint64 getMemoryLabels(triton::uint64 addr, triton::usize size) const;
+
+          //! Sets the labels of the tainted bytes of the range `[addr:size]`.
+          void setMemoryLabels(triton::uint64 addr, triton::usize size, triton::uint64 labels);
+
+          //! Adds labels to the tainted bytes of the range `[addr:size]`.
+          void addMemoryLabels(triton::uint64 addr, triton::usize size, triton::uint64 labels);
+
+          //! Sets the labels of a register.
+          void setRegisterLabels(const triton::arch::Register& reg, triton::uint64 labels);
+
+          //! Returns the tainted bytes of a register (the bit `i` is set if the byte `i` of the register is tainted).
+          triton::uint64 getRegisterBytes(const triton::arch::Register& reg) const;
+
+          //! Returns the tainted bytes of a memory (the bit `i` is set if the byte `i` of the memory is tainted).
+          triton::uint64 getMemoryBytes(const triton::arch::MemoryAccess& mem) const;
+
+          //! Writes the tainted bytes (in the parent register) of a register. A write of 32 bits or more clears the other bytes of the parent.
+          void writeRegister(const triton::arch::Register& reg, triton::uint64 bytes, triton::uint64 labels);
+
+          //! Sets the taint of the expressions stored in a memory. Each range of the memory is tainted if one of its bytes is.
+          void taintMemoryExpressions(const triton::arch::MemoryAccess& mem);
+
           //! Spreads MemoryImmediate with union.
           bool unionMemoryImmediate(const triton::arch::MemoryAccess& memDst);
 
@@ -8,6 +8,10 @@
 #ifndef TRITON_TRITONTOZ3AST_H
 #define TRITON_TRITONTOZ3AST_H
 
+#include <map>
+#include <string>
+#include <unordered_map>
+
 #include <z3++.h>
 
 #include <triton/ast.hpp>
@@ -33,7 +37,12 @@ namespace triton {
    */
 
     //! \class TritonToZ3Ast
-    /*! \brief Converts a Triton's AST to Z3's AST. */
+    /*! \brief Converts a Triton's AST to Z3's AST.
+     *
+     *  \details During a conversion, each node and each referenced symbolic expression
+     *  is converted once, so a DAG is converted in linear time. A persistent converter
+     *  also keeps the symbolic expressions converted between conversions.
+     */
     class TritonToZ3Ast {
       private:
         //! Symbolic Engine API
@@ -42,6 +51,9 @@ namespace triton {
         //! This flag define if the conversion is used to evaluated a node or not.
         bool isEval;
 
+        //! This flag defines if the symbolic expressions converted are kept between conversions.
+        bool isPersistent;
+
         //! The map of symbols. E.g: (let (symbols expr1) expr2)
         std::map<std::string, triton::ast::SharedAbstractNode> symbols;
 
@@ -51,13 +63,42 @@ namespace triton {
         //! Returns the integer of the z3 expression as a string.
         std::string getStringValue(const z3::expr& expr);
 
+        //! Converts a node, or returns its conversion if it is already converted.
+        z3::expr translate(const triton::ast::SharedAbstractNode& node);
+
+        //! Converts a node whose children are not converted yet.
+        z3::expr translateNode(const triton::ast::SharedAbstractNode& node);
+
       protected:
         //! The z3's context.
         z3::context context;
 
+      private:
+        //! The nodes converted during the current conversion. Declared after the context which must outlive them.
+        std::unordered_map<triton::ast::AbstractNode*, z3::expr> nodes;
+
+        /*! \brief The symbolic expressions converted during the current conversion (or since the creation of a persistent converter).
+         *
+         * \details
+         * **item1**: symbolic expression id<br>
+         * **item2**: <ast of the expression:z3 expression>. The ast is kept to detect an expression which changed since its conversion.
+         */
+        std::unordered_map<triton::usize, std::pair<triton::ast::SharedAbstractNode, z3::expr>> exprs;
+
       public:
-        //! Constructor.
-        TRITON_EXPORT TritonToZ3Ast(triton::engines::symbolic::SymbolicEngine* symbolicEngine, bool eval=true);
+        /*!
+         * \brief Constructor.
+         *
+         * \details A `persistent` converter keeps the symbolic expressions converted between conversions
+         * (the conversions must share the z3's context). It cannot be used to evaluate nodes.
+         */
+        TRITON_EXPORT TritonToZ3Ast(triton::engines::symbolic::SymbolicEngine* symbolicEngine, bool eval=true, bool persistent=false);
+
+        //! Returns the z3's context.
+        TRITON_EXPORT z3::context& getContext(void);
+
+        //! Returns the number of symbolic expressions kept by a persistent converter.
+        TRITON_EXPORT triton::usize getNumberOfConvertedExpressions(void) const;
 
         //! Converts to Z3's AST
         TRITON_EXPORT z3::expr convert(const triton::ast::SharedAbstractNode& node);
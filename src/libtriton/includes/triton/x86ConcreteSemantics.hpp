@@ -0,0 +1,165 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_X86CONCRETESEMANTICS_H
+#define TRITON_X86CONCRETESEMANTICS_H
+
+#include <vector>
+
+#include <triton/architecture.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/instruction.hpp>
+#include <triton/semanticsInterface.hpp>
+#include <triton/symbolicEngine.hpp>
+#include <triton/taintEngine.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Architecture namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    //! The x86 namespace
+    namespace x86 {
+    /*!
+     *  \ingroup arch
+     *  \addtogroup x86
+     *  @{
+     */
+
+      /*! \class x86ConcreteSemantics
+          \brief The x86 ISA concrete semantics.
+
+          \details This interpreter executes the most common x86 instructions with native integers.
+          It updates the concrete state of the architecture and spreads the taint exactly like
+          the x86Semantics class does, but it does not build any symbolic expression (only the
+          addresses of the memory operands are initialized by SymbolicEngine::initLeaAst()). The
+          IR builder uses it when the symbolic engine is disabled, other instructions still go
+          through the x86Semantics class. */
+      class x86ConcreteSemantics : public SemanticsInterface {
+        private:
+          //! Architecture API
+          triton::arch::Architecture* architecture;
+
+          //! Symbolic Engine API (only used to initialize the addresses of the memory operands)
+          triton::engines::symbolic::SymbolicEngine* symbolicEngine;
+
+          //! Taint Engine API
+          triton::engines::taint::TaintEngine* taintEngine;
+
+          //! True if the instruction being processed is tainted.
+          bool tainted;
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT x86ConcreteSemantics(triton::arch::Architecture* architecture,
+                                             triton::engines::symbolic::SymbolicEngine* symbolicEngine,
+                                             triton::engines::taint::TaintEngine* taintEngine);
+
+          //! Returns true if the instruction can be interpreted natively.
+          TRITON_EXPORT bool isSupported(const triton::arch::Instruction& inst) const;
+
+          //! Executes the instruction. Returns false (and does nothing) if the instruction is not supported.
+          TRITON_EXPORT bool buildSemantics(triton::arch::Instruction& inst);
+
+        private:
+          //! Returns true if the operand can be handled with native integers.
+          bool isSupported(const triton::arch::OperandWrapper& op) const;
+
+          //! Returns the concrete value of an operand.
+          triton::uint64 read(const triton::arch::OperandWrapper& op);
+
+          //! Returns the concrete value of a flag.
+          bool readFlag(triton::arch::registers_e flag);
+
+          //! Sets the concrete value of an operand. Sub-registers are merged into their parent.
+          void write(const triton::arch::OperandWrapper& op, triton::uint64 value);
+
+          //! Sets the concrete value of a flag and its taint.
+          void writeFlag(triton::arch::registers_e flag, bool value, bool taint);
+
+          //! Sets the concrete value of the program counter.
+          void writePc(triton::uint64 value);
+
+          //! Evaluates the condition of a Jcc, SETcc or CMOVcc instruction and returns the flags it reads.
+          bool condition(triton::uint32 type, std::vector<triton::arch::registers_e>& flags);
+
+          //! Aligns the stack (add). Returns the new stack value.
+          triton::uint64 alignAddStack(triton::uint32 delta);
+
+          //! Aligns the stack (sub). Returns the new stack value.
+          triton::uint64 alignSubStack(triton::uint32 delta);
+
+          //! Control flow semantics. Used to represent IP.
+          void controlFlow(triton::arch::Instruction& inst);
+
+          //! Sets the PF, SF and ZF flags according to a result.
+          void resultFlags(triton::uint64 result, triton::uint32 bitSize, bool taint);
+
+          //! The ADD, SUB, CMP, AND, OR, XOR and TEST semantics.
+          void binary(triton::arch::Instruction& inst);
+
+          //! The CMOVcc semantics.
+          void cmovcc(triton::arch::Instruction& inst);
+
+          //! The CALL semantics.
+          void call(triton::arch::Instruction& inst);
+
+          //! The Jcc semantics.
+          void jcc(triton::arch::Instruction& inst);
+
+          //! The JMP semantics.
+          void jmp(triton::arch::Instruction& inst);
+
+          //! The LEA semantics.
+          void lea(triton::arch::Instruction& inst);
+
+          //! The LEAVE semantics.
+          void leave(triton::arch::Instruction& inst);
+
+          //! The MOV, MOVABS, MOVSX, MOVSXD and MOVZX semantics.
+          void mov(triton::arch::Instruction& inst);
+
+          //! The POP semantics.
+          void pop(triton::arch::Instruction& inst);
+
+          //! The PUSH semantics.
+          void push(triton::arch::Instruction& inst);
+
+          //! The RET semantics.
+          void ret(triton::arch::Instruction& inst);
+
+          //! The SETcc semantics.
+          void setcc(triton::arch::Instruction& inst);
+
+          //! The SHL, SAL, SHR and SAR semantics.
+          void shift(triton::arch::Instruction& inst);
+
+          //! The INC, DEC, NEG and NOT semantics.
+          void unary(triton::arch::Instruction& inst);
+      };
+
+    /*! @} End of x86 namespace */
+    };
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_X86CONCRETESEMANTICS_H */
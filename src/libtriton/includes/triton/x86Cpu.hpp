@@ -15,8 +15,10 @@
 #include <triton/callbacks.hpp>
 #include <triton/cpuInterface.hpp>
 #include <triton/dllexport.hpp>
+#include <triton/externalLibs.hpp>
 #include <triton/instruction.hpp>
 #include <triton/memoryAccess.hpp>
+#include <triton/pagedMemory.hpp>
 #include <triton/register.hpp>
 #include <triton/registers_e.hpp>
 #include <triton/tritonTypes.hpp>
@@ -57,17 +59,24 @@ namespace triton {
           //! Callbacks API
           triton::callbacks::Callbacks* callbacks;
 
+          //! Capstone context. Opened on the first disassembly and owned by the CPU.
+          mutable triton::extlibs::capstone::csh handle;
+
+          //! Capstone instruction buffer reused by each disassembly.
+          mutable triton::extlibs::capstone::cs_insn* insn;
+
+          //! Opens the Capstone context if it is not already opened.
+          void disassInit(void) const;
+
+          //! Releases the Capstone context.
+          void disassRelease(void);
+
           //! Copies a x86Cpu class.
           void copy(const x86Cpu& other);
 
         protected:
-          /*! \brief map of address -> concrete value
-           *
-           * \details
-           * **item1**: memory address<br>
-           * **item2**: concrete value
-           */
-          std::map<triton::uint64, triton::uint8> memory;
+          //! The concrete memory (paged).
+          triton::arch::PagedMemory memory;
 
           //! Concrete value of eax
           triton::uint8 eax[DWORD_SIZE];
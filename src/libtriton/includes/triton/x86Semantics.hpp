@@ -75,6 +75,13 @@ namespace triton {
           //! Clears a flag.
           void clearFlag_s(triton::arch::Instruction& inst, const triton::arch::Register& flag, std::string comment="");
 
+          //! Creates the symbolic expression of a flag and spreads the taint from the parent. The AST is built on demand in the `LAZY_FLAGS` mode.
+          void flag_s(triton::arch::Instruction& inst,
+                      const triton::engines::symbolic::SharedSymbolicExpression& parent,
+                      const triton::arch::Register& flag,
+                      const triton::engines::symbolic::LazyFlagBuilder& builder,
+                      const std::string& comment);
+
           //! Sets a flag.
           void setFlag_s(triton::arch::Instruction& inst, const triton::arch::Register& flag, std::string comment="");
 
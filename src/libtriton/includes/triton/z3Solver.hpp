@@ -11,9 +11,13 @@
 #include <list>
 #include <map>
 #include <string>
+#include <vector>
 
 #include <triton/ast.hpp>
+#include <triton/constraintPartitioner.hpp>
 #include <triton/dllexport.hpp>
+#include <triton/modelCache.hpp>
+#include <triton/solverCache.hpp>
 #include <triton/solverInterface.hpp>
 #include <triton/solverModel.hpp>
 #include <triton/symbolicEngine.hpp>
@@ -43,12 +47,46 @@ namespace triton {
      */
 
       //! \class Z3Solver
-      /*! \brief Solver engine using z3. */
+      /*! \brief Solver engine using z3.
+       *
+       * \details Each query of getModel(), getModels() and isSat() is converted and solved in a new
+       * z3's context. An incremental session keeps one context and one solver alive between queries:
+       * the symbolic expressions are converted once and the constraints pushed in the session (e.g.
+       * the prefix of a path) are asserted once for all the queries of the session. When the cache is
+       * enabled (see getCache()), the answers of getModel(), getModels() and isSat() are reused for the
+       * constraints already solved. When the model cache is enabled (see getModelCache()), getModel() and
+       * isSat() first try the models already found before calling z3. When the partitioning is enabled (see
+       * getPartitioner()), getModel() and isSat() only solve the constraints relevant to the query.
+       */
       class Z3Solver : public SolverInterface {
         private:
+          //! An incremental solving session.
+          struct Session;
+
           //! Symbolic Engine API
           triton::engines::symbolic::SymbolicEngine* symbolicEngine;
 
+          //! The incremental solving session (nullptr if not started).
+          Session* session;
+
+          //! The cache of the queries. \sa SolverCache.
+          mutable SolverCache cache;
+
+          //! The models found, reused for the next queries. \sa ModelCache.
+          mutable ModelCache modelCache;
+
+          //! The partitioner of the queries. \sa ConstraintPartitioner.
+          mutable ConstraintPartitioner partitioner;
+
+          //! Returns the session, raises an exception if it is not started.
+          Session& getSession(const char* caller) const;
+
+          //! Solves a logical node already checked by getModels(), through the caches.
+          std::list<std::map<triton::uint32, SolverModel>> solveModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit) const;
+
+          //! Solves a logical node already checked by isSat(), through the caches.
+          bool solveSat(const triton::ast::SharedAbstractNode& node) const;
+
         public:
           //! Constructor.
           TRITON_EXPORT Z3Solver(triton::engines::symbolic::SymbolicEngine* symbolicEngine);
@@ -56,6 +94,9 @@ namespace triton {
           //! Constructor by copy.
           TRITON_EXPORT Z3Solver(const Z3Solver& other);
 
+          //! Destructor.
+          TRITON_EXPORT ~Z3Solver();
+
           //! Operator.
           TRITON_EXPORT Z3Solver& operator=(const Z3Solver& other);
 
@@ -82,6 +123,64 @@ namespace triton {
 
           //! Returns the name of this solver.
           TRITON_EXPORT std::string getName(void) const;
+
+          //! Returns the cache of the queries answered by getModel(), getModels() and isSat().
+          TRITON_EXPORT SolverCache& getCache(void);
+
+          //! Returns the cache of the queries answered by getModel(), getModels() and isSat().
+          TRITON_EXPORT const SolverCache& getCache(void) const;
+
+          //! Returns the cache of the models reused by getModel() and isSat().
+          TRITON_EXPORT ModelCache& getModelCache(void);
+
+          //! Returns the cache of the models reused by getModel() and isSat().
+          TRITON_EXPORT const ModelCache& getModelCache(void) const;
+
+          //! Returns the partitioner of the constraints sent to the solver by getModel() and isSat().
+          TRITON_EXPORT ConstraintPartitioner& getPartitioner(void);
+
+          //! Returns the partitioner of the constraints sent to the solver by getModel() and isSat().
+          TRITON_EXPORT const ConstraintPartitioner& getPartitioner(void) const;
+
+          //! Starts an incremental solving session. A session already started is restarted.
+          TRITON_EXPORT void startSession(void);
+
+          //! Stops the incremental solving session.
+          TRITON_EXPORT void stopSession(void);
+
+          //! Returns true if an incremental solving session is started.
+          TRITON_EXPORT bool isSessionStarted(void) const;
+
+          //! Asserts a constraint in the session until it is popped.
+          TRITON_EXPORT void pushSessionConstraint(const triton::ast::SharedAbstractNode& node);
+
+          //! Removes the `count` last constraints pushed in the session.
+          TRITON_EXPORT void popSessionConstraints(triton::usize count=1);
+
+          //! Returns the number of constraints pushed in the session.
+          TRITON_EXPORT triton::usize getNumberOfSessionConstraints(void) const;
+
+          //! Computes and returns a model of the constraints of the session and `node` (which is not kept).
+          /*! \brief map of symbolic variable id -> model
+           *
+           * \details
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           */
+          TRITON_EXPORT std::map<triton::uint32, SolverModel> getSessionModel(const triton::ast::SharedAbstractNode& node);
+
+          //! Returns true if the constraints of the session and `node` (which is not kept) are satisfiable.
+          TRITON_EXPORT bool isSessionSat(const triton::ast::SharedAbstractNode& node);
+
+          /*!
+           * \brief Solves each branch which has not been taken along a path: the conjunction of the taken
+           * branches before it and of its constraint.
+           *
+           * \details The path is walked once with a dedicated incremental session (the session started
+           * by startSession() is not modified). If `dedup` is true, a branch is solved only once per
+           * (srcAddr, dstAddr). The `timeout` is the time budget (in milliseconds) of each query, 0 for no limit.
+           */
+          TRITON_EXPORT std::vector<BranchSolution> solveBranches(const std::vector<triton::engines::symbolic::PathConstraint>& pathConstraints, bool dedup, triton::uint32 timeout) const;
       };
 
     /*! @} End of solver namespace */
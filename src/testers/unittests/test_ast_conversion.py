@@ -261,6 +261,18 @@ class TestAstConversion(unittest.TestCase):
             self.assertEqual(n.evaluate(), self.Triton.evaluateAstViaZ3(n))
             self.assertEqual(n.evaluate(), self.Triton.simplify(n, True).evaluate())
 
+    def test_shared_references(self):
+        # Each expression references the previous one twice, the tree form
+        # of the constraint has 2^64 leaves.
+        self.Triton.setConcreteVariableValue(self.sv1, 0x41)
+        exp = self.Triton.newSymbolicExpression(self.v1)
+        for i in xrange(64):
+            ref = self.astCtxt.reference(exp)
+            exp = self.Triton.newSymbolicExpression(ref + (ref ^ i))
+
+        n = self.astCtxt.reference(exp)
+        self.assertEqual(n.evaluate(), self.Triton.evaluateAstViaZ3(n))
+
     def test_fuzz(self):
         """
         Fuzz test an ast evaluation.
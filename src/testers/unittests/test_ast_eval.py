@@ -812,3 +812,39 @@ class TestAstEval(unittest.TestCase):
         self.Triton.setConcreteVariableValue(self.sv1, 10)
         trv = final_node.evaluate()
         self.assertEqual(trv, 12)
+
+    def test_native_boundaries(self):
+        """Check nodes around the 64 bits boundary of the native evaluation."""
+        int64min = self.astCtxt.bv(0x8000000000000000, 64)
+        minus1 = self.astCtxt.bv(0xffffffffffffffff, 64)
+        wide = self.astCtxt.bv(0x112233445566778899aabbccddeeff00, 128)
+        tests = [
+            self.astCtxt.bvsdiv(int64min, minus1),
+            self.astCtxt.bvsrem(int64min, minus1),
+            self.astCtxt.bvsmod(int64min, minus1),
+            self.astCtxt.bvsmod(self.astCtxt.bv(1, 64), int64min),
+            self.astCtxt.bvsmod(minus1, int64min),
+            self.astCtxt.bvashr(int64min, self.astCtxt.bv(63, 64)),
+            self.astCtxt.bvashr(int64min, self.astCtxt.bv(64, 64)),
+            self.astCtxt.bvashr(int64min, self.astCtxt.bv(0x100000000, 64)),
+            self.astCtxt.bvlshr(minus1, self.astCtxt.bv(64, 64)),
+            self.astCtxt.bvshl(minus1, self.astCtxt.bv(64, 64)),
+            self.astCtxt.bvshl(minus1, self.astCtxt.bv(0x100000040, 64)),
+            self.astCtxt.bvrol(0, int64min),
+            self.astCtxt.bvrol(64, int64min),
+            self.astCtxt.bvror(1, int64min),
+            self.astCtxt.bvneg(int64min),
+            self.astCtxt.bvmul(minus1, minus1),
+            self.astCtxt.bvudiv(minus1, self.astCtxt.bv(0, 64)),
+            self.astCtxt.extract(71, 8, wide),
+            self.astCtxt.extract(127, 64, wide),
+            self.astCtxt.extract(63, 0, self.astCtxt.bvadd(wide, wide)),
+            self.astCtxt.concat([minus1, int64min]),
+            self.astCtxt.concat([self.astCtxt.bv(0x1234, 16), self.astCtxt.bv(0x56789abc, 32), self.astCtxt.bv(0xde, 8)]),
+            self.astCtxt.sx(64, int64min),
+            self.astCtxt.sx(32, self.astCtxt.bv(0x80000000, 32)),
+            self.astCtxt.zx(64, minus1),
+            self.astCtxt.ite(self.astCtxt.bvult(wide, self.astCtxt.bvnot(wide)), int64min, minus1),
+            self.astCtxt.ite(self.astCtxt.bvslt(int64min, minus1), wide, self.astCtxt.bvnot(wide)),
+        ]
+        self.check_ast(tests)
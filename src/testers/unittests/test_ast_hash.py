@@ -0,0 +1,104 @@
+#!/usr/bin/env python2
+# coding: utf-8
+"""Test AST hash."""
+
+import unittest
+
+from triton import TritonContext, ARCH
+
+
+class TestAstHash(unittest.TestCase):
+
+    """Testing the AST hash."""
+
+    def setUp(self):
+        """Define the arch."""
+        self.Triton = TritonContext()
+        self.Triton.setArchitecture(ARCH.X86_64)
+        self.astCtxt = self.Triton.getAstContext()
+
+        self.v1 = self.astCtxt.variable(self.Triton.newSymbolicVariable(8))
+        self.v2 = self.astCtxt.variable(self.Triton.newSymbolicVariable(8))
+
+    def test_same_tree(self):
+        """Check two trees with the same structure have the same hash."""
+        a = (self.v1 + self.v2) * self.astCtxt.bv(2, 8)
+        b = (self.v1 + self.v2) * self.astCtxt.bv(2, 8)
+        self.assertEqual(a.getHash(), b.getHash())
+        self.assertEqual(a, b)
+
+    def test_different_tree(self):
+        """Check two trees with a different structure have a different hash."""
+        a = (self.v1 - self.v2)
+        b = (self.v2 - self.v1)
+        self.assertNotEqual(a.getHash(), b.getHash())
+
+    def test_depth_independent(self):
+        """Check the hash of a sub-tree does not depend on where it is used."""
+        sub = self.v1 ^ self.v2
+        h = sub.getHash()
+        self.astCtxt.bvnot(self.astCtxt.bvnot(sub))
+        self.assertEqual(sub.getHash(), h)
+        self.assertEqual((self.v1 ^ self.v2).getHash(), h)
+
+    def test_set_child(self):
+        """Check setChild refreshes the hash of the node and of its parents."""
+        node = self.v1 + self.v2
+        root = self.astCtxt.bvnot(node)
+        h1 = node.getHash()
+        h2 = root.getHash()
+
+        node.setChild(1, self.v1)
+        self.assertNotEqual(node.getHash(), h1)
+        self.assertNotEqual(root.getHash(), h2)
+        self.assertEqual(node.getHash(), (self.v1 + self.v1).getHash())
+        self.assertEqual(root.getHash(), self.astCtxt.bvnot(self.v1 + self.v1).getHash())
+
+
+class TestAstHashConsing(unittest.TestCase):
+
+    """Testing the hash-consing of AST nodes."""
+
+    def setUp(self):
+        """Define the arch and enable the hash-consing."""
+        self.Triton = TritonContext()
+        self.Triton.setArchitecture(ARCH.X86_64)
+        self.astCtxt = self.Triton.getAstContext()
+        self.astCtxt.enableHashConsing(True)
+
+        self.v1 = self.astCtxt.variable(self.Triton.newSymbolicVariable(8))
+        self.v2 = self.astCtxt.variable(self.Triton.newSymbolicVariable(8))
+
+    def test_enable(self):
+        """Check the hash-consing can be enabled and disabled."""
+        self.assertTrue(self.astCtxt.isHashConsingEnabled())
+        self.astCtxt.enableHashConsing(False)
+        self.assertFalse(self.astCtxt.isHashConsingEnabled())
+
+    def test_sharing(self):
+        """Check identical nodes are shared."""
+        a = self.astCtxt.extract(3, 0, self.v1 + self.v2)
+        b = self.astCtxt.extract(3, 0, self.v1 + self.v2)
+        a.setChild(2, self.v1)
+        self.assertEqual(str(b), "((_ extract 3 0) SymVar_0)")
+
+    def test_no_sharing(self):
+        """Check different nodes are not shared."""
+        a = self.astCtxt.extract(3, 0, self.v1 + self.v2)
+        b = self.astCtxt.extract(4, 0, self.v1 + self.v2)
+        c = self.astCtxt.extract(3, 0, self.v2 + self.v1)
+        a.setChild(2, self.v1)
+        self.assertEqual(str(b), "((_ extract 4 0) (bvadd SymVar_0 SymVar_1))")
+        self.assertEqual(str(c), "((_ extract 3 0) (bvadd SymVar_1 SymVar_0))")
+
+    def test_disabled(self):
+        """Check nodes are not shared when the hash-consing is disabled."""
+        self.astCtxt.enableHashConsing(False)
+        a = self.v1 + self.v2
+        b = self.v1 + self.v2
+        a.setChild(1, self.v1)
+        self.assertEqual(str(b), "(bvadd SymVar_0 SymVar_1)")
+
+
+if __name__ == '__main__':
+    unittest.main()
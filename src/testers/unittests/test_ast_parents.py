@@ -0,0 +1,59 @@
+#!/usr/bin/env python2
+# coding: utf-8
+"""Test AST parents."""
+
+import unittest
+
+from triton import TritonContext, ARCH
+
+
+class TestAstParents(unittest.TestCase):
+
+    """Testing the parents of AST nodes."""
+
+    def setUp(self):
+        """Define the arch."""
+        self.Triton = TritonContext()
+        self.Triton.setArchitecture(ARCH.X86_64)
+        self.astCtxt = self.Triton.getAstContext()
+
+        self.v1 = self.astCtxt.variable(self.Triton.newSymbolicVariable(8))
+        self.v2 = self.astCtxt.variable(self.Triton.newSymbolicVariable(8))
+
+    def test_parents(self):
+        """Check parents are listed once, even after several re-init."""
+        n1 = self.v1 + self.v2
+        n2 = self.v1 ^ self.v2
+        for _ in range(20):
+            n1.setChild(1, self.v2)
+        self.assertEqual(len(self.v1.getParents()), 2)
+        self.assertEqual(len(self.v2.getParents()), 2)
+
+    def test_expired_parents(self):
+        """Check released parents are not listed."""
+        keep = [self.v1 + self.astCtxt.bv(i, 8) for i in range(32)]
+        for i in range(32):
+            self.v1 - self.astCtxt.bv(i, 8)
+        self.assertEqual(len(self.v1.getParents()), 32)
+        del keep
+        self.assertEqual(len(self.v1.getParents()), 0)
+
+    def test_set_child(self):
+        """Check setChild moves the parent from the old child to the new one."""
+        v3 = self.astCtxt.variable(self.Triton.newSymbolicVariable(8))
+        node = self.v1 + self.v2
+        node.setChild(1, v3)
+        self.assertEqual(len(self.v2.getParents()), 0)
+        self.assertEqual(len(v3.getParents()), 1)
+        self.assertEqual(node.evaluate(), 0)
+
+    def test_update(self):
+        """Check a new concrete value is spread to the parents."""
+        node = (self.v1 + self.v2) * self.astCtxt.bv(2, 8)
+        self.Triton.setConcreteVariableValue(self.Triton.getSymbolicVariableFromId(0), 3)
+        self.Triton.setConcreteVariableValue(self.Triton.getSymbolicVariableFromId(1), 4)
+        self.assertEqual(node.evaluate(), 14)
+
+
+if __name__ == '__main__':
+    unittest.main()
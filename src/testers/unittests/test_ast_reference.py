@@ -53,3 +53,37 @@ class TestAstReference(unittest.TestCase):
         exp1 = self.Triton.newSymbolicExpression(self.astCtxt.reference(self.Triton.getSymbolicExpressionFromId(0)), "exp1")
         exp2 = self.Triton.newSymbolicExpression(self.astCtxt.reference(self.Triton.getSymbolicExpressionFromId(1)), "exp2")
         self.assertEqual(str(self.Triton.unrollAst(exp2.getAst())), "SymVar_0")
+
+    def test_unroll_keeps_ssa(self):
+        v0   = self.astCtxt.variable(self.Triton.newSymbolicVariable(8))
+        exp0 = self.Triton.newSymbolicExpression(v0 + 1, "exp0")
+        node = self.astCtxt.reference(exp0) * 3
+        self.assertEqual(str(self.Triton.unrollAst(node)), "(bvmul (bvadd SymVar_0 (_ bv1 8)) (_ bv3 8))")
+        self.assertEqual(str(node), "(bvmul ref!0 (_ bv3 8))")
+
+    def test_unroll_shared_dag(self):
+        # Each expression references the previous one twice: a tree-like
+        # unrolling would create 2^64 nodes.
+        var = self.Triton.newSymbolicVariable(8)
+        v0  = self.astCtxt.variable(var)
+        self.Triton.setConcreteVariableValue(var, 0x41)
+        exp = self.Triton.newSymbolicExpression(v0, "exp0")
+        for i in range(64):
+            ref = self.astCtxt.reference(exp)
+            exp = self.Triton.newSymbolicExpression(ref ^ (ref + 1), "exp%d" % (i + 1))
+
+        node = self.Triton.unrollAst(exp.getAst())
+        self.assertEqual(node.evaluate(), exp.getAst().evaluate())
+        self.assertEqual(str(exp.getAst()).count("ref!"), 2)
+
+    def test_unroll_budget(self):
+        v0  = self.astCtxt.variable(self.Triton.newSymbolicVariable(8))
+        exp = self.Triton.newSymbolicExpression(v0, "exp0")
+        for i in range(10):
+            exp = self.Triton.newSymbolicExpression(self.astCtxt.reference(exp) + 1, "exp%d" % (i + 1))
+
+        self.assertEqual(self.Triton.unrollAst(exp.getAst(), 10, 10).evaluate(), 10)
+        with self.assertRaises(TypeError):
+            self.Triton.unrollAst(exp.getAst(), 5)
+        with self.assertRaises(TypeError):
+            self.Triton.unrollAst(exp.getAst(), 0, 5)
@@ -176,3 +176,19 @@ class TestX8664ConcreteMemoryValue(unittest.TestCase):
         self.Triton.setConcreteMemoryAreaValue(0x1000, "\x11\x22\x33\x44\x55\x66")
         self.Triton.setConcreteMemoryAreaValue(0x1006, [0x77, 0x88, 0x99, 0xaa, 0xbb, 0xcc])
         self.assertEqual(self.Triton.getConcreteMemoryAreaValue(0x1000, 12), "\x11\x22\x33\x44\x55\x66\x77\x88\x99\xaa\xbb\xcc")
+
+    def test_set_get_concrete_value_cross_pages(self):
+        base = 0x2ffe
+        size = 0x2004
+
+        self.Triton.setConcreteMemoryAreaValue(base, "\x41" * size)
+        self.assertTrue(self.Triton.isMemoryMapped(base, size))
+        self.assertFalse(self.Triton.isMemoryMapped(base - 1, size))
+        self.assertEqual(self.Triton.getConcreteMemoryAreaValue(base - 1, 4), "\x00\x41\x41\x41")
+
+        self.Triton.unmapMemory(0x2fff, 2)
+        self.assertTrue(self.Triton.isMemoryMapped(0x2ffe))
+        self.assertFalse(self.Triton.isMemoryMapped(0x2fff))
+        self.assertFalse(self.Triton.isMemoryMapped(0x3000))
+        self.assertTrue(self.Triton.isMemoryMapped(0x3001, size - 3))
+        self.assertEqual(self.Triton.getConcreteMemoryAreaValue(0x2ffe, 4), "\x41\x00\x00\x41")
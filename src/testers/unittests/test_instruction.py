@@ -217,3 +217,56 @@ class TestProcessing(unittest.TestCase):
         self.Triton.setArchitecture(ARCH.X86_64)
         inst = Instruction("\x00\xDC")  # add ah,bl
         self.Triton.processing(inst)
+
+
+class TestDecodeCache(unittest.TestCase):
+
+    """Testing the cache of decoded instructions."""
+
+    def setUp(self):
+        """Define the arch and enable the cache."""
+        self.Triton = TritonContext()
+        self.Triton.setArchitecture(ARCH.X86_64)
+        self.Triton.enableDecodeCache(True)
+
+    def test_enable(self):
+        """Check the cache can be enabled and disabled."""
+        self.assertTrue(self.Triton.isDecodeCacheEnabled())
+        self.Triton.enableDecodeCache(False)
+        self.assertFalse(self.Triton.isDecodeCacheEnabled())
+        self.assertEqual(self.Triton.getDecodeCacheStats(), {'size': 0, 'hits': 0, 'misses': 0})
+
+    def test_hit(self):
+        """Check an instruction decoded twice at the same address hits the cache."""
+        for _ in range(2):
+            inst = Instruction("\x48\x01\xd8")  # add rax, rbx
+            inst.setAddress(0x400000)
+            self.Triton.processing(inst)
+            self.assertEqual(inst.getDisassembly(), "add rax, rbx")
+            self.assertEqual(len(inst.getOperands()), 2)
+        self.assertEqual(self.Triton.getDecodeCacheStats(), {'size': 1, 'hits': 1, 'misses': 1})
+
+    def test_opcode_mismatch(self):
+        """Check other opcodes at the same address are decoded again."""
+        inst = Instruction("\x48\x01\xd8")  # add rax, rbx
+        inst.setAddress(0x400000)
+        self.Triton.processing(inst)
+
+        inst = Instruction("\x48\x29\xd8")  # sub rax, rbx
+        inst.setAddress(0x400000)
+        self.Triton.processing(inst)
+        self.assertEqual(inst.getDisassembly(), "sub rax, rbx")
+        self.assertEqual(self.Triton.getDecodeCacheStats()['hits'], 0)
+
+    def test_invalidation(self):
+        """Check a concrete write over a cached instruction drops it."""
+        inst = Instruction("\x48\x01\xd8")  # add rax, rbx
+        inst.setAddress(0x400000)
+        self.Triton.processing(inst)
+        self.assertEqual(self.Triton.getDecodeCacheStats()['size'], 1)
+
+        self.Triton.setConcreteMemoryValue(0x400003, 0x90)
+        self.assertEqual(self.Triton.getDecodeCacheStats()['size'], 1)
+
+        self.Triton.setConcreteMemoryValue(0x400002, 0x90)
+        self.assertEqual(self.Triton.getDecodeCacheStats()['size'], 0)
@@ -0,0 +1,103 @@
+#!/usr/bin/env python2
+# coding: utf-8
+"""Test LAZY_FLAGS."""
+
+import unittest
+
+from triton import ARCH, MODE, TritonContext, Instruction
+
+
+CODE = [
+    (0x400000, "\x48\x01\xd8"),     # add  rax, rbx
+    (0x400003, "\x48\x11\xcf"),     # adc  rdi, rcx
+    (0x400006, "\x48\x31\xd8"),     # xor  rax, rbx
+    (0x400009, "\x49\x29\xc0"),     # sub  r8, rax
+    (0x40000c, "\x48\xc1\xe0\x05"), # shl  rax, 5
+    (0x400010, "\x48\x39\xcb"),     # cmp  rbx, rcx
+    (0x400013, "\x41\x0f\x92\xc1"), # setb r9b
+    (0x400017, "\x48\xff\xca"),     # dec  rdx
+    (0x40001a, "\x75\xe4"),         # jne  0x400000
+]
+
+FLAGS = ['af', 'cf', 'of', 'pf', 'sf', 'zf']
+
+
+class TestLazyFlagsMode(unittest.TestCase):
+
+    """Testing the LAZY_FLAGS mode."""
+
+    def emulate(self, lazy):
+        ctx = TritonContext()
+        ctx.setArchitecture(ARCH.X86_64)
+        ctx.enableMode(MODE.LAZY_FLAGS, lazy)
+
+        ctx.setConcreteRegisterValue(ctx.registers.rbx, 0x1234)
+        ctx.setConcreteRegisterValue(ctx.registers.rcx, 0xffffffffffffffff)
+        ctx.setConcreteRegisterValue(ctx.registers.rdx, 4)
+        ctx.convertRegisterToSymbolicVariable(ctx.registers.rbx)
+        ctx.convertRegisterToSymbolicVariable(ctx.registers.rdx)
+
+        for _ in range(4):
+            for addr, opcode in CODE:
+                inst = Instruction(opcode)
+                inst.setAddress(addr)
+                self.assertTrue(ctx.processing(inst))
+
+        return ctx
+
+    def test_same_results(self):
+        """Check that the lazy mode computes the same state as the eager one."""
+        eager = self.emulate(False)
+        lazy  = self.emulate(True)
+
+        for reg in FLAGS + ['rax', 'rdi', 'r8', 'r9', 'rdx', 'rip']:
+            r1 = getattr(eager.registers, reg)
+            r2 = getattr(lazy.registers, reg)
+            self.assertEqual(eager.getConcreteRegisterValue(r1), lazy.getConcreteRegisterValue(r2))
+            self.assertEqual(eager.getSymbolicRegisterValue(r1), lazy.getSymbolicRegisterValue(r2))
+            self.assertEqual(eager.isRegisterSymbolized(r1), lazy.isRegisterSymbolized(r2))
+
+        pc1 = eager.getPathConstraints()
+        pc2 = lazy.getPathConstraints()
+        self.assertEqual(len(pc1), len(pc2))
+        for c1, c2 in zip(pc1, pc2):
+            self.assertEqual(c1.getTakenAddress(), c2.getTakenAddress())
+            self.assertEqual(c1.getTakenPathConstraintAst().evaluate(), c2.getTakenPathConstraintAst().evaluate())
+
+        # The model of the last branch must be the same
+        m1 = eager.getModel(eager.getAstContext().lnot(pc1[-1].getTakenPathConstraintAst()))
+        m2 = lazy.getModel(lazy.getAstContext().lnot(pc2[-1].getTakenPathConstraintAst()))
+        self.assertEqual(sorted((k, v.getValue()) for k, v in m1.items()), sorted((k, v.getValue()) for k, v in m2.items()))
+
+    def test_deferred(self):
+        """Check that the flags are only built when they are read."""
+        ctx = TritonContext()
+        ctx.setArchitecture(ARCH.X86_64)
+        ctx.enableMode(MODE.LAZY_FLAGS, True)
+        ctx.convertRegisterToSymbolicVariable(ctx.registers.rax)
+
+        inst = Instruction("\x48\x01\xd8") # add rax, rbx
+        self.assertTrue(ctx.processing(inst))
+
+        # Only rax and rip are linked to the instruction
+        self.assertEqual(len(inst.getSymbolicExpressions()), 2)
+
+        # The zero flag is built when it is read
+        self.assertTrue(ctx.isRegisterSymbolized(ctx.registers.zf))
+        self.assertEqual(ctx.getSymbolicRegister(ctx.registers.zf).getComment(), "Zero flag")
+
+        # A concrete value given by the user is not overwritten by a deferred flag
+        self.assertTrue(ctx.processing(inst))
+        ctx.setConcreteRegisterValue(ctx.registers.cf, 1)
+        self.assertEqual(ctx.getConcreteRegisterValue(ctx.registers.cf), 1)
+
+    def test_disabled_engine(self):
+        """Check that the flags are still computed when only the taint engine is used."""
+        ctx = TritonContext()
+        ctx.setArchitecture(ARCH.X86_64)
+        ctx.enableMode(MODE.LAZY_FLAGS, True)
+        ctx.enableSymbolicEngine(False)
+
+        inst = Instruction("\x48\x31\xc0") # xor rax, rax
+        self.assertTrue(ctx.processing(inst))
+        self.assertEqual(ctx.getConcreteRegisterValue(ctx.registers.zf), 1)
@@ -95,6 +95,36 @@ class TestIR(unittest.TestCase):
         return
 
 
+class TestIRConcrete(TestIR):
+
+    """Test the concrete interpreter used when the symbolic engine is disabled."""
+
+    def run_ir(self, symbolic):
+        """Emulate the ir test suite with a tainted stack and return the final state."""
+        self.Triton = TritonContext()
+        self.Triton.setArchitecture(ARCH.X86_64)
+        self.Triton.enableSymbolicEngine(symbolic)
+
+        binary_file = os.path.join(os.path.dirname(__file__), "misc", "ir-test-suite.bin")
+        self.load_binary(binary_file)
+
+        self.Triton.setConcreteRegisterValue(self.Triton.registers.rbp, 0x7fffffff)
+        self.Triton.setConcreteRegisterValue(self.Triton.registers.rsp, 0x6fffffff)
+        self.Triton.taintRegister(self.Triton.registers.rbp)
+
+        self.emulate(0x40065c)
+
+        regs = [(r.getName(), self.Triton.getConcreteRegisterValue(r), self.Triton.isRegisterTainted(r))
+                for r in self.Triton.getParentRegisters()]
+        mems = [(m, self.Triton.getConcreteMemoryValue(m), self.Triton.isMemoryTainted(m))
+                for m in range(0x6ffff000, 0x70000000)]
+        return regs, mems
+
+    def test_ir(self):
+        """Check that both engines compute the same concrete state and taint."""
+        self.assertEqual(self.run_ir(True), self.run_ir(False))
+
+
 class TestIRQemu(unittest.TestCase):
     """Test IR based on the qemu test suite."""
 
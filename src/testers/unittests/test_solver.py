@@ -0,0 +1,441 @@
+#!/usr/bin/env python2
+# coding: utf-8
+"""Test Solver."""
+
+import os
+import tempfile
+import unittest
+from triton import TritonContext, Instruction, ARCH, CPUSIZE, SOLVER_STATE
+
+
+class TestSolverSession(unittest.TestCase):
+
+    """Testing the incremental solving session."""
+
+    def setUp(self):
+        """Define the arch and a path over two bytes."""
+        self.ctx = TritonContext()
+        self.ctx.setArchitecture(ARCH.X86_64)
+        self.astCtxt = self.ctx.getAstContext()
+
+        self.x = self.astCtxt.variable(self.ctx.newSymbolicVariable(CPUSIZE.BYTE_BIT))
+        self.y = self.astCtxt.variable(self.ctx.newSymbolicVariable(CPUSIZE.BYTE_BIT))
+
+        # The symbolic expressions shared by the constraints
+        self.sum = self.ctx.newSymbolicExpression(self.x + self.y)
+        self.xor = self.ctx.newSymbolicExpression(self.astCtxt.reference(self.sum) ^ self.x)
+
+        ref = self.astCtxt.reference
+        self.path = [
+            ref(self.sum) == 0x10,
+            self.astCtxt.bvugt(self.x, self.astCtxt.bv(3, CPUSIZE.BYTE_BIT)),
+            ref(self.xor) != 0x12,
+        ]
+
+    def test_session(self):
+        """Check the session state."""
+        self.assertFalse(self.ctx.isSolverSessionStarted())
+        with self.assertRaises(Exception):
+            self.ctx.pushSolverSessionConstraint(self.path[0])
+
+        self.ctx.startSolverSession()
+        self.assertTrue(self.ctx.isSolverSessionStarted())
+        self.assertEqual(self.ctx.getNumberOfSolverSessionConstraints(), 0)
+
+        for constraint in self.path:
+            self.ctx.pushSolverSessionConstraint(constraint)
+        self.assertEqual(self.ctx.getNumberOfSolverSessionConstraints(), 3)
+
+        with self.assertRaises(Exception):
+            self.ctx.popSolverSessionConstraints(4)
+
+        self.ctx.popSolverSessionConstraints(2)
+        self.assertEqual(self.ctx.getNumberOfSolverSessionConstraints(), 1)
+        self.ctx.popSolverSessionConstraints()
+        self.assertEqual(self.ctx.getNumberOfSolverSessionConstraints(), 0)
+
+        # A session is restarted empty
+        self.ctx.pushSolverSessionConstraint(self.path[0])
+        self.ctx.startSolverSession()
+        self.assertEqual(self.ctx.getNumberOfSolverSessionConstraints(), 0)
+
+        self.ctx.stopSolverSession()
+        self.assertFalse(self.ctx.isSolverSessionStarted())
+
+    def test_flip_branches(self):
+        """Check the session answers like getModel() on the whole prefix."""
+        self.ctx.startSolverSession()
+
+        prefix = self.astCtxt.equal(self.astCtxt.bvtrue(), self.astCtxt.bvtrue())
+        for constraint in self.path:
+            flipped = self.astCtxt.lnot(constraint)
+            expected = self.ctx.getModel(self.astCtxt.land([prefix, flipped]))
+            model = self.ctx.getSolverSessionModel(flipped)
+
+            self.assertEqual(len(model) != 0, len(expected) != 0)
+            self.assertEqual(self.ctx.isSolverSessionSat(flipped), len(expected) != 0)
+
+            # The model satisfies the prefix and the flipped constraint
+            if model:
+                for k, v in model.items():
+                    self.ctx.setConcreteVariableValue(self.ctx.getSymbolicVariableFromId(k), v.getValue())
+                self.assertEqual(prefix.evaluate(), 1)
+                self.assertEqual(flipped.evaluate(), 1)
+
+            # The flipped constraint is not kept
+            self.assertTrue(self.ctx.isSolverSessionSat(constraint))
+
+            self.ctx.pushSolverSessionConstraint(constraint)
+            prefix = self.astCtxt.land([prefix, constraint])
+
+        # x + y == 0x10 and x > 3 and ((x + y) ^ x) != 0x12 cannot have x == 2
+        self.assertFalse(self.ctx.isSolverSessionSat(self.x == 2))
+        self.assertEqual(len(self.ctx.getSolverSessionModel(self.x == 2)), 0)
+
+    def test_expression_update(self):
+        """Check an expression which changed since its conversion is converted again."""
+        self.ctx.startSolverSession()
+        constraint = self.astCtxt.reference(self.sum) == 0x10
+
+        self.assertTrue(self.ctx.isSolverSessionSat(constraint))
+        self.sum.setAst(self.astCtxt.bv(0x20, CPUSIZE.BYTE_BIT))
+        self.assertFalse(self.ctx.isSolverSessionSat(constraint))
+
+
+class TestSolveAllBranches(unittest.TestCase):
+
+    """Testing the resolution of all the branches of a path."""
+
+    def setUp(self):
+        """Define the arch and a path with a loop."""
+        self.ctx = TritonContext()
+        self.ctx.setArchitecture(ARCH.X86)
+
+        loop = [
+            (0x1000, "\x83\xf8\x10"),  # cmp eax, 0x10
+            (0x1003, "\x74\x10"),      # je 0x1015
+        ]
+
+        trace = loop + loop + [
+            (0x1005, "\x83\xfb\x20"),  # cmp ebx, 0x20
+            (0x1008, "\x75\x10"),      # jne 0x101a
+        ]
+
+        self.eax = self.ctx.convertRegisterToSymbolicVariable(self.ctx.registers.eax)
+        self.ebx = self.ctx.convertRegisterToSymbolicVariable(self.ctx.registers.ebx)
+
+        for addr, opcodes in trace:
+            inst = Instruction(opcodes)
+            inst.setAddress(addr)
+            self.ctx.processing(inst)
+
+    def test_solve(self):
+        """Check each branch not taken is solved with the taken branches before it."""
+        branches = self.ctx.solveAllBranches(False)
+        self.assertEqual([(b['index'], b['srcAddr'], b['dstAddr']) for b in branches], [(0, 0x1003, 0x1015), (1, 0x1003, 0x1015), (2, 0x1008, 0x100a)])
+        self.assertEqual([b['status'] for b in branches], [SOLVER_STATE.SAT, SOLVER_STATE.UNSAT, SOLVER_STATE.SAT])
+
+        self.assertEqual(branches[0]['model'][self.eax.getId()].getValue(), 0x10)
+        self.assertEqual(len(branches[1]['model']), 0)
+        self.assertEqual(branches[2]['model'][self.ebx.getId()].getValue(), 0x20)
+
+    def test_dedup(self):
+        """Check a branch is solved once per (srcAddr, dstAddr)."""
+        branches = self.ctx.solveAllBranches()
+        self.assertEqual([(b['index'], b['status']) for b in branches], [(0, SOLVER_STATE.SAT), (2, SOLVER_STATE.SAT)])
+
+    def test_empty(self):
+        """Check there is nothing to solve without path constraints."""
+        self.ctx.clearPathConstraints()
+        self.assertEqual(self.ctx.solveAllBranches(True, 1000), [])
+
+
+class SolverFeatureTest(unittest.TestCase):
+
+    """Base class of the tests of a solver feature (enabled by ENABLE, statistics STATS[KEYS])."""
+
+    ENABLE = None
+    IS_ENABLED = None
+    STATS = None
+    KEYS = ()
+
+    def setUp(self):
+        """Define the arch and enable the feature."""
+        self.ctx = TritonContext()
+        self.ctx.setArchitecture(ARCH.X86_64)
+        getattr(self.ctx, self.ENABLE)(True)
+        self.astCtxt = self.ctx.getAstContext()
+
+    def stats(self):
+        """Return the statistics of the feature."""
+        stats = getattr(self.ctx, self.STATS)()
+        return tuple(stats[key] for key in self.KEYS)
+
+
+class TestSolverCache(SolverFeatureTest):
+
+    """Testing the cache of the solver queries."""
+
+    ENABLE = 'enableSolverCache'
+    IS_ENABLED = 'isSolverCacheEnabled'
+    STATS = 'getSolverCacheStats'
+    KEYS = ('size', 'hits', 'misses')
+
+    def setUp(self):
+        """Define a constraint with two solutions."""
+        super(TestSolverCache, self).setUp()
+
+        self.x = self.astCtxt.variable(self.ctx.newSymbolicVariable(CPUSIZE.BYTE_BIT))
+        self.sum = self.ctx.newSymbolicExpression(self.x + 1)
+
+        # x + 1 in {0x10, 0x20}
+        ref = self.astCtxt.reference(self.sum)
+        self.constraint = self.astCtxt.lor([ref == 0x10, ref == 0x20])
+
+    def test_hit(self):
+        """Check an identical constraint is answered by the cache."""
+        self.assertTrue(self.ctx.isSat(self.constraint))
+        self.assertTrue(self.ctx.isSat(self.constraint))
+        self.assertEqual(self.stats(), (1, 1, 1))
+
+        # The same constraint without reference
+        unrolled = self.astCtxt.lor([(self.x + 1) == 0x10, (self.x + 1) == 0x20])
+        self.assertTrue(self.ctx.isSat(unrolled))
+        self.assertEqual(self.stats(), (1, 2, 1))
+
+        # Another constraint
+        self.assertFalse(self.ctx.isSat(self.astCtxt.land([self.constraint, self.x == 0])))
+        self.assertFalse(self.ctx.isSat(self.astCtxt.land([self.constraint, self.x == 0])))
+        self.assertEqual(self.stats(), (2, 3, 2))
+
+    def test_hash_collision(self):
+        """Check two constraints with the same AST hash do not share an entry."""
+        ref = self.astCtxt.reference(self.sum)
+        swapped = self.astCtxt.lor([ref == 0x20, ref == 0x10])
+        self.assertEqual(swapped.getHash(), self.constraint.getHash())
+
+        self.assertTrue(self.ctx.isSat(self.constraint))
+        self.assertTrue(self.ctx.isSat(swapped))
+        self.assertEqual(self.stats(), (2, 0, 2))
+
+        # Each one is answered by its own entry
+        self.assertFalse(self.ctx.isSat(self.astCtxt.land([swapped, self.x == 0])))
+        self.assertTrue(self.ctx.isSat(swapped))
+        self.assertEqual(self.stats(), (3, 1, 3))
+
+    def test_models(self):
+        """Check the models are answered by the cache."""
+        # Only the state is known
+        self.ctx.isSat(self.constraint)
+        model = self.ctx.getModel(self.constraint)
+        self.assertIn(model[0].getValue(), [0xf, 0x1f])
+        self.assertEqual(self.stats(), (1, 0, 2))
+
+        self.assertEqual(self.ctx.getModel(self.constraint)[0].getValue(), model[0].getValue())
+        self.assertEqual(self.stats(), (1, 1, 2))
+
+        # Not enough models are known, then all of them are
+        models = self.ctx.getModels(self.constraint, 10)
+        self.assertEqual(sorted([m[0].getValue() for m in models]), [0xf, 0x1f])
+        self.assertEqual(self.stats(), (1, 1, 3))
+
+        self.assertEqual(len(self.ctx.getModels(self.constraint, 100)), 2)
+        self.assertEqual(len(self.ctx.getModels(self.constraint, 1)), 1)
+        self.assertEqual(self.stats(), (1, 3, 3))
+
+    def test_expression_update(self):
+        """Check a reference is compared through its current expression."""
+        self.assertTrue(self.ctx.isSat(self.constraint))
+        self.sum.setAst(self.astCtxt.bv(0, CPUSIZE.BYTE_BIT))
+        self.assertFalse(self.ctx.isSat(self.constraint))
+        self.assertEqual(self.stats(), (2, 0, 2))
+
+    def test_save_load(self):
+        """Check the cache is kept between two runs."""
+        path = os.path.join(tempfile.mkdtemp(), "solver.cache")
+        model = self.ctx.getModel(self.constraint)
+        self.ctx.isSat(self.astCtxt.land([self.constraint, self.x == 0]))
+        self.ctx.saveSolverCache(path)
+
+        ctx = TritonContext()
+        ctx.setArchitecture(ARCH.X86_64)
+        ctx.enableSolverCache(True)
+        ctx.loadSolverCache(path)
+        os.remove(path)
+        self.assertEqual(ctx.getSolverCacheStats()['size'], 2)
+
+        astCtxt = ctx.getAstContext()
+        x = astCtxt.variable(ctx.newSymbolicVariable(CPUSIZE.BYTE_BIT))
+        constraint = astCtxt.lor([(x + 1) == 0x10, (x + 1) == 0x20])
+        self.assertEqual(ctx.getModel(constraint)[0].getValue(), model[0].getValue())
+        self.assertFalse(ctx.isSat(astCtxt.land([constraint, x == 0])))
+        self.assertEqual(ctx.getSolverCacheStats()['hits'], 2)
+
+        with self.assertRaises(Exception):
+            ctx.loadSolverCache(path)
+
+
+class TestModelCache(SolverFeatureTest):
+
+    """Testing the reuse of the models already found."""
+
+    ENABLE = 'enableModelCache'
+    IS_ENABLED = 'isModelCacheEnabled'
+    STATS = 'getModelCacheStats'
+    KEYS = ('size', 'hits', 'misses')
+
+    def setUp(self):
+        """Define two variables."""
+        super(TestModelCache, self).setUp()
+
+        self.vx = self.ctx.newSymbolicVariable(CPUSIZE.BYTE_BIT)
+        self.vy = self.ctx.newSymbolicVariable(CPUSIZE.BYTE_BIT)
+        self.x = self.astCtxt.variable(self.vx)
+        self.y = self.astCtxt.variable(self.vy)
+
+    def test_reuse(self):
+        """Check a constraint satisfied by a model already found is not sent to the solver."""
+        expr = self.ctx.newSymbolicExpression(self.x + 1)
+        ugt = self.astCtxt.bvugt
+        bv = self.astCtxt.bv
+
+        model = self.ctx.getModel(ugt(self.x, bv(10, CPUSIZE.BYTE_BIT)))
+        value = model[self.vx.getId()].getValue()
+        self.assertGreater(value, 10)
+
+        # Satisfied by the model (through a reference)
+        self.assertTrue(self.ctx.isSat(ugt(self.astCtxt.reference(expr), bv(6, CPUSIZE.BYTE_BIT))))
+        self.assertEqual(self.stats(), (1, 1, 1))
+
+        # The concrete values are not modified
+        self.assertEqual(self.ctx.getConcreteVariableValue(self.vx), 0)
+        self.assertEqual(self.x.evaluate(), 0)
+
+        # Not satisfied by the model
+        self.assertEqual(self.ctx.getModel(self.x == 3)[self.vx.getId()].getValue(), 3)
+        self.assertEqual(self.stats(), (2, 1, 2))
+
+        # The variables which are not in the model take their concrete value
+        self.ctx.setConcreteVariableValue(self.vy, 7)
+        model = self.ctx.getModel(self.astCtxt.land([ugt(self.x, bv(10, CPUSIZE.BYTE_BIT)), self.y == 7]))
+        self.assertEqual(model[self.vx.getId()].getValue(), value)
+        self.assertEqual(model[self.vy.getId()].getValue(), 7)
+        self.assertEqual(self.stats(), (2, 2, 2))
+
+    def test_unsat(self):
+        """Check an unsatisfiable constraint is sent to the solver."""
+        self.ctx.getModel(self.x == 3)
+        self.assertFalse(self.ctx.isSat(self.astCtxt.land([self.x == 3, self.x == 4])))
+        self.assertEqual(len(self.ctx.getModel(self.astCtxt.land([self.x == 3, self.x == 4]))), 0)
+        self.assertEqual(self.stats(), (1, 0, 3))
+
+
+class TestConstraintPartitioning(SolverFeatureTest):
+
+    """Testing the partitioning of the constraints sent to the solver."""
+
+    ENABLE = 'enableConstraintPartitioning'
+    IS_ENABLED = 'isConstraintPartitioningEnabled'
+    STATS = 'getConstraintPartitioningStats'
+    KEYS = ('queries', 'constraints', 'sentConstraints', 'variables', 'sentVariables')
+
+    def setUp(self):
+        """Define three variables."""
+        super(TestConstraintPartitioning, self).setUp()
+
+        self.vx = self.ctx.newSymbolicVariable(CPUSIZE.BYTE_BIT)
+        self.vy = self.ctx.newSymbolicVariable(CPUSIZE.BYTE_BIT)
+        self.vz = self.ctx.newSymbolicVariable(CPUSIZE.BYTE_BIT)
+        self.x = self.astCtxt.variable(self.vx)
+        self.y = self.astCtxt.variable(self.vy)
+        self.z = self.astCtxt.variable(self.vz)
+
+        # x = 1, y = 2 and z = 3
+        self.ctx.setConcreteVariableValue(self.vx, 1)
+        self.ctx.setConcreteVariableValue(self.vy, 2)
+        self.ctx.setConcreteVariableValue(self.vz, 3)
+
+    def test_partition(self):
+        """Check only the constraints sharing variables with the flipped one are sent to the solver."""
+        bv = self.astCtxt.bv
+        expr = self.ctx.newSymbolicExpression(self.x + self.z)
+
+        # The prefix of the path holds with the concrete values, x != 1 is the branch to flip
+        node = self.astCtxt.land([
+            self.y == 2,
+            self.astCtxt.bvult(self.astCtxt.reference(expr), bv(10, CPUSIZE.BYTE_BIT)),
+            self.y != 1,
+            self.x != 1,
+        ])
+        model = self.ctx.getModel(node)
+        self.assertEqual(self.stats(), (1, 4, 2, 3, 2))
+
+        # y keeps its concrete value, x and z (linked through the reference) are solved
+        self.assertEqual(model[self.vy.getId()].getValue(), 2)
+        self.assertNotEqual(model[self.vx.getId()].getValue(), 1)
+        self.assertLess((model[self.vx.getId()].getValue() + model[self.vz.getId()].getValue()) & 0xff, 10)
+
+        self.assertTrue(self.ctx.isSat(node))
+        self.assertEqual(self.stats(), (2, 8, 4, 6, 4))
+
+    def test_unsatisfied_prefix(self):
+        """Check a prefix constraint which the concrete values do not satisfy is sent to the solver."""
+        # y == 5 does not hold with y = 2, z == 3 does
+        node = self.astCtxt.land([self.y == 5, self.z == 3, self.x != 1])
+        model = self.ctx.getModel(node)
+        self.assertEqual(self.stats(), (1, 3, 2, 3, 2))
+
+        self.assertEqual(model[self.vy.getId()].getValue(), 5)
+        self.assertEqual(model[self.vz.getId()].getValue(), 3)
+        self.assertNotEqual(model[self.vx.getId()].getValue(), 1)
+
+        # Not satisfiable once the prefix is sent
+        self.assertFalse(self.ctx.isSat(self.astCtxt.land([self.y == 5, self.y != 5, self.x != 1])))
+
+    def test_concrete(self):
+        """Check the concrete values are the model if they satisfy all the constraints."""
+        node = self.astCtxt.land([self.x == 1, self.y == 2])
+        model = self.ctx.getModel(node)
+        self.assertEqual(model[self.vx.getId()].getValue(), 1)
+        self.assertEqual(model[self.vy.getId()].getValue(), 2)
+        self.assertTrue(self.ctx.isSat(node))
+        self.assertEqual(self.stats(), (2, 4, 0, 4, 0))
+
+    def test_unsat(self):
+        """Check an unsatisfiable partition makes the query unsatisfiable."""
+        node = self.astCtxt.land([self.y == 2, self.x == 3, self.x == 4])
+        self.assertFalse(self.ctx.isSat(node))
+        self.assertEqual(len(self.ctx.getModel(node)), 0)
+
+        node = self.astCtxt.land([self.y == 2, self.astCtxt.equal(self.astCtxt.bvfalse(), self.astCtxt.bvtrue())])
+        self.assertFalse(self.ctx.isSat(node))
+        self.assertEqual(self.stats(), (3, 8, 5, 5, 2))
+
+
+class TestSolverFeatures(unittest.TestCase):
+
+    """Testing the enabling of the solver features."""
+
+    def test_enable(self):
+        """Check a feature is disabled by default and its statistics are cleared when it is disabled."""
+        for feature in (TestSolverCache, TestModelCache, TestConstraintPartitioning):
+            ctx = TritonContext()
+            ctx.setArchitecture(ARCH.X86_64)
+            astCtxt = ctx.getAstContext()
+            x = astCtxt.variable(ctx.newSymbolicVariable(CPUSIZE.BYTE_BIT))
+            stats = lambda: tuple(getattr(ctx, feature.STATS)()[key] for key in feature.KEYS)
+
+            self.assertFalse(getattr(ctx, feature.IS_ENABLED)(), feature.ENABLE)
+            getattr(ctx, feature.ENABLE)(True)
+            self.assertTrue(getattr(ctx, feature.IS_ENABLED)(), feature.ENABLE)
+
+            ctx.getModel(x == 5)
+            self.assertNotEqual(stats(), (0,) * len(feature.KEYS), feature.ENABLE)
+
+            getattr(ctx, feature.ENABLE)(False)
+            self.assertFalse(getattr(ctx, feature.IS_ENABLED)(), feature.ENABLE)
+            self.assertEqual(stats(), (0,) * len(feature.KEYS), feature.ENABLE)
+
+            # Nothing is recorded while disabled
+            ctx.getModel(x == 6)
+            self.assertEqual(stats(), (0,) * len(feature.KEYS), feature.ENABLE)
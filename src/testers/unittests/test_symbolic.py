@@ -4,7 +4,7 @@
 
 import unittest
 
-from triton import ARCH, Instruction, CPUSIZE, MemoryAccess, Immediate, TritonContext
+from triton import ARCH, AST_NODE, Instruction, CPUSIZE, MemoryAccess, Immediate, TritonContext
 
 
 class TestSymbolic(unittest.TestCase):
@@ -45,6 +45,31 @@ class TestSymbolic(unittest.TestCase):
         # Try to reset engine after a backup to test if the bug #385 is fixed.
         self.Triton.reset()
 
+    def test_disabled_engine_state(self):
+        """Check the symbolic state is left untouched when the engine is disabled."""
+        self.Triton.setConcreteRegisterValue(self.Triton.registers.rax, 0x11)
+        self.Triton.convertRegisterToSymbolicVariable(self.Triton.registers.rax)
+        self.Triton.convertMemoryToSymbolicVariable(MemoryAccess(0x1000, CPUSIZE.QWORD))
+        self.Triton.setConcreteRegisterValue(self.Triton.registers.rbx, 0x1000)
+
+        def state():
+            return (sorted((r, e.getId()) for r, e in self.Triton.getSymbolicRegisters().items()),
+                    sorted((a, e.getId()) for a, e in self.Triton.getSymbolicMemory().items()),
+                    sorted(self.Triton.getSymbolicExpressions().keys()),
+                    len(self.Triton.getPathConstraints()))
+
+        before = state()
+        self.Triton.enableSymbolicEngine(False)
+
+        for opcode in ["\x48\x11\xc1",         # adc  rcx, rax
+                       "\x48\x87\x03",         # xchg qword ptr [rbx], rax
+                       "\x48\x0f\xc1\x43\x04", # xadd qword ptr [rbx+4], rax
+                       "\x74\x00"]:            # je   +0
+            self.assertTrue(self.Triton.processing(Instruction(opcode)))
+
+        self.assertEqual(state(), before)
+        self.assertEqual(self.Triton.getConcreteMemoryValue(MemoryAccess(0x1000, CPUSIZE.DWORD)), 0x11)
+
     def test_bind_expr_to_memory(self):
         """Check symbolic expression binded to memory can be retrieve."""
         # Bind expr1 to 0x100
@@ -77,6 +102,82 @@ class TestSymbolic(unittest.TestCase):
 
         self.assertEqual(self.Triton.getSymbolicMemoryValue(mem), 0x11223344)
 
+        # Reading the bytes does not split the range and returns the same slices
+        self.assertEqual(self.Triton.getMemoryAst(mem).getKind(), AST_NODE.REFERENCE)
+        self.assertEqual(self.Triton.getSymbolicMemory(0x101).getId(), expr3.getId())
+
+    def test_bind_expr_to_memory_range(self):
+        """Check a symbolic expression binded to memory is kept as a whole."""
+        expr1 = self.Triton.newSymbolicExpression(self.astCtxt.bv(0x1122334455667788, 64))
+        mem = MemoryAccess(0x100, CPUSIZE.QWORD)
+        self.Triton.assignSymbolicExpressionToMemory(expr1, mem)
+
+        # An access which matches the store references the expression
+        node = self.Triton.getMemoryAst(mem)
+        self.assertEqual(node.getKind(), AST_NODE.REFERENCE)
+        self.assertEqual(node.getValue(), expr1.getId())
+
+        # Other accesses extract their bytes from it
+        self.assertEqual(self.Triton.getMemoryAst(MemoryAccess(0x102, CPUSIZE.DWORD)).evaluate(), 0x33445566)
+        self.assertEqual(self.Triton.getMemoryAst(MemoryAccess(0xfe, CPUSIZE.DWORD)).evaluate(), 0x77880000)
+
+        # Overwrite the middle of the range
+        expr2 = self.Triton.newSymbolicExpression(self.astCtxt.bv(0xaabb, 16))
+        self.Triton.assignSymbolicExpressionToMemory(expr2, MemoryAccess(0x103, CPUSIZE.WORD))
+        self.assertEqual(self.Triton.getMemoryAst(mem).evaluate(), 0x112233aabb667788)
+        self.assertEqual(self.Triton.getSymbolicMemory(0x104).getAst().evaluate(), 0xaa)
+        self.assertEqual(self.Triton.getSymbolicMemory(0x105).getAst().evaluate(), 0x33)
+        self.assertEqual(len(self.Triton.getSymbolicMemory()), 8)
+
+        # Concretize a byte of the range
+        self.Triton.concretizeMemory(0x107)
+        self.assertIsNone(self.Triton.getSymbolicMemory(0x107))
+        self.assertEqual(self.Triton.getMemoryAst(mem).evaluate(), 0x002233aabb667788)
+
+    def test_bind_expr_across_pages(self):
+        """Check a symbolic expression binded to memory across several pages."""
+        expr1 = self.Triton.newSymbolicExpression(self.astCtxt.bv(0x1122334455667788, 64))
+        mem = MemoryAccess(0x1ffc, CPUSIZE.QWORD)
+        self.Triton.assignSymbolicExpressionToMemory(expr1, mem)
+
+        node = self.Triton.getMemoryAst(mem)
+        self.assertEqual(node.getKind(), AST_NODE.REFERENCE)
+        self.assertEqual(node.getValue(), expr1.getId())
+        self.assertEqual(self.Triton.getMemoryAst(MemoryAccess(0x1ffe, CPUSIZE.DWORD)).evaluate(), 0x33445566)
+        self.assertEqual(sorted(self.Triton.getSymbolicMemory().keys()), range(0x1ffc, 0x2004))
+
+        # A symbolic variable on the next page
+        self.Triton.convertMemoryToSymbolicVariable(MemoryAccess(0x2100, CPUSIZE.BYTE))
+        self.assertTrue(self.Triton.isMemorySymbolized(0x2100))
+        self.assertFalse(self.Triton.isMemorySymbolized(MemoryAccess(0x2000, CPUSIZE.DQWORD)))
+
+        # Concretize the bytes of the second page
+        self.Triton.concretizeMemory(MemoryAccess(0x2000, CPUSIZE.QQWORD))
+        self.assertEqual(self.Triton.getMemoryAst(mem).evaluate(), 0x55667788)
+        self.assertEqual(len(self.Triton.getSymbolicMemory()), 5)
+
+        self.Triton.concretizeAllMemory()
+        self.assertEqual(len(self.Triton.getSymbolicMemory()), 0)
+        self.assertFalse(self.Triton.isMemorySymbolized(0x2100))
+
+    def test_concrete_memory_ast(self):
+        """Check that the concrete bytes of a memory access are merged into constants."""
+        self.Triton.setConcreteMemoryAreaValue(0x200, [0x41 + i for i in range(32)])
+
+        # A concrete access is a single constant
+        node = self.Triton.getMemoryAst(MemoryAccess(0x200, CPUSIZE.QWORD))
+        self.assertEqual(node.getKind(), AST_NODE.BV)
+        self.assertEqual(node.evaluate(), 0x4847464544434241)
+
+        # A symbolic byte in the middle of a wide access splits it in three parts
+        self.Triton.convertMemoryToSymbolicVariable(MemoryAccess(0x210, CPUSIZE.BYTE))
+        node = self.Triton.getMemoryAst(MemoryAccess(0x200, CPUSIZE.QQWORD))
+        self.assertEqual(node.getKind(), AST_NODE.CONCAT)
+        self.assertEqual(len(node.getChildren()), 3)
+        self.assertEqual(node.getChildren()[0].getBitvectorSize(), 15 * 8)
+        self.assertEqual(node.getChildren()[2].getBitvectorSize(), 16 * 8)
+        self.assertEqual(node.evaluate(), sum((0x41 + i) << (8 * i) for i in range(32)))
+
     def test_bind_expr_to_register(self):
         """Check symbolic expression binded to register."""
         expr1 = self.Triton.newSymbolicExpression(self.astCtxt.bv(0x11223344, 64))
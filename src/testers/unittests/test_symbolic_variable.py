@@ -61,3 +61,27 @@ class TestSymbolicVariable(unittest.TestCase):
         self.assertEqual(str(self.v1), "SymVar_1:16")
         self.assertEqual(str(self.v2), "SymVar_2:32")
 
+    def test_from_name(self):
+        """Test the lookup by name"""
+        self.assertEqual(self.Triton.getSymbolicVariableFromName("SymVar_1").getId(), 1)
+        self.assertEqual(self.Triton.getSymbolicVariableFromName("SymVar_2").getComment(), "test com")
+        self.assertIsNone(self.Triton.getSymbolicVariableFromName("SymVar_3"))
+
+        v3 = self.Triton.newSymbolicVariable(64)
+        self.assertEqual(self.Triton.getSymbolicVariableFromName("SymVar_3").getId(), v3.getId())
+
+    def test_concrete_value(self):
+        """Test the concrete value"""
+        astCtxt = self.Triton.getAstContext()
+        node = astCtxt.variable(self.v1)
+        self.assertEqual(astCtxt.variable(self.v1).getValue(), node.getValue())
+        self.assertEqual(node.evaluate(), 0)
+
+        self.Triton.setConcreteVariableValue(self.v1, 0x1234)
+        self.assertEqual(self.Triton.getConcreteVariableValue(self.v1), 0x1234)
+        self.assertEqual(node.evaluate(), 0x1234)
+
+        astCtxt.variable(self.v2)
+        self.Triton.setConcreteVariableValue(self.v2, 0x5678)
+        self.assertEqual(self.Triton.getConcreteVariableValue(self.v1), 0x1234)
+        self.assertEqual(self.Triton.getConcreteVariableValue(self.v2), 0x5678)
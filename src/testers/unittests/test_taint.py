@@ -4,7 +4,7 @@
 
 import unittest
 
-from triton import ARCH, Instruction, MemoryAccess, TritonContext
+from triton import ARCH, Instruction, MemoryAccess, MODE, TritonContext
 
 
 class TestTaint(unittest.TestCase):
@@ -85,6 +85,48 @@ class TestTaint(unittest.TestCase):
         self.assertFalse(Triton.isRegisterTainted(Triton.registers.eax))
         self.assertFalse(Triton.isRegisterTainted(Triton.registers.ax))
 
+    def test_taint_register_bytes(self):
+        """Check the bytes of the registers are tainted separately."""
+        Triton = TritonContext()
+        Triton.setArchitecture(ARCH.X86_64)
+
+        Triton.taintRegister(Triton.registers.al)
+        self.assertTrue(Triton.isRegisterTainted(Triton.registers.rax))
+        self.assertTrue(Triton.isRegisterTainted(Triton.registers.ax))
+        self.assertFalse(Triton.isRegisterTainted(Triton.registers.ah))
+
+        # The bytes are moved between registers of the same size
+        Triton.taintAssignmentRegisterRegister(Triton.registers.bh, Triton.registers.al)
+        self.assertTrue(Triton.isRegisterTainted(Triton.registers.bh))
+        self.assertFalse(Triton.isRegisterTainted(Triton.registers.bl))
+        Triton.taintAssignmentRegisterRegister(Triton.registers.ecx, Triton.registers.ebx)
+        self.assertTrue(Triton.isRegisterTainted(Triton.registers.ch))
+        self.assertFalse(Triton.isRegisterTainted(Triton.registers.cl))
+
+        # and between a register and a memory of the same size
+        Triton.taintAssignmentMemoryRegister(MemoryAccess(0x1000, 4), Triton.registers.ecx)
+        self.assertFalse(Triton.isMemoryTainted(MemoryAccess(0x1000, 1)))
+        self.assertTrue(Triton.isMemoryTainted(MemoryAccess(0x1001, 1)))
+        self.assertFalse(Triton.isMemoryTainted(MemoryAccess(0x1002, 2)))
+        Triton.taintAssignmentRegisterMemory(Triton.registers.dx, MemoryAccess(0x1000, 2))
+        self.assertTrue(Triton.isRegisterTainted(Triton.registers.dh))
+        self.assertFalse(Triton.isRegisterTainted(Triton.registers.dl))
+
+        # A source of another size taints the whole destination
+        Triton.taintAssignmentRegisterRegister(Triton.registers.esi, Triton.registers.ch)
+        self.assertTrue(Triton.isRegisterTainted(Triton.registers.sil))
+
+        # A union taints the whole destination
+        Triton.taintUnionRegisterImmediate(Triton.registers.ebx)
+        self.assertTrue(Triton.isRegisterTainted(Triton.registers.bl))
+
+        # A write of 32 bits or more clears the upper bytes
+        Triton.taintRegister(Triton.registers.rdi)
+        Triton.taintAssignmentRegisterImmediate(Triton.registers.di)
+        self.assertTrue(Triton.isRegisterTainted(Triton.registers.rdi))
+        Triton.taintAssignmentRegisterImmediate(Triton.registers.edi)
+        self.assertFalse(Triton.isRegisterTainted(Triton.registers.rdi))
+
     def test_taint_assignement_memory_immediate(self):
         """Check tainting assignment memory <- immediate."""
         Triton = TritonContext()
@@ -429,6 +471,130 @@ class TestTaint(unittest.TestCase):
         self.assertTrue(0x4003 in m)
         self.assertFalse(0x5000 in m)
 
+    def test_taint_memory_pages(self):
+        """Taint and untaint memory areas across pages"""
+        Triton = TritonContext()
+        Triton.setArchitecture(ARCH.X86_64)
+
+        # A large area spread over several pages
+        Triton.taintMemory(MemoryAccess(0x10ff0, 64))
+        for addr in range(0x0fff0, 0x20000, 0x10):
+            Triton.taintMemory(MemoryAccess(addr, 16))
+
+        self.assertTrue(Triton.isMemoryTainted(MemoryAccess(0xffec, 8)))
+        self.assertFalse(Triton.isMemoryTainted(MemoryAccess(0xffe0, 8)))
+        self.assertEqual(len(Triton.getTaintedMemory()), 0x20000 - 0xfff0)
+
+        # Untaint a hole which crosses a page boundary
+        Triton.untaintMemory(MemoryAccess(0x10ffc, 8))
+        self.assertFalse(Triton.isMemoryTainted(MemoryAccess(0x10ffc, 8)))
+        self.assertTrue(Triton.isMemoryTainted(MemoryAccess(0x10ffb, 8)))
+        self.assertTrue(Triton.isMemoryTainted(MemoryAccess(0x11004, 1)))
+
+        # The addresses are returned in ascending order
+        m = Triton.getTaintedMemory()
+        self.assertEqual(m, sorted(m))
+        self.assertEqual(len(m), 0x20000 - 0xfff0 - 8)
+        self.assertFalse(0x11000 in m)
+
+        Triton.untaintMemory(MemoryAccess(0xfff0, 16))
+        self.assertEqual(Triton.getTaintedMemory()[0], 0x10000)
+
+    def test_taint_memory_expressions(self):
+        """Check the stored expressions are tainted as a whole, without slicing them."""
+        Triton = TritonContext()
+        Triton.setArchitecture(ARCH.X86_64)
+        astCtxt = Triton.getAstContext()
+
+        expr = Triton.newSymbolicExpression(astCtxt.bv(0x1122334455667788, 64))
+        Triton.assignSymbolicExpressionToMemory(expr, MemoryAccess(0x1000, 8))
+        count = len(Triton.getSymbolicExpressions())
+
+        Triton.taintRegister(Triton.registers.rax)
+        Triton.taintAssignmentMemoryRegister(MemoryAccess(0x1000, 8), Triton.registers.rax)
+        self.assertTrue(expr.isTainted())
+        self.assertEqual(len(Triton.getSymbolicExpressions()), count)
+
+        # A byte sliced on read is a registered expression tainted as its range
+        byte = Triton.getSymbolicMemory(0x1003)
+        self.assertTrue(byte.isTainted())
+        self.assertEqual(Triton.getSymbolicExpressionFromId(byte.getId()).getId(), byte.getId())
+
+        Triton.taintAssignmentMemoryImmediate(MemoryAccess(0x1000, 8))
+        self.assertFalse(expr.isTainted())
+        self.assertFalse(Triton.getSymbolicMemory(0x1003).isTainted())
+
+    def test_taint_labels(self):
+        """Spread the taint labels"""
+        Triton = TritonContext()
+        Triton.setArchitecture(ARCH.X86_64)
+        Triton.enableMode(MODE.TAINT_LABELS, True)
+
+        Triton.taintMemory(MemoryAccess(0x1000, 4), 0)
+        Triton.taintMemory(MemoryAccess(0x1002, 4), 5)
+        Triton.taintRegister(Triton.registers.rbx, 1)
+        self.assertEqual(Triton.getTaintLabels(MemoryAccess(0x1000, 2)), 0b1)
+        self.assertEqual(Triton.getTaintLabels(MemoryAccess(0x1000, 4)), 0b100001)
+        self.assertEqual(Triton.getTaintLabels(Triton.registers.bl), 0b10)
+
+        # Assignment and union
+        Triton.taintAssignmentRegisterMemory(Triton.registers.rax, MemoryAccess(0x1000, 2))
+        self.assertEqual(Triton.getTaintLabels(Triton.registers.rax), 0b1)
+        Triton.taintUnionRegisterRegister(Triton.registers.rax, Triton.registers.rbx)
+        self.assertEqual(Triton.getTaintLabels(Triton.registers.rax), 0b11)
+        Triton.taintUnionMemoryRegister(MemoryAccess(0x1000, 1), Triton.registers.rbx)
+        self.assertEqual(Triton.getTaintLabels(MemoryAccess(0x1000, 1)), 0b11)
+        self.assertEqual(Triton.getTaintLabels(MemoryAccess(0x1001, 1)), 0b1)
+        Triton.taintAssignmentMemoryMemory(MemoryAccess(0x2000, 4), MemoryAccess(0x1000, 4))
+        self.assertEqual(Triton.getTaintLabels(MemoryAccess(0x2000, 1)), 0b11)
+        self.assertEqual(Triton.getTaintLabels(MemoryAccess(0x2003, 1)), 0b100001)
+        Triton.taintAssignmentRegisterImmediate(Triton.registers.rax)
+        self.assertEqual(Triton.getTaintLabels(Triton.registers.rax), 0)
+
+        # Untainted bytes lose their labels
+        Triton.untaintMemory(MemoryAccess(0x1000, 4))
+        Triton.taintMemory(0x1000)
+        self.assertEqual(Triton.getTaintLabels(MemoryAccess(0x1000, 4)), 0)
+
+        with self.assertRaises(Exception):
+            Triton.taintRegister(Triton.registers.rcx, 64)
+
+    def test_taint_labels_sets(self):
+        """The sets of labels no longer held are released without changing the others"""
+        Triton = TritonContext()
+        Triton.setArchitecture(ARCH.X86_64)
+        Triton.enableMode(MODE.TAINT_LABELS, True)
+
+        for label in range(64):
+            Triton.taintMemory(MemoryAccess(0x1000 + label, 1), label)
+
+        # Create and drop more distinct sets than the collection threshold
+        for a in range(64):
+            for b in range(a + 1, 64):
+                for c in range(b + 1, 64, 16):
+                    Triton.untaintMemory(MemoryAccess(0x2000, 1))
+                    for label in (a, b, c):
+                        Triton.taintMemory(MemoryAccess(0x2000, 1), label)
+
+        for label in range(64):
+            self.assertEqual(Triton.getTaintLabels(MemoryAccess(0x1000 + label, 1)), 1 << label)
+        self.assertEqual(Triton.getTaintLabels(MemoryAccess(0x2000, 1)), (1 << 61) | (1 << 62) | (1 << 63))
+
+    def test_taint_labels_flags(self):
+        """The flags get the taint labels of their instruction"""
+        Triton = TritonContext()
+        Triton.setArchitecture(ARCH.X86_64)
+        Triton.enableMode(MODE.TAINT_LABELS, True)
+
+        Triton.taintRegister(Triton.registers.rbx, 1)
+        Triton.taintMemory(MemoryAccess(0x3000, 4), 2)
+        Triton.setConcreteRegisterValue(Triton.registers.rdi, 0x3000)
+        Triton.processing(Instruction("\x03\x1f"))  # add ebx, dword ptr [rdi]
+        self.assertEqual(Triton.getTaintLabels(Triton.registers.rbx), 0b110)
+        self.assertEqual(Triton.getTaintLabels(Triton.registers.zf), 0b110)
+        Triton.processing(Instruction("\x39\x07"))  # cmp dword ptr [rdi], eax
+        self.assertEqual(Triton.getTaintLabels(Triton.registers.zf), 0b100)
+
     def test_taint_set_register(self):
         """Set taint register"""
         Triton = TritonContext()